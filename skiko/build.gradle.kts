@@ -582,6 +582,11 @@ val skikoRuntimeDirForTests = skikoRuntimeDirForTestsTask(targetOs, targetArch,
 
 val allJvmRuntimeJars = mutableMapOf((targetOs to targetArch) to skikoJvmRuntimeJar)
 
+if (targetOs == hostOs && (targetOs == OS.Linux || targetOs == OS.MacOS)) {
+    val compileReplayHarness = createCompileReplayHarnessTask(targetOs, targetArch, skiaJvmBindingsDir)
+    createLinkReplayHarness(targetOs, targetArch, skiaJvmBindingsDir, compileReplayHarness)
+}
+
 if (supportAndroid) {
     val os = OS.Android
     for (arch in arrayOf(Arch.X64, Arch.Arm64)) {
@@ -831,6 +836,92 @@ fun createLinkJvmBindings(
         flags.set(listOf(*osFlags))
     }
 
+// Headless harness replaying frames captured with FrameCapture, see src/replayMain/cpp/Replay.cc
+fun createCompileReplayHarnessTask(
+    targetOs: OS,
+    targetArch: Arch,
+    skiaDir: Provider<File>
+) = project.registerSkikoTask<CompileSkikoCppTask>("compileReplayHarness", targetOs, targetArch) {
+    dependsOn(skiaDir)
+    buildTargetOS.set(targetOs)
+    buildTargetArch.set(targetArch)
+    buildVariant.set(buildType)
+
+    sourceRoots.set(projectDirs("src/replayMain/cpp"))
+    includeHeadersNonRecursive(skiaHeadersDirs(skiaDir.get()))
+    compiler.set(compilerForTarget(targetOs, targetArch))
+
+    val osFlags = when (targetOs) {
+        OS.MacOS -> arrayOf(
+            *targetOs.clangFlags,
+            *buildType.clangFlags,
+            "-stdlib=libc++",
+            "-DSK_BUILD_FOR_MAC",
+        )
+        OS.Linux -> arrayOf(
+            *buildType.clangFlags,
+            "-fno-rtti",
+            "-fno-exceptions",
+            "-DSK_BUILD_FOR_LINUX",
+            "-D_GLIBCXX_USE_CXX11_ABI=0",
+        )
+        else -> error("Replay harness is not supported on $targetOs")
+    }
+    flags.set(listOf(*skiaPreprocessorFlags(), *osFlags))
+}
+
+fun createLinkReplayHarness(
+    targetOs: OS,
+    targetArch: Arch,
+    skiaDir: Provider<File>,
+    compileTask: TaskProvider<CompileSkikoCppTask>
+) = project.registerSkikoTask<LinkSkikoTask>("linkReplayHarness", targetOs, targetArch) {
+    val target = targetId(targetOs, targetArch)
+    val skiaBinSubdir = "out/${buildType.id}-$target"
+    val skiaBinDir = skiaDir.get().absolutePath + "/" + skiaBinSubdir
+
+    libFiles = fileTree(skiaDir.map { it.resolve(skiaBinSubdir) }) {
+        include("*.a")
+    }
+    dependsOn(compileTask)
+    objectFiles = fileTree(compileTask.map { it.outDir.get() }) {
+        include("**/*.o")
+    }
+
+    libOutputFileName.set("skiko-replay-${targetOs.id}-${targetArch.id}")
+    buildTargetOS.set(targetOs)
+    buildTargetArch.set(targetArch)
+    buildVariant.set(buildType)
+    linker.set(linkerForTarget(targetOs, targetArch))
+
+    val osFlags = when (targetOs) {
+        OS.MacOS -> arrayOf(
+            *targetOs.clangFlags,
+            "-dead_strip",
+            "-framework", "CoreFoundation",
+            "-framework", "CoreGraphics",
+            "-framework", "CoreServices",
+            "-framework", "CoreText",
+            "-framework", "Foundation",
+            "-framework", "Metal",
+            "-framework", "OpenGL",
+        )
+        OS.Linux -> arrayOf(
+            "-static-libstdc++",
+            "-static-libgcc",
+            "-lGL",
+            "-lfontconfig",
+            "-lpthread",
+            // Same link order workaround as in linkJvmBindings
+            "$skiaBinDir/libsksg.a",
+            "$skiaBinDir/libskia.a",
+            "$skiaBinDir/libskunicode.a"
+        )
+        else -> error("Replay harness is not supported on $targetOs")
+    }
+    flags.set(listOf(*osFlags))
+}
+
 if (hostOs == OS.MacOS) {
     // Very hacky way to compile Objective-C sources and add the
     // resulting object files into the final library.
@@ -1004,6 +1095,7 @@ tasks.withType<Test>().configureEach {
         systemProperty("skiko.test.screenshots.dir", File(project.projectDir, "src/jvmTest/screenshots").absolutePath)
         systemProperty("skiko.test.ui.enabled", System.getProperty("skiko.test.ui.enabled", "false"))
         systemProperty("skiko.test.ui.renderApi", System.getProperty("skiko.test.ui.renderApi", "all"))
+        systemProperty("skiko.test.performance.enabled", System.getProperty("skiko.test.performance.enabled", "false"))
 
         // Tests should be deterministic, so disable scaling.
         // On MacOs we need the actual scale, otherwise we will have aliased screenshots because of scaling.
@@ -0,0 +1,39 @@
+#include <algorithm>
+#include <thread>
+#include "Parallel.hh"
+#include "src/core/SkTaskGroup.h"
+
+namespace skikoMpp {
+    namespace parallel {
+        int threadCount() {
+#ifdef SKIKO_WASM
+            return 1;
+#else
+            static int count = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+            return count;
+#endif
+        }
+
+        SkExecutor& executor() {
+#ifdef SKIKO_WASM
+            return SkExecutor::GetDefault();
+#else
+            static std::unique_ptr<SkExecutor> pool = SkExecutor::MakeFIFOThreadPool(threadCount());
+            return *pool;
+#endif
+        }
+
+        void forEach(int count, std::function<void(int)> fn) {
+            if (count <= 0)
+                return;
+            if (count == 1 || threadCount() == 1) {
+                for (int i = 0; i < count; ++i)
+                    fn(i);
+                return;
+            }
+            SkTaskGroup group(executor());
+            group.batch(count, std::move(fn));
+            group.wait();
+        }
+    }
+}
@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <cstring>
+#include "BatchedDraws.hh"
+#include "SkRRect.h"
+#include "SkVertices.h"
+
+namespace skikoMpp {
+    namespace batch {
+        namespace {
+            // Below this count separate draws are cheap enough and keep antialiasing semantics
+            const int kMinTessellatedRects = 64;
+            // Keeps every vertex buffer around 200KB
+            const int kMaxRectsPerVertices = 4096;
+
+            bool shouldTessellate(SkCanvas* canvas, const SkColor* colors, int count, const SkPaint& paint) {
+                if (count < kMinTessellatedRects)
+                    return false;
+                // Raster canvases blit rects directly, faster than rasterizing triangles
+                if (canvas->recordingContext() == nullptr && canvas->imageInfo().colorType() != kUnknown_SkColorType)
+                    return false;
+                // Vertex colors replace paint color, paint alpha would still modulate them
+                if (colors && paint.getAlpha() != 0xFF)
+                    return false;
+                // drawVertices with kDst ignores the shader, and would filter vertex colors
+                // instead of each rect's color
+                return paint.getStyle() == SkPaint::kFill_Style
+                    && !paint.isAntiAlias()
+                    && paint.getShader() == nullptr
+                    && paint.getColorFilter() == nullptr
+                    && paint.getPathEffect() == nullptr
+                    && paint.getMaskFilter() == nullptr
+                    && paint.getImageFilter() == nullptr;
+            }
+
+            void tessellateRects(SkCanvas* canvas, const float* ltrb, const SkColor* colors, int count, const SkPaint& paint) {
+                for (int first = 0; first < count; first += kMaxRectsPerVertices) {
+                    int batch = std::min(kMaxRectsPerVertices, count - first);
+                    SkVertices::Builder builder(SkVertices::kTriangles_VertexMode, batch * 6, 0,
+                                                colors ? SkVertices::kHasColors_BuilderFlag : 0);
+                    SkPoint* positions = builder.positions();
+                    SkColor* vertexColors = builder.colors();
+                    for (int i = 0; i < batch; ++i) {
+                        const float* r = ltrb + (first + i) * 4;
+                        SkPoint* p = positions + i * 6;
+                        p[0].set(r[0], r[1]);
+                        p[1].set(r[2], r[1]);
+                        p[2].set(r[0], r[3]);
+                        p[3].set(r[2], r[1]);
+                        p[4].set(r[2], r[3]);
+                        p[5].set(r[0], r[3]);
+                        if (vertexColors)
+                            std::fill(vertexColors + i * 6, vertexColors + i * 6 + 6, colors[first + i]);
+                    }
+                    // kDst keeps vertex colors as they are instead of blending them with paint color
+                    canvas->drawVertices(builder.detach(), SkBlendMode::kDst, paint);
+                }
+            }
+
+            template <typename DrawItem>
+            void drawEach(const SkColor* colors, int count, const SkPaint& paint, DrawItem drawItem) {
+                if (colors == nullptr) {
+                    for (int i = 0; i < count; ++i)
+                        drawItem(i, paint);
+                    return;
+                }
+                SkPaint itemPaint(paint);
+                for (int i = 0; i < count; ++i) {
+                    itemPaint.setColor(colors[i]);
+                    drawItem(i, itemPaint);
+                }
+            }
+        }
+
+        void drawRects(SkCanvas* canvas, const float* ltrb, const SkColor* colors, int count, const SkPaint& paint) {
+            if (shouldTessellate(canvas, colors, count, paint)) {
+                tessellateRects(canvas, ltrb, colors, count, paint);
+                return;
+            }
+            drawEach(colors, count, paint, [&](int i, const SkPaint& itemPaint) {
+                const float* r = ltrb + i * 4;
+                canvas->drawRect(SkRect::MakeLTRB(r[0], r[1], r[2], r[3]), itemPaint);
+            });
+        }
+
+        void drawRRects(SkCanvas* canvas, const float* rrects, const SkColor* colors, int count, const SkPaint& paint) {
+            drawEach(colors, count, paint, [&](int i, const SkPaint& itemPaint) {
+                const float* r = rrects + i * 6;
+                canvas->drawRRect(SkRRect::MakeRectXY(SkRect::MakeLTRB(r[0], r[1], r[2], r[3]), r[4], r[5]), itemPaint);
+            });
+        }
+
+        void drawCircles(SkCanvas* canvas, const float* circles, const SkColor* colors, int count, const SkPaint& paint) {
+            drawEach(colors, count, paint, [&](int i, const SkPaint& itemPaint) {
+                const float* c = circles + i * 3;
+                canvas->drawCircle(c[0], c[1], c[2], itemPaint);
+            });
+        }
+
+        sk_sp<SkTextBlob> makeGlyphRuns(const SkFont& font, const SkGlyphID* glyphs, const float* positions,
+                                        int glyphCount, const int* runOffsets, const float* origins, int runCount) {
+            if (glyphCount <= 0 || runCount <= 0)
+                return nullptr;
+            // Builder keeps its run bookkeeping between calls, make() hands glyph storage over to the blob.
+            // All runs share the font, so they are written as one run with absolute positions.
+            thread_local SkTextBlobBuilder builder;
+            const SkTextBlobBuilder::RunBuffer& run = builder.allocRunPos(font, glyphCount);
+            memcpy(run.glyphs, glyphs, glyphCount * sizeof(SkGlyphID));
+            for (int r = 0; r < runCount; ++r) {
+                int start = std::max(0, runOffsets[r]);
+                int end = r + 1 < runCount ? std::min(glyphCount, runOffsets[r + 1]) : glyphCount;
+                float originX = origins[r * 2];
+                float originY = origins[r * 2 + 1];
+                for (int i = start; i < end; ++i) {
+                    run.pos[i * 2] = positions[i * 2] + originX;
+                    run.pos[i * 2 + 1] = positions[i * 2 + 1] + originY;
+                }
+            }
+            return builder.make();
+        }
+    }
+}
@@ -0,0 +1,74 @@
+#include <cstring>
+#include "VerticesBuffer.hh"
+
+namespace {
+    bool inRange(int offset, int count, int size) {
+        return offset >= 0 && count >= 0 && offset <= size && count <= size - offset;
+    }
+}
+
+std::unique_ptr<VerticesBuffer> VerticesBuffer::Make(SkVertices::VertexMode mode, int vertexCount, int indexCount,
+                                                     bool hasTexCoords, bool hasColors) {
+    if (vertexCount < 0 || indexCount < 0)
+        return nullptr;
+    std::unique_ptr<VerticesBuffer> instance(new VerticesBuffer(mode, vertexCount, indexCount, hasTexCoords, hasColors));
+    if (!instance->vertices())
+        return nullptr;
+    return instance;
+}
+
+VerticesBuffer::VerticesBuffer(SkVertices::VertexMode mode, int vertexCount, int indexCount, bool hasTexCoords, bool hasColors)
+    : fMode(mode)
+    , fVertexCount(vertexCount)
+    , fIndexCount(indexCount)
+    , fPositions(vertexCount, SkPoint::Make(0, 0))
+    , fTexCoords(hasTexCoords ? vertexCount : 0, SkPoint::Make(0, 0))
+    , fColors(hasColors ? vertexCount : 0, 0)
+    , fIndices(indexCount, 0)
+    , fEdited(true) {}
+
+bool VerticesBuffer::setPositions(const float* xy, int offset, int count) {
+    if (!inRange(offset, count, fVertexCount))
+        return false;
+    memcpy(fPositions.data() + offset, xy, count * sizeof(SkPoint));
+    fEdited = true;
+    return true;
+}
+
+bool VerticesBuffer::setTexCoords(const float* uv, int offset, int count) {
+    if (!hasTexCoords() || !inRange(offset, count, fVertexCount))
+        return false;
+    memcpy(fTexCoords.data() + offset, uv, count * sizeof(SkPoint));
+    fEdited = true;
+    return true;
+}
+
+bool VerticesBuffer::setColors(const SkColor* colors, int offset, int count) {
+    if (!hasColors() || !inRange(offset, count, fVertexCount))
+        return false;
+    memcpy(fColors.data() + offset, colors, count * sizeof(SkColor));
+    fEdited = true;
+    return true;
+}
+
+bool VerticesBuffer::setIndices(const uint16_t* indices, int offset, int count) {
+    if (!inRange(offset, count, fIndexCount))
+        return false;
+    memcpy(fIndices.data() + offset, indices, count * sizeof(uint16_t));
+    fEdited = true;
+    return true;
+}
+
+sk_sp<SkVertices> VerticesBuffer::vertices() {
+    if (fEdited) {
+        // Earlier snapshot stays untouched for pictures and GPU ops that still reference it
+        sk_sp<SkVertices> vertices = SkVertices::MakeCopy(fMode, fVertexCount, fPositions.data(),
+                                                          texCoordsStorage(), colorsStorage(),
+                                                          fIndexCount, indicesStorage());
+        if (!vertices)
+            return fVertices;
+        fVertices = std::move(vertices);
+        fEdited = false;
+    }
+    return fVertices;
+}
@@ -0,0 +1,286 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/stat.h>
+#include "FontIndex.hh"
+#include "SkData.h"
+#include "SkStream.h"
+
+namespace {
+    const char kMagic[4] = { 'S', 'K', 'F', 'I' };
+    const uint32_t kVersion = 1;
+
+    int64_t modificationTime(const char* path) {
+        struct stat info;
+        if (stat(path, &info) != 0)
+            return 0;
+        return static_cast<int64_t>(info.st_mtime);
+    }
+
+    std::string styleKey(const char familyName[], const SkFontStyle& style) {
+        std::string key = familyName ? familyName : "";
+        key.push_back('\0');
+        int32_t values[3] = { style.weight(), style.width(), style.slant() };
+        key.append(reinterpret_cast<const char*>(values), sizeof(values));
+        return key;
+    }
+
+    bool readString(SkMemoryStream* stream, SkString* value) {
+        uint32_t length;
+        if (!stream->readU32(&length) || length > stream->getLength() - stream->getPosition())
+            return false;
+        value->resize(length);
+        return stream->read(value->writable_str(), length) == length;
+    }
+
+    bool writeString(SkWStream* stream, const SkString& value) {
+        return stream->write32(static_cast<uint32_t>(value.size())) && stream->write(value.c_str(), value.size());
+    }
+}
+
+class FontIndex::StyleSet : public SkFontStyleSet {
+public:
+    StyleSet(sk_sp<const FontIndex> index, int family): fIndex(std::move(index)), fFamily(fIndex->fFamilies[family]) {}
+
+    int count() override {
+        return static_cast<int>(fFamily.fStyles.size());
+    }
+
+    void getStyle(int index, SkFontStyle* style, SkString* name) override {
+        if (style)
+            *style = fFamily.fStyles[index];
+        if (name)
+            *name = fFamily.fStyleNames[index];
+    }
+
+    SkTypeface* createTypeface(int index) override {
+        // Families can have several faces with the same style, only the wrapped set tells them apart
+        if (!fBaseSet)
+            fBaseSet.reset(fIndex->fBase->matchFamily(fFamily.fName.c_str()));
+        if (fBaseSet && fBaseSet->count() == count())
+            return fBaseSet->createTypeface(index);
+        // Fonts changed since the snapshot was written
+        return fIndex->matchFamilyStyle(fFamily.fName.c_str(), fFamily.fStyles[index]);
+    }
+
+    SkTypeface* matchStyle(const SkFontStyle& pattern) override {
+        return matchStyleCSS3(pattern);
+    }
+
+private:
+    sk_sp<const FontIndex> fIndex;
+    const Family& fFamily;
+    // Style set of the wrapped manager, asked for on first createTypeface
+    sk_sp<SkFontStyleSet> fBaseSet;
+};
+
+sk_sp<FontIndex> FontIndex::Default() {
+    static FontIndex* index = new FontIndex(SkFontMgr::RefDefault());
+    return sk_ref_sp(index);
+}
+
+FontIndex::FontIndex(sk_sp<SkFontMgr> base): fBase(std::move(base)) {}
+
+const std::vector<FontIndex::Family>& FontIndex::families() const {
+    fBuilt([this] { build(); });
+    return fFamilies;
+}
+
+void FontIndex::build() const {
+    std::vector<Family> families(fBase->countFamilies());
+    for (int i = 0; i < static_cast<int>(families.size()); ++i) {
+        Family& family = families[i];
+        fBase->getFamilyName(i, &family.fName);
+        sk_sp<SkFontStyleSet> styleSet(fBase->createStyleSet(i));
+        int count = styleSet ? styleSet->count() : 0;
+        family.fStyles.resize(count);
+        family.fStyleNames.resize(count);
+        for (int j = 0; j < count; ++j)
+            styleSet->getStyle(j, &family.fStyles[j], &family.fStyleNames[j]);
+    }
+    addFamilies(std::move(families));
+}
+
+void FontIndex::addFamilies(std::vector<Family> families) const {
+    fFamilies = std::move(families);
+    for (int i = 0; i < static_cast<int>(fFamilies.size()); ++i)
+        fFamilyIndices.emplace(fFamilies[i].fName.c_str(), i);
+}
+
+int64_t FontIndex::SnapshotKey() {
+#ifdef SK_BUILD_FOR_UNIX
+    // fontconfig touches its cache directories whenever fonts are added or removed
+    int64_t key = modificationTime("/var/cache/fontconfig");
+    SkString userCache;
+    if (const char* cacheHome = getenv("XDG_CACHE_HOME"))
+        userCache.printf("%s/fontconfig", cacheHome);
+    else if (const char* home = getenv("HOME"))
+        userCache.printf("%s/.cache/fontconfig", home);
+    if (!userCache.isEmpty())
+        key = std::max(key, modificationTime(userCache.c_str()));
+    return key;
+#else
+    return 0;
+#endif
+}
+
+bool FontIndex::load(const char* path) {
+    int64_t key = SnapshotKey();
+    if (key == 0)
+        return false;
+    sk_sp<SkData> data = SkData::MakeFromFileName(path);
+    if (!data)
+        return false;
+
+    SkMemoryStream stream(data);
+    char magic[4];
+    uint32_t version;
+    int64_t fileKey;
+    uint32_t count;
+    if (stream.read(magic, sizeof(magic)) != sizeof(magic) || memcmp(magic, kMagic, sizeof(kMagic)) != 0
+        || !stream.readU32(&version) || version != kVersion
+        || stream.read(&fileKey, sizeof(fileKey)) != sizeof(fileKey) || fileKey != key
+        || !stream.readU32(&count) || count != static_cast<uint32_t>(fBase->countFamilies()))
+        return false;
+
+    std::vector<Family> families(count);
+    for (Family& family : families) {
+        uint32_t styleCount;
+        if (!readString(&stream, &family.fName) || !stream.readU32(&styleCount)
+            || styleCount > stream.getLength() - stream.getPosition())
+            return false;
+        family.fStyles.resize(styleCount);
+        family.fStyleNames.resize(styleCount);
+        for (uint32_t j = 0; j < styleCount; ++j) {
+            int32_t weight, width, slant;
+            if (!stream.readS32(&weight) || !stream.readS32(&width) || !stream.readS32(&slant)
+                || slant < SkFontStyle::kUpright_Slant || slant > SkFontStyle::kOblique_Slant
+                || !readString(&stream, &family.fStyleNames[j]))
+                return false;
+            family.fStyles[j] = SkFontStyle(weight, width, static_cast<SkFontStyle::Slant>(slant));
+        }
+    }
+    if (!stream.isAtEnd())
+        return false;
+
+    bool loaded = false;
+    fBuilt([&] {
+        addFamilies(std::move(families));
+        loaded = true;
+    });
+    return loaded;
+}
+
+bool FontIndex::save(const char* path) const {
+    int64_t key = SnapshotKey();
+    if (key == 0)
+        return false;
+    const std::vector<Family>& all = families();
+
+    SkString tmpPath = SkStringPrintf("%s.tmp", path);
+    {
+        SkFILEWStream stream(tmpPath.c_str());
+        if (!stream.isValid())
+            return false;
+        bool ok = stream.write(kMagic, sizeof(kMagic)) && stream.write32(kVersion)
+            && stream.write(&key, sizeof(key)) && stream.write32(static_cast<uint32_t>(all.size()));
+        for (const Family& family : all) {
+            ok = ok && writeString(&stream, family.fName) && stream.write32(static_cast<uint32_t>(family.fStyles.size()));
+            for (size_t j = 0; j < family.fStyles.size(); ++j) {
+                const SkFontStyle& style = family.fStyles[j];
+                ok = ok && stream.write32(style.weight()) && stream.write32(style.width())
+                    && stream.write32(style.slant()) && writeString(&stream, family.fStyleNames[j]);
+            }
+        }
+        if (!ok)
+            return false;
+        stream.flush();
+    }
+    return std::rename(tmpPath.c_str(), path) == 0;
+}
+
+int FontIndex::onCountFamilies() const {
+    return static_cast<int>(families().size());
+}
+
+void FontIndex::onGetFamilyName(int index, SkString* familyName) const {
+    const std::vector<Family>& all = families();
+    if (index < 0 || index >= static_cast<int>(all.size()))
+        familyName->reset();
+    else
+        *familyName = all[index].fName;
+}
+
+SkFontStyleSet* FontIndex::onCreateStyleSet(int index) const {
+    if (index < 0 || index >= static_cast<int>(families().size()))
+        return nullptr;
+    return new StyleSet(sk_ref_sp(this), index);
+}
+
+SkFontStyleSet* FontIndex::onMatchFamily(const char familyName[]) const {
+    if (familyName) {
+        families();
+        auto it = fFamilyIndices.find(familyName);
+        if (it != fFamilyIndices.end())
+            return new StyleSet(sk_ref_sp(this), it->second);
+    }
+    // Aliases and the default family are resolved by the wrapped manager
+    return fBase->matchFamily(familyName);
+}
+
+SkTypeface* FontIndex::onMatchFamilyStyle(const char familyName[], const SkFontStyle& style) const {
+    std::string key = styleKey(familyName, style);
+    {
+        SkAutoSharedMutexShared lock(fMutex);
+        auto it = fMatches.find(key);
+        if (it != fMatches.end())
+            return SkSafeRef(it->second.get());
+    }
+    sk_sp<SkTypeface> typeface(fBase->matchFamilyStyle(familyName, style));
+    SkAutoSharedMutexExclusive lock(fMutex);
+    auto it = fMatches.emplace(std::move(key), std::move(typeface)).first;
+    return SkSafeRef(it->second.get());
+}
+
+SkTypeface* FontIndex::onMatchFamilyStyleCharacter(const char familyName[], const SkFontStyle& style,
+                                                   const char* bcp47[], int bcp47Count,
+                                                   SkUnichar character) const {
+    std::string key = styleKey(familyName, style);
+    for (int i = 0; i < bcp47Count; ++i) {
+        key.append(bcp47[i] ? bcp47[i] : "");
+        key.push_back('\0');
+    }
+    key.append(reinterpret_cast<const char*>(&character), sizeof(character));
+    {
+        SkAutoSharedMutexShared lock(fMutex);
+        auto it = fCharacterMatches.find(key);
+        if (it != fCharacterMatches.end())
+            return SkSafeRef(it->second.get());
+    }
+    sk_sp<SkTypeface> typeface(fBase->matchFamilyStyleCharacter(familyName, style, bcp47, bcp47Count, character));
+    SkAutoSharedMutexExclusive lock(fMutex);
+    auto it = fCharacterMatches.emplace(std::move(key), std::move(typeface)).first;
+    return SkSafeRef(it->second.get());
+}
+
+sk_sp<SkTypeface> FontIndex::onMakeFromData(sk_sp<SkData> data, int ttcIndex) const {
+    return fBase->makeFromData(std::move(data), ttcIndex);
+}
+
+sk_sp<SkTypeface> FontIndex::onMakeFromStreamIndex(std::unique_ptr<SkStreamAsset> stream, int ttcIndex) const {
+    return fBase->makeFromStream(std::move(stream), ttcIndex);
+}
+
+sk_sp<SkTypeface> FontIndex::onMakeFromStreamArgs(std::unique_ptr<SkStreamAsset> stream,
+                                                  const SkFontArguments& args) const {
+    return fBase->makeFromStream(std::move(stream), args);
+}
+
+sk_sp<SkTypeface> FontIndex::onMakeFromFile(const char path[], int ttcIndex) const {
+    return fBase->makeFromFile(path, ttcIndex);
+}
+
+sk_sp<SkTypeface> FontIndex::onLegacyMakeTypeface(const char familyName[], SkFontStyle style) const {
+    return fBase->legacyMakeTypeface(familyName, style);
+}
@@ -0,0 +1,191 @@
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include "GlyphPathCache.hh"
+#include "Parallel.hh"
+#include "SkTypeface.h"
+
+namespace {
+    // Below this number of misses thread handoff costs more than it saves
+    const int kMinParallelMisses = 256;
+
+    uint32_t floatBits(float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+}
+
+size_t GlyphPathCache::KeyHash::operator()(const Key& key) const {
+    size_t h = key.fTypefaceID;
+    h = h * 31 + floatBits(key.fSize);
+    h = h * 31 + floatBits(key.fScaleX);
+    h = h * 31 + floatBits(key.fSkewX);
+    h = h * 31 + (key.fEmbolden ? 1 : 0);
+    h = h * 31 + key.fGlyph;
+    return h;
+}
+
+GlyphPathCache& GlyphPathCache::Get() {
+    static GlyphPathCache* instance = new GlyphPathCache();
+    return *instance;
+}
+
+GlyphPathCache::GlyphPathCache()
+    : fBytesUsed(0)
+    , fByteBudget(kDefaultByteBudget)
+    , fHits(0)
+    , fMisses(0)
+    , fEvictions(0)
+{
+}
+
+GlyphPathCache::Key GlyphPathCache::MakeKey(const SkFont& font, SkGlyphID glyph) {
+    return { font.getTypefaceOrDefault()->uniqueID(), font.getSize(), font.getScaleX(), font.getSkewX(),
+             font.isEmbolden(), glyph };
+}
+
+void GlyphPathCache::Extract(const SkFont& font, const SkGlyphID* glyphs, int count, SkPath* paths, bool* hasPath) {
+    struct Ctx {
+        SkPath* paths;
+        bool* hasPath;
+        int index;
+    } ctx = { paths, hasPath, 0 };
+
+    // Callback is invoked once per glyph in order, with null for glyphs without outline
+    font.getPaths(glyphs, count, [](const SkPath* orig, const SkMatrix& mx, void* voidCtx) {
+        Ctx* ctx = static_cast<Ctx*>(voidCtx);
+        if (orig) {
+            orig->transform(mx, &ctx->paths[ctx->index]);
+            ctx->hasPath[ctx->index] = true;
+        } else {
+            ctx->hasPath[ctx->index] = false;
+        }
+        ctx->index++;
+    }, &ctx);
+}
+
+void GlyphPathCache::getPaths(const SkFont& font, const SkGlyphID* glyphs, int count, bool parallel,
+                              std::vector<SkPath>* paths, std::vector<bool>* hasPath) {
+    paths->assign(count, SkPath());
+    hasPath->assign(count, false);
+    if (count <= 0)
+        return;
+
+    std::vector<SkGlyphID> misses;
+    std::unordered_map<SkGlyphID, int> missIndex;
+    std::vector<int> pending;
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        for (int i = 0; i < count; ++i) {
+            auto it = fIndex.find(MakeKey(font, glyphs[i]));
+            if (it != fIndex.end()) {
+                fHits++;
+                fEntries.splice(fEntries.begin(), fEntries, it->second);
+                (*paths)[i] = it->second->fPath;
+                (*hasPath)[i] = it->second->fHasPath;
+            } else {
+                fMisses++;
+                if (missIndex.emplace(glyphs[i], static_cast<int>(misses.size())).second)
+                    misses.push_back(glyphs[i]);
+                pending.push_back(i);
+            }
+        }
+    }
+    if (misses.empty())
+        return;
+
+    // Extraction runs outside of the lock, so slow outlines don't block other threads
+    int missCount = static_cast<int>(misses.size());
+    std::vector<SkPath> extracted(missCount);
+    std::unique_ptr<bool[]> extractedHasPath(new bool[missCount]);
+    int chunks = parallel && missCount >= kMinParallelMisses
+        ? std::min(skikoMpp::parallel::threadCount(), missCount / (kMinParallelMisses / 2))
+        : 1;
+    if (chunks <= 1) {
+        Extract(font, misses.data(), missCount, extracted.data(), extractedHasPath.get());
+    } else {
+        int chunkSize = (missCount + chunks - 1) / chunks;
+        skikoMpp::parallel::forEach(chunks, [&](int chunk) {
+            int start = chunk * chunkSize;
+            int end = std::min(missCount, start + chunkSize);
+            if (start < end)
+                Extract(font, misses.data() + start, end - start, extracted.data() + start, extractedHasPath.get() + start);
+        });
+    }
+
+    for (int i : pending) {
+        int m = missIndex[glyphs[i]];
+        (*paths)[i] = extracted[m];
+        (*hasPath)[i] = extractedHasPath[m];
+    }
+
+    SkAutoMutexExclusive lock(fMutex);
+    for (int m = 0; m < missCount; ++m) {
+        Key key = MakeKey(font, misses[m]);
+        if (fIndex.find(key) != fIndex.end())
+            continue;
+        size_t bytes = sizeof(Entry) + extracted[m].approximateBytesUsed();
+        fEntries.push_front({ key, extracted[m], extractedHasPath[m], bytes });
+        fIndex.emplace(key, fEntries.begin());
+        fBytesUsed += bytes;
+    }
+    purgeLocked(fByteBudget);
+}
+
+void GlyphPathCache::getCombinedPath(const SkFont& font, const SkGlyphID* glyphs, int count, const float* positions,
+                                     bool parallel, SkPath* dst, int* verbOffsets) {
+    std::vector<SkPath> paths;
+    std::vector<bool> hasPath;
+    getPaths(font, glyphs, count, parallel, &paths, &hasPath);
+
+    int pointCount = 0;
+    for (int i = 0; i < count; ++i)
+        pointCount += paths[i].countPoints();
+    dst->reset();
+    dst->incReserve(pointCount);
+
+    for (int i = 0; i < count; ++i) {
+        verbOffsets[i] = dst->countVerbs();
+        if (!hasPath[i])
+            continue;
+        if (positions)
+            dst->addPath(paths[i], positions[i * 2], positions[i * 2 + 1]);
+        else
+            dst->addPath(paths[i]);
+    }
+    verbOffsets[count] = dst->countVerbs();
+}
+
+void GlyphPathCache::setByteBudget(size_t byteBudget) {
+    SkAutoMutexExclusive lock(fMutex);
+    fByteBudget = byteBudget;
+    purgeLocked(fByteBudget);
+}
+
+void GlyphPathCache::purgeAll() {
+    SkAutoMutexExclusive lock(fMutex);
+    purgeLocked(0);
+}
+
+GlyphPathCache::Stats GlyphPathCache::getStats() const {
+    SkAutoMutexExclusive lock(fMutex);
+    return { fHits, fMisses, fEvictions, static_cast<int32_t>(fEntries.size()), fBytesUsed, fByteBudget };
+}
+
+void GlyphPathCache::resetStats() {
+    SkAutoMutexExclusive lock(fMutex);
+    fHits = 0;
+    fMisses = 0;
+    fEvictions = 0;
+}
+
+void GlyphPathCache::purgeLocked(size_t targetBytes) {
+    while (fBytesUsed > targetBytes && !fEntries.empty()) {
+        Entry& last = fEntries.back();
+        fIndex.erase(last.fKey);
+        fBytesUsed -= last.fBytes;
+        fEvictions++;
+        fEntries.pop_back();
+    }
+}
@@ -0,0 +1,236 @@
+#include <algorithm>
+#include <bitset>
+#include <map>
+#include "TypefaceCoverage.hh"
+#include "SkData.h"
+
+namespace {
+    const SkFontTableTag kCmapTag = SkSetFourByteTag('c', 'm', 'a', 'p');
+
+    uint16_t readU16(const uint8_t* data) {
+        return static_cast<uint16_t>(data[0] << 8 | data[1]);
+    }
+
+    uint32_t readU32(const uint8_t* data) {
+        return static_cast<uint32_t>(data[0]) << 24 | data[1] << 16 | data[2] << 8 | data[3];
+    }
+
+    void set(std::vector<uint32_t>* bitmap, uint32_t unichar) {
+        (*bitmap)[unichar >> 5] |= 1u << (unichar & 31);
+    }
+
+    void setRange(std::vector<uint32_t>* bitmap, uint32_t first, uint32_t last) {
+        for (uint32_t unichar = first; unichar <= last; ++unichar)
+            set(bitmap, unichar);
+    }
+
+    bool parseFormat4(const uint8_t* table, size_t size, std::vector<uint32_t>* bitmap) {
+        if (size < 14)
+            return false;
+        uint32_t segCount = readU16(table + 6) / 2;
+        const uint8_t* endCodes = table + 14;
+        const uint8_t* startCodes = endCodes + segCount * 2 + 2;
+        const uint8_t* idDeltas = startCodes + segCount * 2;
+        const uint8_t* idRangeOffsets = idDeltas + segCount * 2;
+        if (idRangeOffsets + segCount * 2 > table + size)
+            return false;
+
+        for (uint32_t i = 0; i < segCount; ++i) {
+            uint32_t start = readU16(startCodes + i * 2);
+            uint32_t end = readU16(endCodes + i * 2);
+            uint16_t idDelta = readU16(idDeltas + i * 2);
+            uint16_t idRangeOffset = readU16(idRangeOffsets + i * 2);
+            // Final 0xFFFF segment only terminates the table
+            if (end == 0xFFFF)
+                end = 0xFFFE;
+            for (uint32_t unichar = start; unichar <= end; ++unichar) {
+                uint16_t glyph;
+                if (idRangeOffset == 0) {
+                    glyph = static_cast<uint16_t>(unichar + idDelta);
+                } else {
+                    const uint8_t* glyphId = idRangeOffsets + i * 2 + idRangeOffset + (unichar - start) * 2;
+                    if (glyphId + 2 > table + size)
+                        break;
+                    glyph = readU16(glyphId);
+                    if (glyph != 0)
+                        glyph = static_cast<uint16_t>(glyph + idDelta);
+                }
+                if (glyph != 0)
+                    set(bitmap, unichar);
+            }
+        }
+        return true;
+    }
+
+    bool parseFormat12(const uint8_t* table, size_t size, bool manyToOne, std::vector<uint32_t>* bitmap) {
+        if (size < 16)
+            return false;
+        uint32_t groupCount = readU32(table + 12);
+        if (groupCount > (size - 16) / 12)
+            return false;
+        for (uint32_t i = 0; i < groupCount; ++i) {
+            const uint8_t* group = table + 16 + i * 12;
+            uint32_t start = readU32(group);
+            uint32_t end = std::min(readU32(group + 4), 0x10FFFFu);
+            uint32_t startGlyph = readU32(group + 8);
+            if (start > end)
+                continue;
+            if (startGlyph == 0) {
+                // Glyph 0 is .notdef, the rest of a format 12 group maps to real glyphs
+                if (manyToOne || start == end)
+                    continue;
+                start++;
+            }
+            setRange(bitmap, start, end);
+        }
+        return true;
+    }
+}
+
+std::shared_ptr<const TypefaceCoverage> TypefaceCoverage::Get(SkTypeface* typeface) {
+    Cache& cache = GetCache();
+    SkTypefaceID id = typeface->uniqueID();
+    {
+        SkAutoMutexExclusive lock(cache.fMutex);
+        auto it = cache.fIndex.find(id);
+        if (it != cache.fIndex.end()) {
+            cache.fEntries.splice(cache.fEntries.begin(), cache.fEntries, it->second);
+            return it->second->second;
+        }
+    }
+
+    std::shared_ptr<TypefaceCoverage> coverage(new TypefaceCoverage());
+    std::vector<uint32_t> bitmap(kUnicodeSize / 32);
+    sk_sp<SkData> cmap = typeface->copyTableData(kCmapTag);
+    if (cmap && Parse(cmap->bytes(), cmap->size(), &bitmap))
+        coverage->compress(bitmap);
+    else
+        coverage->fTypeface = sk_ref_sp(typeface);
+
+    SkAutoMutexExclusive lock(cache.fMutex);
+    auto it = cache.fIndex.find(id);
+    if (it != cache.fIndex.end())
+        return it->second->second;
+    cache.fEntries.emplace_front(id, coverage);
+    cache.fIndex.emplace(id, cache.fEntries.begin());
+    if (cache.fEntries.size() > kMaxEntries) {
+        cache.fIndex.erase(cache.fEntries.back().first);
+        cache.fEntries.pop_back();
+    }
+    return coverage;
+}
+
+TypefaceCoverage::Cache& TypefaceCoverage::GetCache() {
+    static Cache* cache = new Cache();
+    return *cache;
+}
+
+bool TypefaceCoverage::Parse(const uint8_t* cmap, size_t size, std::vector<uint32_t>* bitmap) {
+    if (size < 4)
+        return false;
+    uint32_t tableCount = readU16(cmap + 2);
+    if (tableCount > (size - 4) / 8)
+        return false;
+
+    // Prefer full repertoire subtables, then BMP ones, as FreeType and CoreText do
+    const uint8_t* best = nullptr;
+    int bestScore = 0;
+    for (uint32_t i = 0; i < tableCount; ++i) {
+        const uint8_t* record = cmap + 4 + i * 8;
+        uint16_t platform = readU16(record);
+        uint16_t encoding = readU16(record + 2);
+        uint32_t offset = readU32(record + 4);
+        if (offset > size - 2)
+            continue;
+        uint16_t format = readU16(cmap + offset);
+        int score = 0;
+        if (format == 12 && ((platform == 3 && encoding == 10) || (platform == 0 && (encoding == 4 || encoding == 6))))
+            score = 4;
+        else if (format == 13 && platform == 0 && encoding == 6)
+            score = 3;
+        else if (format == 4 && platform == 3 && encoding == 1)
+            score = 2;
+        else if (format == 4 && platform == 0 && encoding <= 3)
+            score = 1;
+        if (score > bestScore) {
+            best = cmap + offset;
+            bestScore = score;
+        }
+    }
+    if (!best)
+        return false;
+
+    size_t remaining = size - (best - cmap);
+    uint16_t format = readU16(best);
+    // Format 4 length overflows in large fonts, so it is only bounded by the table
+    if (format == 4)
+        return parseFormat4(best, remaining, bitmap);
+    if (remaining < 8)
+        return false;
+    return parseFormat12(best, std::min<size_t>(remaining, readU32(best + 4)), format == 13, bitmap);
+}
+
+void TypefaceCoverage::compress(const std::vector<uint32_t>& bitmap) {
+    fPages.resize(kUnicodeSize >> 8);
+    fBits.assign(2 * kBlockWords, 0);
+    std::fill(fBits.begin() + kFullBlock * kBlockWords, fBits.end(), 0xFFFFFFFFu);
+    fCount = 0;
+
+    // Many CJK and symbol pages are partially covered in the same way, share those too
+    std::map<std::vector<uint32_t>, uint16_t> blocks;
+    for (uint32_t page = 0; page < fPages.size(); ++page) {
+        std::vector<uint32_t> block(bitmap.begin() + page * kBlockWords, bitmap.begin() + (page + 1) * kBlockWords);
+        uint32_t any = 0;
+        uint32_t all = 0xFFFFFFFFu;
+        for (uint32_t word : block) {
+            any |= word;
+            all &= word;
+            fCount += static_cast<int>(std::bitset<32>(word).count());
+        }
+        if (!any) {
+            fPages[page] = kEmptyBlock;
+        } else if (all == 0xFFFFFFFFu) {
+            fPages[page] = kFullBlock;
+        } else {
+            auto it = blocks.find(block);
+            if (it == blocks.end()) {
+                uint16_t index = static_cast<uint16_t>(fBits.size() / kBlockWords);
+                fBits.insert(fBits.end(), block.begin(), block.end());
+                it = blocks.emplace(std::move(block), index).first;
+            }
+            fPages[page] = it->second;
+        }
+    }
+}
+
+bool TypefaceCoverage::coversAll(const SkUnichar* unichars, int count) const {
+    if (fTypeface) {
+        std::vector<SkGlyphID> glyphs(count);
+        fTypeface->unicharsToGlyphs(unichars, count, glyphs.data());
+        for (int i = 0; i < count; ++i) {
+            if (unichars[i] < 0 || glyphs[i] == 0)
+                return false;
+        }
+        return true;
+    }
+    // Branchless within a batch, so long runs of covered text don't mispredict
+    const int kBatch = 64;
+    for (int start = 0; start < count; start += kBatch) {
+        int end = std::min(count, start + kBatch);
+        uint32_t all = 1;
+        for (int i = start; i < end; ++i) {
+            uint32_t unichar = static_cast<uint32_t>(unichars[i]);
+            uint32_t valid = unichar < kUnicodeSize;
+            unichar = valid ? unichar : 0;
+            uint32_t block = fPages[unichar >> 8];
+            all &= valid & (fBits[block * kBlockWords + ((unichar >> 5) & (kBlockWords - 1))] >> (unichar & 31));
+        }
+        if (!all)
+            return false;
+    }
+    return true;
+}
+
+int TypefaceCoverage::count() const {
+    return fTypeface ? -1 : fCount;
+}
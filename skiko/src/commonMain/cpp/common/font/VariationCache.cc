@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "VariationCache.hh"
+
+VariationCache& VariationCache::Get() {
+    static VariationCache* instance = new VariationCache();
+    return *instance;
+}
+
+VariationCache::VariationCache()
+    : fCapacity(kDefaultCapacity)
+    , fHits(0)
+    , fMisses(0)
+    , fEvictions(0)
+{
+}
+
+sk_sp<SkTypeface> VariationCache::makeClone(SkTypeface* base, const SkFontArguments::VariationPosition::Coordinate* coordinates,
+                                            int count, int collectionIndex) {
+    using Coordinate = SkFontArguments::VariationPosition::Coordinate;
+    std::vector<Coordinate> sorted(coordinates, coordinates + count);
+    // Later values for the same axis win, as in makeClone
+    std::stable_sort(sorted.begin(), sorted.end(), [](const Coordinate& a, const Coordinate& b) {
+        return a.axis < b.axis;
+    });
+    std::vector<Coordinate> unique;
+    for (const Coordinate& coordinate : sorted) {
+        if (!unique.empty() && unique.back().axis == coordinate.axis)
+            unique.back() = coordinate;
+        else
+            unique.push_back(coordinate);
+    }
+
+    // Steps are looked up first, so that axis ranges are only read when some axis is quantized
+    std::vector<float> steps(unique.size(), 0);
+    bool quantized = false;
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        for (size_t i = 0; i < unique.size(); ++i) {
+            auto it = fQuantization.find(unique[i].axis);
+            if (it != fQuantization.end()) {
+                steps[i] = it->second;
+                quantized = true;
+            }
+        }
+    }
+    if (quantized) {
+        int axisCount = base->getVariationDesignParameters(nullptr, 0);
+        std::vector<SkFontParameters::Variation::Axis> axes(std::max(axisCount, 0));
+        if (axisCount > 0 && base->getVariationDesignParameters(axes.data(), axisCount) != axisCount)
+            axes.clear();
+        for (size_t i = 0; i < unique.size(); ++i) {
+            if (steps[i] <= 0)
+                continue;
+            auto axis = std::find_if(axes.begin(), axes.end(), [&](const SkFontParameters::Variation::Axis& a) {
+                return a.tag == unique[i].axis;
+            });
+            // Rounding by more than the whole range would collapse e.g. ital or slnt to one value
+            if (axis == axes.end() || steps[i] > axis->max - axis->min)
+                continue;
+            float value = std::round(unique[i].value / steps[i]) * steps[i];
+            unique[i].value = std::min(std::max(value, axis->min), axis->max);
+        }
+    }
+
+    std::string key;
+    SkTypefaceID id = base->uniqueID();
+    key.append(reinterpret_cast<const char*>(&id), sizeof(id));
+    key.append(reinterpret_cast<const char*>(&collectionIndex), sizeof(collectionIndex));
+    for (const Coordinate& coordinate : unique) {
+        key.append(reinterpret_cast<const char*>(&coordinate.axis), sizeof(coordinate.axis));
+        key.append(reinterpret_cast<const char*>(&coordinate.value), sizeof(coordinate.value));
+    }
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        auto it = fIndex.find(key);
+        if (it != fIndex.end()) {
+            fHits++;
+            fEntries.splice(fEntries.begin(), fEntries, it->second);
+            return it->second->fTypeface;
+        }
+        fMisses++;
+    }
+
+    SkFontArguments args = SkFontArguments()
+                               .setCollectionIndex(collectionIndex)
+                               .setVariationDesignPosition({unique.data(), static_cast<int>(unique.size())});
+    sk_sp<SkTypeface> clone = base->makeClone(args);
+    if (!clone)
+        return nullptr;
+
+    SkAutoMutexExclusive lock(fMutex);
+    auto it = fIndex.find(key);
+    if (it != fIndex.end())
+        return it->second->fTypeface;
+    fEntries.push_front({ key, clone });
+    fIndex.emplace(std::move(key), fEntries.begin());
+    purgeLocked(static_cast<size_t>(fCapacity));
+    return clone;
+}
+
+void VariationCache::setCapacity(int32_t capacity) {
+    SkAutoMutexExclusive lock(fMutex);
+    fCapacity = std::max(capacity, 0);
+    purgeLocked(static_cast<size_t>(fCapacity));
+}
+
+void VariationCache::setQuantization(SkFourByteTag axis, float step) {
+    SkAutoMutexExclusive lock(fMutex);
+    if (step > 0)
+        fQuantization[axis] = step;
+    else
+        fQuantization.erase(axis);
+}
+
+void VariationCache::purgeAll() {
+    SkAutoMutexExclusive lock(fMutex);
+    purgeLocked(0);
+}
+
+VariationCache::Stats VariationCache::getStats() const {
+    SkAutoMutexExclusive lock(fMutex);
+    return { fHits, fMisses, fEvictions, static_cast<int32_t>(fEntries.size()), fCapacity };
+}
+
+void VariationCache::purgeLocked(size_t targetCount) {
+    while (fEntries.size() > targetCount) {
+        fIndex.erase(fEntries.back().fKey);
+        fEntries.pop_back();
+        fEvictions++;
+    }
+}
@@ -0,0 +1,164 @@
+#include "ImageCache.hh"
+#include "SkBitmap.h"
+#include "SkSamplingOptions.h"
+#include "src/core/SkOpts.h"
+
+size_t ImageCache::KeyHash::operator()(const Key& key) const {
+    size_t h = key.fHash;
+    h = h * 31 + key.fLength;
+    h = h * 31 + static_cast<size_t>(key.fWidth);
+    h = h * 31 + static_cast<size_t>(key.fHeight);
+    h = h * 31 + static_cast<size_t>(key.fColorType);
+    return h;
+}
+
+ImageCache::ImageCache(size_t byteBudget)
+    : fBytesUsed(0)
+    , fByteBudget(byteBudget)
+    , fHits(0)
+    , fMisses(0)
+    , fEvictions(0)
+    , fGenerationID(1)
+{
+}
+
+sk_sp<SkImage> ImageCache::findOrDecode(sk_sp<SkData> encoded, int width, int height, SkColorType colorType) {
+    if (!encoded || encoded->size() == 0)
+        return nullptr;
+
+    Key key {
+        SkOpts::hash(encoded->data(), encoded->size(), 0),
+        encoded->size(),
+        width > 0 ? width : 0,
+        height > 0 ? height : 0,
+        colorType == kUnknown_SkColorType ? kN32_SkColorType : colorType
+    };
+
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        auto it = findLocked(key, encoded.get());
+        if (it != fEntries.end()) {
+            fHits++;
+            fEntries.splice(fEntries.begin(), fEntries, it);
+            return it->fImage;
+        }
+        fMisses++;
+    }
+
+    // Decode outside of the lock so that other threads are not blocked by a slow decoder
+    sk_sp<SkImage> image = decode(encoded, key.fWidth, key.fHeight, key.fColorType);
+    if (!image)
+        return nullptr;
+
+    size_t bytes = image->imageInfo().computeMinByteSize() + encoded->size();
+
+    SkAutoMutexExclusive lock(fMutex);
+    // Another thread might have decoded the same image in the meantime
+    auto it = findLocked(key, encoded.get());
+    if (it != fEntries.end()) {
+        fEntries.splice(fEntries.begin(), fEntries, it);
+        return it->fImage;
+    }
+
+    // Images that don't fit into the budget at all are returned without being cached
+    if (bytes > fByteBudget)
+        return image;
+
+    fEntries.push_front({ key, std::move(encoded), image, bytes });
+    fIndex.emplace(key, fEntries.begin());
+    fBytesUsed += bytes;
+    purgeLocked(fByteBudget);
+    return image;
+}
+
+void ImageCache::setByteBudget(size_t byteBudget) {
+    SkAutoMutexExclusive lock(fMutex);
+    fByteBudget = byteBudget;
+    purgeLocked(fByteBudget);
+}
+
+size_t ImageCache::getByteBudget() const {
+    SkAutoMutexExclusive lock(fMutex);
+    return fByteBudget;
+}
+
+void ImageCache::purgeToBytes(size_t targetBytes) {
+    SkAutoMutexExclusive lock(fMutex);
+    purgeLocked(targetBytes);
+}
+
+void ImageCache::purgeAll() {
+    SkAutoMutexExclusive lock(fMutex);
+    purgeLocked(0);
+    fGenerationID++;
+}
+
+void ImageCache::onMemoryPressure(bool critical) {
+    if (critical) {
+        purgeAll();
+    } else {
+        SkAutoMutexExclusive lock(fMutex);
+        purgeLocked(fBytesUsed / 2);
+    }
+}
+
+ImageCache::Stats ImageCache::getStats() const {
+    SkAutoMutexExclusive lock(fMutex);
+    return { fHits, fMisses, fEvictions, static_cast<int32_t>(fEntries.size()), fBytesUsed, fByteBudget, fGenerationID };
+}
+
+void ImageCache::resetStats() {
+    SkAutoMutexExclusive lock(fMutex);
+    fHits = 0;
+    fMisses = 0;
+    fEvictions = 0;
+}
+
+ImageCache::EntryList::iterator ImageCache::findLocked(const Key& key, const SkData* encoded) {
+    auto range = fIndex.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        // Hash collisions are resolved by comparing the actual bytes
+        if (it->second->fEncoded->equals(encoded))
+            return it->second;
+    }
+    return fEntries.end();
+}
+
+void ImageCache::purgeLocked(size_t targetBytes) {
+    while (fBytesUsed > targetBytes && !fEntries.empty()) {
+        Entry& last = fEntries.back();
+        auto range = fIndex.equal_range(last.fKey);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (&*it->second == &last) {
+                fIndex.erase(it);
+                break;
+            }
+        }
+        fBytesUsed -= last.fBytes;
+        fEvictions++;
+        fEntries.pop_back();
+    }
+}
+
+sk_sp<SkImage> ImageCache::decode(const sk_sp<SkData>& encoded, int width, int height, SkColorType colorType) {
+    sk_sp<SkImage> lazy = SkImage::MakeFromEncoded(encoded);
+    if (!lazy)
+        return nullptr;
+
+    SkImageInfo info = lazy->imageInfo()
+        .makeWH(width > 0 ? width : lazy->width(), height > 0 ? height : lazy->height())
+        .makeColorType(colorType);
+
+    SkBitmap bitmap;
+    if (!bitmap.tryAllocPixels(info))
+        return nullptr;
+
+    bool success = info.dimensions() == lazy->dimensions()
+        ? lazy->readPixels(bitmap.pixmap(), 0, 0, SkImage::kDisallow_CachingHint)
+        : lazy->scalePixels(bitmap.pixmap(), SkSamplingOptions(SkFilterMode::kLinear, SkMipmapMode::kNone), SkImage::kDisallow_CachingHint);
+    if (!success)
+        return nullptr;
+
+    bitmap.setImmutable();
+    return SkImage::MakeFromBitmap(bitmap);
+}
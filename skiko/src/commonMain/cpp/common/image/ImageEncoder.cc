@@ -0,0 +1,267 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "ImageEncoder.hh"
+#include "Parallel.hh"
+#include "SkBitmap.h"
+#include "SkColorSpace.h"
+#include "SkImageEncoder.h"
+#include "third_party/externals/zlib/zlib.h"
+
+namespace skikoMpp {
+    namespace encoder {
+        namespace {
+            // Bands are sized so that every worker has enough rows to amortize zlib setup,
+            // while the number of bands in flight bounds the memory used by the encoder.
+            const int kMinBandRows = 16;
+            const size_t kTargetBandBytes = 512 * 1024;
+
+            struct Band {
+                // "IDAT" tag followed by the chunk data, so that CRC can be computed in one pass
+                std::vector<uint8_t> fChunk;
+                uint32_t fCrc;
+                uint32_t fAdler;
+                size_t fRawLength;
+                bool fSuccess;
+            };
+
+            void writeU32(uint8_t* dst, uint32_t value) {
+                dst[0] = static_cast<uint8_t>(value >> 24);
+                dst[1] = static_cast<uint8_t>(value >> 16);
+                dst[2] = static_cast<uint8_t>(value >> 8);
+                dst[3] = static_cast<uint8_t>(value);
+            }
+
+            bool writeChunk(SkWStream* dst, const uint8_t* tagAndData, size_t dataLength, uint32_t crc) {
+                uint8_t length[4];
+                uint8_t crcBytes[4];
+                writeU32(length, static_cast<uint32_t>(dataLength));
+                writeU32(crcBytes, crc);
+                return dst->write(length, 4)
+                    && dst->write(tagAndData, dataLength + 4)
+                    && dst->write(crcBytes, 4);
+            }
+
+            bool writeChunk(SkWStream* dst, const char* tag, const uint8_t* data, size_t dataLength) {
+                std::vector<uint8_t> chunk(dataLength + 4);
+                memcpy(chunk.data(), tag, 4);
+                if (dataLength > 0)
+                    memcpy(chunk.data() + 4, data, dataLength);
+                uint32_t crc = crc32(0, chunk.data(), static_cast<uInt>(chunk.size()));
+                return writeChunk(dst, chunk.data(), dataLength, crc);
+            }
+
+            inline uint8_t paethPredictor(int a, int b, int c) {
+                int p = a + b - c;
+                int pa = std::abs(p - a);
+                int pb = std::abs(p - b);
+                int pc = std::abs(p - c);
+                if (pa <= pb && pa <= pc)
+                    return static_cast<uint8_t>(a);
+                return static_cast<uint8_t>(pb <= pc ? b : c);
+            }
+
+            void applyFilter(int filter, const uint8_t* row, const uint8_t* prev, size_t rowBytes, int bpp, uint8_t* out) {
+                for (size_t x = 0; x < rowBytes; ++x) {
+                    int a = x >= static_cast<size_t>(bpp) ? row[x - bpp] : 0;
+                    int b = prev ? prev[x] : 0;
+                    int c = prev && x >= static_cast<size_t>(bpp) ? prev[x - bpp] : 0;
+                    int predicted;
+                    switch (filter) {
+                        case 1:  predicted = a; break;
+                        case 2:  predicted = b; break;
+                        case 3:  predicted = (a + b) >> 1; break;
+                        case 4:  predicted = paethPredictor(a, b, c); break;
+                        default: predicted = 0; break;
+                    }
+                    out[x] = static_cast<uint8_t>(row[x] - predicted);
+                }
+            }
+
+            uint64_t filterCost(const uint8_t* filtered, size_t rowBytes) {
+                uint64_t cost = 0;
+                for (size_t x = 0; x < rowBytes; ++x)
+                    cost += std::abs(static_cast<int8_t>(filtered[x]));
+                return cost;
+            }
+
+            // Writes the filter type byte followed by the filtered row into out.
+            // Default preset picks the filter with the minimal sum of absolute differences,
+            // the same heuristic libpng uses.
+            void filterRow(const uint8_t* row, const uint8_t* prev, size_t rowBytes, int bpp, Preset preset,
+                           uint8_t* out, std::vector<uint8_t>& scratch) {
+                if (preset == Preset::kFast) {
+                    out[0] = 1;
+                    applyFilter(1, row, prev, rowBytes, bpp, out + 1);
+                    return;
+                }
+
+                int bestFilter = 0;
+                uint64_t bestCost = UINT64_MAX;
+                for (int filter = 0; filter < 5; ++filter) {
+                    uint8_t* candidate = scratch.data() + filter * rowBytes;
+                    applyFilter(filter, row, prev, rowBytes, bpp, candidate);
+                    uint64_t cost = filterCost(candidate, rowBytes);
+                    if (cost < bestCost) {
+                        bestCost = cost;
+                        bestFilter = filter;
+                    }
+                }
+                out[0] = static_cast<uint8_t>(bestFilter);
+                memcpy(out + 1, scratch.data() + bestFilter * rowBytes, rowBytes);
+            }
+
+            void encodeBand(const SkPixmap& src, sk_sp<SkColorSpace> colorSpace, int y0, int y1, int bpp,
+                            Preset preset, bool isFirst, bool isLast, Band* band) {
+                band->fSuccess = false;
+
+                int width = src.width();
+                size_t rowBytes = static_cast<size_t>(width) * bpp;
+                // Filters need the unfiltered previous row, which belongs to the previous band
+                int readY = y0 > 0 ? y0 - 1 : y0;
+                int readRows = y1 - readY;
+
+                SkImageInfo rgbaInfo = SkImageInfo::Make(width, readRows, kRGBA_8888_SkColorType,
+                                                         bpp == 3 ? kOpaque_SkAlphaType : kUnpremul_SkAlphaType,
+                                                         colorSpace);
+                std::vector<uint8_t> pixels(rgbaInfo.computeMinByteSize());
+                if (!src.readPixels(rgbaInfo, pixels.data(), rgbaInfo.minRowBytes(), 0, readY))
+                    return;
+
+                if (bpp == 3) {
+                    // Drop alpha in place, destination never overtakes source
+                    size_t count = static_cast<size_t>(width) * readRows;
+                    for (size_t i = 0; i < count; ++i) {
+                        pixels[i * 3 + 0] = pixels[i * 4 + 0];
+                        pixels[i * 3 + 1] = pixels[i * 4 + 1];
+                        pixels[i * 3 + 2] = pixels[i * 4 + 2];
+                    }
+                }
+
+                int rows = y1 - y0;
+                std::vector<uint8_t> filtered(rows * (rowBytes + 1));
+                std::vector<uint8_t> scratch(preset == Preset::kFast ? 0 : rowBytes * 5);
+                for (int y = y0; y < y1; ++y) {
+                    const uint8_t* row = pixels.data() + (y - readY) * rowBytes;
+                    const uint8_t* prev = y > 0 ? row - rowBytes : nullptr;
+                    filterRow(row, prev, rowBytes, bpp, preset, filtered.data() + (y - y0) * (rowBytes + 1), scratch);
+                }
+
+                band->fRawLength = filtered.size();
+                band->fAdler = adler32(adler32(0, nullptr, 0), filtered.data(), static_cast<uInt>(filtered.size()));
+
+                z_stream stream;
+                memset(&stream, 0, sizeof(stream));
+                int level = preset == Preset::kFast ? 1 : 6;
+                // Raw deflate: zlib header and Adler-32 trailer are written by encodePng for the whole image
+                if (deflateInit2(&stream, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+                    return;
+
+                size_t headerSize = isFirst ? 2 : 0;
+                // deflateBound doesn't account for the empty stored block emitted by Z_SYNC_FLUSH
+                size_t bound = deflateBound(&stream, static_cast<uLong>(filtered.size())) + 16;
+                band->fChunk.resize(4 + headerSize + bound);
+                memcpy(band->fChunk.data(), "IDAT", 4);
+                if (isFirst) {
+                    uint8_t cmf = 0x78;
+                    uint8_t flg = preset == Preset::kFast ? 0x00 : 0x80;
+                    flg += 31 - ((cmf * 256 + flg) % 31);
+                    band->fChunk[4] = cmf;
+                    band->fChunk[5] = flg;
+                }
+
+                stream.next_in = filtered.data();
+                stream.avail_in = static_cast<uInt>(filtered.size());
+                stream.next_out = band->fChunk.data() + 4 + headerSize;
+                stream.avail_out = static_cast<uInt>(bound);
+                // Every band but the last ends on a byte boundary without the final block bit,
+                // so compressed bands can be concatenated into a single deflate stream
+                int result = deflate(&stream, isLast ? Z_FINISH : Z_SYNC_FLUSH);
+                bool complete = isLast ? result == Z_STREAM_END : (result == Z_OK && stream.avail_in == 0 && stream.avail_out > 0);
+                size_t compressed = bound - stream.avail_out;
+                deflateEnd(&stream);
+                if (!complete)
+                    return;
+
+                band->fChunk.resize(4 + headerSize + compressed);
+                band->fCrc = crc32(0, band->fChunk.data(), static_cast<uInt>(band->fChunk.size()));
+                band->fSuccess = true;
+            }
+        }
+
+        bool encodePng(SkWStream* dst, const SkPixmap& src, Preset preset) {
+            if (dst == nullptr || src.addr() == nullptr || src.width() <= 0 || src.height() <= 0)
+                return false;
+
+            int width = src.width();
+            int height = src.height();
+            int bpp = src.isOpaque() ? 3 : 4;
+            size_t rowBytes = static_cast<size_t>(width) * bpp;
+            sk_sp<SkColorSpace> colorSpace = src.colorSpace() ? SkColorSpace::MakeSRGB() : nullptr;
+
+            static const uint8_t kSignature[] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+            uint8_t header[13];
+            writeU32(header, width);
+            writeU32(header + 4, height);
+            header[8] = 8;                // bit depth
+            header[9] = bpp == 3 ? 2 : 6; // RGB or RGBA
+            header[10] = 0;               // deflate
+            header[11] = 0;               // adaptive filtering
+            header[12] = 0;               // no interlace
+            if (!dst->write(kSignature, sizeof(kSignature)) || !writeChunk(dst, "IHDR", header, sizeof(header)))
+                return false;
+            if (colorSpace) {
+                uint8_t renderingIntent = 0;
+                if (!writeChunk(dst, "sRGB", &renderingIntent, 1))
+                    return false;
+            }
+
+            int bandRows = std::max(kMinBandRows, static_cast<int>(kTargetBandBytes / (rowBytes + 1)));
+            int bandCount = (height + bandRows - 1) / bandRows;
+            int bandsInFlight = parallel::threadCount() * 2;
+            uint32_t adler = adler32(0, nullptr, 0);
+
+            for (int firstBand = 0; firstBand < bandCount; firstBand += bandsInFlight) {
+                int count = std::min(bandsInFlight, bandCount - firstBand);
+                std::vector<Band> bands(count);
+                parallel::forEach(count, [&](int i) {
+                    int index = firstBand + i;
+                    int y0 = index * bandRows;
+                    int y1 = std::min(height, y0 + bandRows);
+                    encodeBand(src, colorSpace, y0, y1, bpp, preset, index == 0, index == bandCount - 1, &bands[i]);
+                });
+
+                for (const Band& band : bands) {
+                    if (!band.fSuccess)
+                        return false;
+                    adler = adler32_combine(adler, band.fAdler, static_cast<z_off_t>(band.fRawLength));
+                    if (!writeChunk(dst, band.fChunk.data(), band.fChunk.size() - 4, band.fCrc))
+                        return false;
+                }
+            }
+
+            uint8_t trailer[4];
+            writeU32(trailer, adler);
+            if (!writeChunk(dst, "IDAT", trailer, sizeof(trailer)) || !writeChunk(dst, "IEND", nullptr, 0))
+                return false;
+            dst->flush();
+            return true;
+        }
+
+        bool encode(SkWStream* dst, SkImage* image, SkEncodedImageFormat format, int quality, Preset preset) {
+            SkPixmap pixmap;
+            SkBitmap bitmap;
+            if (!image->peekPixels(&pixmap)) {
+                if (!bitmap.tryAllocPixels(image->imageInfo()) || !image->readPixels(bitmap.pixmap(), 0, 0))
+                    return false;
+                pixmap = bitmap.pixmap();
+            }
+
+            if (format == SkEncodedImageFormat::kPNG)
+                return encodePng(dst, pixmap, preset);
+            return SkEncodeImage(dst, pixmap, format, quality);
+        }
+    }
+}
@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include "Parallel.hh"
+#include "PixelConverter.hh"
+#include "SkColorSpace.h"
+#include "src/core/SkOpts.h"
+
+namespace skikoMpp {
+    namespace pixels {
+        namespace {
+            // Bands smaller than this are not worth a task switch
+            const size_t kMinBandBytes = 256 * 1024;
+
+            typedef void (*RowProc)(uint32_t* dst, const uint32_t* src, int count);
+
+            void copyRow(uint32_t* dst, const uint32_t* src, int count) {
+                memcpy(dst, src, count * sizeof(uint32_t));
+            }
+
+            bool is8888(SkColorType colorType) {
+                return colorType == kRGBA_8888_SkColorType || colorType == kBGRA_8888_SkColorType;
+            }
+
+            // Returns a SIMD row kernel for 8888 -> 8888 conversions, or nullptr if there's none
+            RowProc find8888Proc(const SkImageInfo& src, const SkImageInfo& dst) {
+                if (!is8888(src.colorType()) || !is8888(dst.colorType()))
+                    return nullptr;
+                if (!SkColorSpace::Equals(src.colorSpace(), dst.colorSpace()))
+                    return nullptr;
+
+                SkAlphaType srcAlpha = src.alphaType();
+                SkAlphaType dstAlpha = dst.alphaType();
+                if (srcAlpha == kUnknown_SkAlphaType || dstAlpha == kUnknown_SkAlphaType)
+                    return nullptr;
+                // Opaque pixels are the same in every alpha type, but writing into
+                // an opaque destination requires forcing alpha to 1
+                if (dstAlpha == kOpaque_SkAlphaType && srcAlpha != kOpaque_SkAlphaType)
+                    return nullptr;
+                if (srcAlpha == kOpaque_SkAlphaType)
+                    dstAlpha = kOpaque_SkAlphaType;
+
+                bool swap = src.colorType() != dst.colorType();
+                if (srcAlpha == dstAlpha)
+                    return swap ? SkOpts::RGBA_to_BGRA : copyRow;
+                if (srcAlpha == kUnpremul_SkAlphaType)
+                    return swap ? SkOpts::RGBA_to_bgrA : SkOpts::RGBA_to_rgbA;
+                return swap ? SkOpts::rgbA_to_BGRA : SkOpts::rgbA_to_RGBA;
+            }
+
+            bool convertRows(const SkPixmap& src, const SkPixmap& dst, RowProc proc, int y0, int y1) {
+                if (proc) {
+                    for (int y = y0; y < y1; ++y)
+                        proc(dst.writable_addr32(0, y), src.addr32(0, y), src.width());
+                    return true;
+                }
+                SkIRect band = SkIRect::MakeLTRB(0, y0, src.width(), y1);
+                SkPixmap srcBand, dstBand;
+                return src.extractSubset(&srcBand, band)
+                    && dst.extractSubset(&dstBand, band)
+                    && srcBand.readPixels(dstBand);
+            }
+        }
+
+        bool convert(const SkPixmap& src, const SkPixmap& dst) {
+            if (src.addr() == nullptr || dst.addr() == nullptr)
+                return false;
+            if (src.width() != dst.width() || src.height() != dst.height())
+                return false;
+            if (src.width() <= 0 || src.height() <= 0)
+                return false;
+
+            SkOpts::Init();
+            RowProc proc = find8888Proc(src.info(), dst.info());
+
+            size_t rowBytes = std::max(src.info().minRowBytes(), dst.info().minRowBytes());
+            int height = src.height();
+            int bandRows = std::max(1, static_cast<int>(kMinBandBytes / rowBytes));
+            int bandCount = std::min((height + bandRows - 1) / bandRows, parallel::threadCount() * 4);
+            if (bandCount <= 1)
+                return convertRows(src, dst, proc, 0, height);
+
+            bandRows = (height + bandCount - 1) / bandCount;
+            bandCount = (height + bandRows - 1) / bandRows;
+            std::vector<char> results(bandCount, false);
+            parallel::forEach(bandCount, [&](int i) {
+                int y0 = i * bandRows;
+                int y1 = std::min(height, y0 + bandRows);
+                results[i] = convertRows(src, dst, proc, y0, y1);
+            });
+            return std::all_of(results.begin(), results.end(), [](char result) { return result; });
+        }
+    }
+}
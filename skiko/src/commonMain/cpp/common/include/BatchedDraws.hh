@@ -0,0 +1,44 @@
+#pragma once
+#include "SkCanvas.h"
+#include "SkColor.h"
+#include "SkFont.h"
+#include "SkPaint.h"
+#include "SkTextBlob.h"
+
+namespace skikoMpp {
+    namespace batch {
+        /**
+         * Draws count rects packed as (left, top, right, bottom) with the same paint.
+         * If colors is not null, item i is drawn with paint color replaced by colors[i].
+         *
+         * On canvases without raster pixels (GPU, picture recording), 64 or more rects filled
+         * without antialiasing, shader, color filter or other effects are tessellated into a few
+         * drawVertices calls instead, which turns tens of thousands of ops into a handful.
+         * Colors may be translucent, paint alpha must be opaque when colors are given.
+         */
+        void drawRects(SkCanvas* canvas, const float* ltrb, const SkColor* colors, int count, const SkPaint& paint);
+
+        /**
+         * Draws count round rects packed as (left, top, right, bottom, radiusX, radiusY).
+         * Colors work as in drawRects.
+         */
+        void drawRRects(SkCanvas* canvas, const float* rrects, const SkColor* colors, int count, const SkPaint& paint);
+
+        /**
+         * Draws count circles packed as (centerX, centerY, radius).
+         * Colors work as in drawRects.
+         */
+        void drawCircles(SkCanvas* canvas, const float* circles, const SkColor* colors, int count, const SkPaint& paint);
+
+        /**
+         * Packs runCount positioned glyph runs with the same font into a single text blob.
+         * Run i covers glyphs [runOffsets[i], runOffsets[i + 1]), the last run ends at glyphCount.
+         * positions holds (x, y) per glyph relative to the run origin (x, y) in origins.
+         *
+         * Only copies data, so JNI callers can build the blob while arrays are pinned and draw it
+         * after releasing them. Returns null if there are no glyphs.
+         */
+        sk_sp<SkTextBlob> makeGlyphRuns(const SkFont& font, const SkGlyphID* glyphs, const float* positions,
+                                        int glyphCount, const int* runOffsets, const float* origins, int runCount);
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "SkFontMgr.h"
+#include "SkFontStyle.h"
+#include "SkString.h"
+#include "SkTypeface.h"
+#include "include/private/SkOnce.h"
+#include "src/core/SkSharedMutex.h"
+
+// Font manager that answers family enumeration and matching for another manager from memory.
+//
+// Family names and styles are read from the wrapped manager once, on first use, or taken from
+// a snapshot written by an earlier run if fontconfig caches haven't changed since. Results of
+// matchFamilyStyle and matchFamilyStyleCharacter are remembered per exact arguments, so every
+// answer is the one the wrapped manager gave for them. Typefaces of style sets are created by
+// the wrapped manager's style set, which tells apart faces with the same style.
+//
+// Any number of threads can read at the same time, they only wait for each other while a new
+// result is stored.
+class FontIndex : public SkFontMgr {
+public:
+    // Index of SkFontMgr::RefDefault(), shared by the whole process
+    static sk_sp<FontIndex> Default();
+
+    explicit FontIndex(sk_sp<SkFontMgr> base);
+
+    // Takes family names and styles from file instead of the wrapped manager. Fails if the
+    // index is built already or file was written with different fontconfig caches.
+    bool load(const char* path);
+
+    // Writes family names and styles to a temporary file and renames it over path
+    bool save(const char* path) const;
+
+protected:
+    int onCountFamilies() const override;
+    void onGetFamilyName(int index, SkString* familyName) const override;
+    SkFontStyleSet* onCreateStyleSet(int index) const override;
+    SkFontStyleSet* onMatchFamily(const char familyName[]) const override;
+    SkTypeface* onMatchFamilyStyle(const char familyName[], const SkFontStyle& style) const override;
+    SkTypeface* onMatchFamilyStyleCharacter(const char familyName[], const SkFontStyle& style,
+                                            const char* bcp47[], int bcp47Count,
+                                            SkUnichar character) const override;
+    sk_sp<SkTypeface> onMakeFromData(sk_sp<SkData> data, int ttcIndex) const override;
+    sk_sp<SkTypeface> onMakeFromStreamIndex(std::unique_ptr<SkStreamAsset> stream, int ttcIndex) const override;
+    sk_sp<SkTypeface> onMakeFromStreamArgs(std::unique_ptr<SkStreamAsset> stream,
+                                           const SkFontArguments& args) const override;
+    sk_sp<SkTypeface> onMakeFromFile(const char path[], int ttcIndex) const override;
+    sk_sp<SkTypeface> onLegacyMakeTypeface(const char familyName[], SkFontStyle style) const override;
+
+private:
+    struct Family {
+        SkString fName;
+        std::vector<SkFontStyle> fStyles;
+        std::vector<SkString> fStyleNames;
+    };
+
+    class StyleSet;
+
+    // Builds the index on first call, immutable afterwards
+    const std::vector<Family>& families() const;
+    void build() const;
+    void addFamilies(std::vector<Family> families) const;
+
+    // Changes whenever fontconfig caches are updated, 0 if there are none
+    static int64_t SnapshotKey();
+
+    sk_sp<SkFontMgr> fBase;
+    mutable SkOnce fBuilt;
+    mutable std::vector<Family> fFamilies;
+    mutable std::unordered_map<std::string, int> fFamilyIndices;
+
+    mutable SkSharedMutex fMutex;
+    mutable std::unordered_map<std::string, sk_sp<SkTypeface>> fMatches;
+    mutable std::unordered_map<std::string, sk_sp<SkTypeface>> fCharacterMatches;
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include "SkShaper.h"
+#include "TypefaceCoverage.hh"
 #include "unicode/ubrk.h"
 #include "unicode/utext.h"
 
@@ -31,6 +32,7 @@ public:
     {
         fFont.setTypeface(font.refTypefaceOrDefault());
         fFallbackFont.setTypeface(nullptr);
+        fFontCoverage = TypefaceCoverage::Get(fFont.getTypeface());
     }
 
     FontRunIterator(const char* utf8,
@@ -70,6 +72,10 @@ public:
     }
 
 private:
+    const TypefaceCoverage& currentCoverage() const {
+        return fCurrentFont == &fFont ? *fFontCoverage : *fFallbackCoverage;
+    }
+
     char const * fCurrent;
     char const * const fBegin;
     char const * const fEnd;
@@ -77,6 +83,8 @@ private:
     SkFont fFont;
     SkFont fFallbackFont;
     SkFont* fCurrentFont;
+    std::shared_ptr<const TypefaceCoverage> fFontCoverage;
+    std::shared_ptr<const TypefaceCoverage> fFallbackCoverage;
     char const * const fRequestName;
     SkFontStyle const fRequestStyle;
     SkShaper::LanguageRunIterator const * const fLanguage;
@@ -0,0 +1,42 @@
+#pragma once
+#include <memory>
+#include "SkCanvas.h"
+#include "SkData.h"
+#include "SkPicture.h"
+#include "SkPictureRecorder.h"
+#include "SkRect.h"
+#include "include/utils/SkNWayCanvas.h"
+
+// Captures the draw stream of a frame for offline replay.
+//
+// While capturing, drawing goes through a tee canvas that forwards every op both to the target
+// canvas and to a picture recorder, so the frame is rendered as usual and recorded at the same
+// time. Serialize() embeds everything the picture references, so the capture can be replayed
+// on another machine.
+//
+// Not thread safe.
+class FrameCapture {
+public:
+    FrameCapture();
+
+    // Starts capturing, returns canvas valid until finishCapture(). Target canvas may be null
+    // to record without drawing; otherwise it must outlive the capture. Bounds are in target
+    // canvas local coordinates.
+    SkCanvas* beginCapture(SkCanvas* target, const SkRect& bounds);
+
+    // Stops capturing and restores target canvas matrix and clip to the state before
+    // beginCapture(). Returns null if capture was not started.
+    sk_sp<SkPicture> finishCapture();
+
+    bool isCapturing() const { return fTee != nullptr; }
+
+    // Serializes picture with typeface data and encoded images embedded. Texture-backed images
+    // are read back to CPU memory.
+    static sk_sp<SkData> Serialize(const SkPicture* picture);
+
+private:
+    SkPictureRecorder fRecorder;
+    std::unique_ptr<SkNWayCanvas> fTee;
+    SkCanvas* fTarget;
+    int fTargetSaveCount;
+};
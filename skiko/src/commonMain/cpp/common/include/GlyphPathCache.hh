@@ -0,0 +1,94 @@
+#pragma once
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include "SkFont.h"
+#include "SkPath.h"
+#include "include/private/SkMutex.h"
+
+// Process-wide LRU cache of glyph outlines.
+//
+// Outlines are keyed by everything that changes them: typeface unique ID, size, scale, skew,
+// fake bold and glyph ID. Cached SkPaths share their point data with every copy handed out
+// (SkPath is copy-on-write), so a hit costs a reference count increment. All methods are
+// safe to call from any thread.
+class GlyphPathCache {
+public:
+    struct Stats {
+        int32_t fHits;
+        int32_t fMisses;
+        int32_t fEvictions;
+        int32_t fCount;
+        size_t  fBytesUsed;
+        size_t  fByteBudget;
+    };
+
+    static const size_t kDefaultByteBudget = 8 * 1024 * 1024;
+
+    static GlyphPathCache& Get();
+
+    // Outline of glyphs[i] goes to paths[i], hasPath[i] is false for glyphs without outline.
+    // Misses are extracted in parallel when there are enough of them and parallel is true.
+    void getPaths(const SkFont& font, const SkGlyphID* glyphs, int count, bool parallel,
+                  std::vector<SkPath>* paths, std::vector<bool>* hasPath);
+
+    // Appends outlines of all glyphs to dst, each offset by (positions[i * 2], positions[i * 2 + 1])
+    // if positions are not null. verbOffsets[i] receives index of the first verb of glyph i in dst,
+    // verbOffsets[count] receives total verb count; it must have count + 1 elements.
+    void getCombinedPath(const SkFont& font, const SkGlyphID* glyphs, int count, const float* positions,
+                         bool parallel, SkPath* dst, int* verbOffsets);
+
+    void setByteBudget(size_t byteBudget);
+
+    void purgeAll();
+
+    Stats getStats() const;
+
+    void resetStats();
+
+private:
+    GlyphPathCache();
+
+    struct Key {
+        uint32_t  fTypefaceID;
+        float     fSize;
+        float     fScaleX;
+        float     fSkewX;
+        bool      fEmbolden;
+        SkGlyphID fGlyph;
+
+        bool operator==(const Key& other) const {
+            return fTypefaceID == other.fTypefaceID && fSize == other.fSize
+                && fScaleX == other.fScaleX && fSkewX == other.fSkewX
+                && fEmbolden == other.fEmbolden && fGlyph == other.fGlyph;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry {
+        Key    fKey;
+        SkPath fPath;
+        bool   fHasPath;
+        size_t fBytes;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    static Key MakeKey(const SkFont& font, SkGlyphID glyph);
+    static void Extract(const SkFont& font, const SkGlyphID* glyphs, int count, SkPath* paths, bool* hasPath);
+
+    void purgeLocked(size_t targetBytes);
+
+    mutable SkMutex fMutex;
+    // Front is the most recently used entry
+    EntryList fEntries;
+    std::unordered_map<Key, EntryList::iterator, KeyHash> fIndex;
+    size_t fBytesUsed;
+    size_t fByteBudget;
+    int32_t fHits;
+    int32_t fMisses;
+    int32_t fEvictions;
+};
@@ -0,0 +1,98 @@
+#pragma once
+#include <list>
+#include <unordered_map>
+#include "SkData.h"
+#include "SkImage.h"
+#include "SkImageInfo.h"
+#include "SkRefCnt.h"
+#include "include/private/SkMutex.h"
+
+// LRU cache of decoded raster images.
+//
+// Entries are keyed by the content hash of the encoded bytes together with the requested
+// dimensions and color type, so loading the same resource twice yields the same SkImage
+// instead of decoding it again. All public methods are safe to call from any thread.
+class ImageCache : public SkRefCnt {
+public:
+    struct Stats {
+        int32_t fHits;
+        int32_t fMisses;
+        int32_t fEvictions;
+        int32_t fCount;
+        size_t  fBytesUsed;
+        size_t  fByteBudget;
+        int32_t fGenerationID;
+    };
+
+    explicit ImageCache(size_t byteBudget);
+
+    ~ImageCache() override {}
+
+    /**
+     * Returns cached image for (encoded, width, height, colorType), decoding and caching it on miss.
+     * Width or height <= 0 means the encoded dimension, kUnknown_SkColorType means kN32_SkColorType.
+     * Returns nullptr if encoded data can't be decoded.
+     */
+    sk_sp<SkImage> findOrDecode(sk_sp<SkData> encoded, int width, int height, SkColorType colorType);
+
+    void setByteBudget(size_t byteBudget);
+
+    size_t getByteBudget() const;
+
+    /** Evicts least recently used entries until at most targetBytes are used. */
+    void purgeToBytes(size_t targetBytes);
+
+    /** Evicts all entries and starts a new generation. */
+    void purgeAll();
+
+    /** Memory pressure hook: halves usage on moderate pressure, drops everything when critical. */
+    void onMemoryPressure(bool critical);
+
+    Stats getStats() const;
+
+    void resetStats();
+
+private:
+    struct Key {
+        uint32_t    fHash;
+        size_t      fLength;
+        int         fWidth;
+        int         fHeight;
+        SkColorType fColorType;
+
+        bool operator==(const Key& other) const {
+            return fHash == other.fHash && fLength == other.fLength
+                && fWidth == other.fWidth && fHeight == other.fHeight
+                && fColorType == other.fColorType;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry {
+        Key            fKey;
+        sk_sp<SkData>  fEncoded;
+        sk_sp<SkImage> fImage;
+        size_t         fBytes;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    EntryList::iterator findLocked(const Key& key, const SkData* encoded);
+    void purgeLocked(size_t targetBytes);
+
+    static sk_sp<SkImage> decode(const sk_sp<SkData>& encoded, int width, int height, SkColorType colorType);
+
+    mutable SkMutex fMutex;
+    // Front is the most recently used entry
+    EntryList fEntries;
+    std::unordered_multimap<Key, EntryList::iterator, KeyHash> fIndex;
+    size_t fBytesUsed;
+    size_t fByteBudget;
+    int32_t fHits;
+    int32_t fMisses;
+    int32_t fEvictions;
+    int32_t fGenerationID;
+};
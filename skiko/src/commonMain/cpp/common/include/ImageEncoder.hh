@@ -0,0 +1,32 @@
+#pragma once
+#include "SkEncodedImageFormat.h"
+#include "SkImage.h"
+#include "SkPixmap.h"
+#include "SkStream.h"
+
+namespace skikoMpp {
+    namespace encoder {
+        enum class Preset {
+            // Comparable to SkImage::encodeToData: zlib level 6 and adaptive row filters
+            kDefault = 0,
+            // zlib level 1 and Sub filter only, trades size for speed
+            kFast = 1,
+        };
+
+        /**
+         * Encodes pixels as PNG into dst.
+         *
+         * Image is split into horizontal bands which are filtered and deflated independently
+         * on skikoMpp::parallel::executor(), then written to dst in order as separate IDAT chunks.
+         * Only a bounded number of bands is kept in memory, so no full-size encoded buffer is created.
+         * Writing into dst happens on the calling thread only.
+         */
+        bool encodePng(SkWStream* dst, const SkPixmap& src, Preset preset);
+
+        /**
+         * Encodes image into dst. PNG goes through encodePng, other formats are streamed
+         * with SkEncodeImage. Returns false if pixels can't be read or encoding fails.
+         */
+        bool encode(SkWStream* dst, SkImage* image, SkEncodedImageFormat format, int quality, Preset preset);
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include "FontCollection.h"
+#include "Paragraph.h"
+#include "ParagraphStyle.h"
+#include "SkCanvas.h"
+#include "SkString.h"
+
+// Paragraph for very long texts, e.g. logs, that only shapes and lays out as much
+// as has been asked for.
+//
+// Text is split into chunks at hard line breaks, and every chunk is a separate
+// skparagraph Paragraph that is built and laid out the first time a query reaches it.
+// Height of the rest is estimated from the chunks laid out so far. Text without hard
+// line breaks ends up in a single chunk and is laid out at once. Editing text only
+// reshapes the chunks it touches.
+//
+// All indices are in UTF-16 code units, same as in Paragraph. Not thread safe.
+class LazyParagraph {
+public:
+    LazyParagraph(SkString text, skia::textlayout::ParagraphStyle style,
+                  sk_sp<skia::textlayout::FontCollection> fontCollection);
+
+    // Drops laid out lines, keeping shaped chunks for the new width.
+    void layout(float width);
+
+    // Replaces UTF-16 range [from, to) with text. Chunks touching the range are split
+    // again and reshaped, other chunks keep their shaping and line breaks, and the laid
+    // out region is cut back to the first changed chunk.
+    void replaceText(uint32_t from, uint32_t to, const SkString& text);
+
+    // Extends laid out region until it covers y, or the line index, or everything.
+    void layoutUntil(float y);
+    void layoutUntilLine(int line);
+    void layoutAll();
+
+    bool isLaidOutCompletely() const { return fLaidOutCount == fChunks.size(); }
+    float laidOutHeight() const { return fLaidOutHeight; }
+    int laidOutLineCount() const { return fLaidOutLineCount; }
+    // Exact once laid out completely, estimated before that
+    float height();
+    float width() const { return fWidth; }
+
+    // Paints laid out lines intersecting [top, bottom) in paragraph coordinates,
+    // laying out until bottom first.
+    void paint(SkCanvas* canvas, float x, float y, float top, float bottom);
+
+    // Metrics of laid out lines only
+    void getLineMetrics(std::vector<skia::textlayout::LineMetrics>& metrics);
+
+    skia::textlayout::PositionWithAffinity getGlyphPositionAtCoordinate(float dx, float dy);
+
+private:
+    struct Chunk {
+        // Byte range in fText, separating line break excluded
+        size_t fStart8;
+        size_t fEnd8;
+        uint32_t fStart16;
+        uint32_t fLength16;
+        std::unique_ptr<skia::textlayout::Paragraph> fParagraph;
+        float fTop;
+        int fFirstLine;
+    };
+
+    // Chunks for byte range [start, end) of fText, first one starting at UTF-16 index start16
+    std::vector<Chunk> split(size_t start, size_t end, uint32_t start16) const;
+    size_t chunkIndexAt16(uint32_t i16) const;
+    bool layoutNext();
+    // Whether a line break separates chunk from the next one
+    bool hasSeparator(const Chunk& chunk) const { return chunk.fStart16 + chunk.fLength16 < fLength16; }
+    const Chunk* chunkAt(float y) const;
+
+    SkString fText;
+    skia::textlayout::ParagraphStyle fStyle;
+    sk_sp<skia::textlayout::FontCollection> fFontCollection;
+    std::vector<Chunk> fChunks;
+    float fWidth;
+    size_t fLaidOutCount;
+    float fLaidOutHeight;
+    int fLaidOutLineCount;
+    uint32_t fLaidOutLength16;
+    uint32_t fLength16;
+};
@@ -0,0 +1,87 @@
+#pragma once
+#include <chrono>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include "Paragraph.h"
+#include "ParagraphCache.h"
+#include "include/private/SkMutex.h"
+
+// Statistics and byte budget of a skparagraph ParagraphCache.
+//
+// ParagraphCache reports hits, misses and insertions through its checker callback only, and
+// can't drop single entries. The monitor mirrors the LRU order of the cache from those callbacks,
+// estimating entry sizes from shaped runs and clusters, and the time saved by a hit from the
+// time the entry took to shape. Entries are told apart by a hash of the same fields the cache
+// key compares. The budget is a full flush: when cached entries exceed it, the whole cache is
+// cleared after the next layout, not just its least recently used entries.
+//
+// Every FontCollection owns a separate ParagraphCache, so it has its own monitor and budget.
+class ParagraphCacheMonitor {
+public:
+    struct Stats {
+        int64_t fHits;
+        int64_t fMisses;
+        int64_t fEvictions;
+        int64_t fCount;
+        int64_t fBytesUsed;
+        int64_t fByteBudget;
+        int64_t fTimeSavedNanos;
+    };
+
+    // Zero means no byte budget, the cache then only keeps its own entry count limit
+    static const size_t kDefaultByteBudget = 0;
+
+    // Monitor of cache, attached on the first call. It lives as long as the cache does.
+    static std::shared_ptr<ParagraphCacheMonitor> Get(skia::textlayout::ParagraphCache* cache);
+
+    // Clears the cache paragraph was shaped with if it went over budget. Checker runs under
+    // the cache lock, so this has to be called after layout rather than from the checker.
+    static void EnforceBudget(skia::textlayout::Paragraph* paragraph);
+
+    ~ParagraphCacheMonitor();
+
+    void setByteBudget(size_t byteBudget);
+
+    Stats getStats() const;
+
+    void resetStats();
+
+    // Has to be called after ParagraphCache::reset and ParagraphCache::abandon
+    void onReset();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    explicit ParagraphCacheMonitor(skia::textlayout::ParagraphCache* cache);
+
+    struct Entry {
+        size_t  fHash;
+        size_t  fBytes;
+        int64_t fShapeNanos;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    static size_t Hash(skia::textlayout::ParagraphImpl* paragraph);
+    static size_t EstimateBytes(skia::textlayout::ParagraphImpl* paragraph);
+
+    void check(skia::textlayout::ParagraphImpl* paragraph, const char* event);
+    void evictLocked(EntryList::iterator it);
+    void trimIfOverBudget();
+
+    skia::textlayout::ParagraphCache* fCache;
+    mutable SkMutex fMutex;
+    // Front is the most recently used entry
+    EntryList fEntries;
+    std::unordered_map<size_t, EntryList::iterator> fIndex;
+    // Paragraphs that missed the cache and are being shaped
+    std::unordered_map<skia::textlayout::ParagraphImpl*, Clock::time_point> fShaping;
+    size_t fBytesUsed;
+    size_t fByteBudget;
+    bool fOverBudget;
+    int64_t fHits;
+    int64_t fMisses;
+    int64_t fEvictions;
+    int64_t fTimeSavedNanos;
+};
@@ -0,0 +1,18 @@
+#pragma once
+#include <memory>
+#include "Paragraph.h"
+#include "SkString.h"
+
+namespace skikoMpp {
+    namespace paragraph {
+        // Builds a new paragraph from scratch with UTF-16 range [from, to) of the text replaced
+        // by text, keeping the paragraph style, style blocks and placeholders. Nothing shaped
+        // is reused, this only saves replaying the builder, see LazyParagraph::replaceText for
+        // that. Inserted text continues the style of the character before it, placeholders
+        // inside the replaced range are dropped.
+        // The new text is written into newText.
+        std::unique_ptr<skia::textlayout::Paragraph> rebuildWithText(skia::textlayout::Paragraph* paragraph,
+                                                                     uint32_t from, uint32_t to, const SkString& text,
+                                                                     SkString* newText);
+    }
+}
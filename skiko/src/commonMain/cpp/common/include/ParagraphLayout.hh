@@ -0,0 +1,15 @@
+#pragma once
+#include "Paragraph.h"
+
+namespace skikoMpp {
+    namespace paragraph {
+        // Lays out paragraphs[i] to widths[i] on the shared worker pool.
+        //
+        // skparagraph's FontCollection caches typeface lookups without a lock, so before
+        // going parallel the typefaces of every text, strut and placeholder style, with its
+        // font arguments, are resolved on the calling thread. Shaping then only reads that
+        // cache, and ParagraphCache has its own mutex.
+        // Paragraphs must be distinct and must not be used by other threads meanwhile.
+        void layoutAll(skia::textlayout::Paragraph* const* paragraphs, const float* widths, int count);
+    }
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include <functional>
+#include "SkExecutor.h"
+
+namespace skikoMpp {
+    namespace parallel {
+        // Process-wide worker pool shared by all parallel algorithms.
+        // On Wasm there are no threads and tasks run inline on the calling thread.
+        SkExecutor& executor();
+
+        // Number of workers available in executor(), at least 1.
+        int threadCount();
+
+        // Runs fn(0) ... fn(count - 1) on the executor and waits for completion.
+        // The calling thread participates in the work while waiting.
+        void forEach(int count, std::function<void(int)> fn);
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include <vector>
+#include "SkBitmap.h"
+#include "SkPicture.h"
+#include "SkRect.h"
+#include "SkString.h"
+
+// Cost profile of a single raster playback of SkPicture.
+//
+// Picture is replayed through a canvas that forwards every op to a raster canvas and records
+// op type, device-space bounds and the time the op took. Nested pictures and drawables are
+// unrolled, so their ops are profiled individually. A second playback through SkOverdrawCanvas
+// produces a per-pixel count of how many times each pixel was drawn.
+class PictureProfile {
+public:
+    // Keep in sync with org.jetbrains.skia.PictureOpType
+    enum OpType {
+        kSave,
+        kSaveLayer,
+        kRestore,
+        kClipRect,
+        kClipRRect,
+        kClipPath,
+        kClipShader,
+        kClipRegion,
+        kDrawPaint,
+        kDrawBehind,
+        kDrawRect,
+        kDrawRRect,
+        kDrawDRRect,
+        kDrawOval,
+        kDrawArc,
+        kDrawPath,
+        kDrawRegion,
+        kDrawTextBlob,
+        kDrawPatch,
+        kDrawPoints,
+        kDrawImage,
+        kDrawImageRect,
+        kDrawImageLattice,
+        kDrawAtlas,
+        kDrawEdgeAAImageSet,
+        kDrawVertices,
+        kDrawAnnotation,
+        kDrawShadow,
+        kDrawDrawable,
+        kDrawPicture,
+        kDrawEdgeAAQuad,
+
+        kOpTypeCount
+    };
+
+    struct Op {
+        OpType  fType;
+        // Device-space bounds clipped to the current clip, empty if op was clipped out
+        SkIRect fBounds;
+        // Time spent in the raster canvas, 0 for nested pictures and drawables whose ops
+        // are profiled separately
+        int64_t fNanos;
+    };
+
+    PictureProfile(const SkPicture* picture, int width, int height);
+
+    static const char* OpName(OpType type);
+
+    int width() const { return fOverdraw.width(); }
+
+    int height() const { return fOverdraw.height(); }
+
+    const std::vector<Op>& ops() const { return fOps; }
+
+    int count(OpType type) const { return fCounts[type]; }
+
+    int64_t nanos(OpType type) const { return fNanos[type]; }
+
+    int64_t totalNanos() const;
+
+    // Alpha_8 bitmap, every pixel holds the number of draws touching it, saturated at 255
+    const SkBitmap& overdraw() const { return fOverdraw; }
+
+    int maxOverdraw() const { return fMaxOverdraw; }
+
+    double averageOverdraw() const { return fAverageOverdraw; }
+
+    // Writes the histogram, overdraw summary and, if includeOps is true, all ops as JSON
+    SkString toJson(bool includeOps) const;
+
+private:
+    std::vector<Op> fOps;
+    int fCounts[kOpTypeCount];
+    int64_t fNanos[kOpTypeCount];
+    SkBitmap fOverdraw;
+    int fMaxOverdraw;
+    double fAverageOverdraw;
+};
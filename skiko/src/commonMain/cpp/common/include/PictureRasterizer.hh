@@ -0,0 +1,24 @@
+#pragma once
+#include "SkMatrix.h"
+#include "SkPicture.h"
+#include "SkPixmap.h"
+
+namespace skikoMpp {
+    namespace picture {
+        // Tiles of this size keep a few hundred KB of N32 pixels hot in cache per worker
+        const int kDefaultTileSize = 256;
+
+        /**
+         * Draws picture into dst pixels, transformed by matrix (if not null).
+         *
+         * dst is split into tileSize x tileSize tiles, and every tile replays the whole picture
+         * into its own raster canvas, clipped to the tile and translated by the tile origin.
+         * Tiles are rendered on skikoMpp::parallel::executor() by at most maxThreads workers
+         * (all workers if maxThreads <= 0).
+         *
+         * Tile origins are kept multiples of 16 pixels, so that dithering and other device-space
+         * patterns line up, and the result is identical to drawing picture on a single canvas.
+         */
+        bool rasterizeTiled(const SkPicture* picture, const SkPixmap& dst, const SkMatrix* matrix, int tileSize, int maxThreads);
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <unordered_map>
+#include "SkData.h"
+#include "SkImage.h"
+#include "SkRefCnt.h"
+#include "SkSerialProcs.h"
+#include "SkTypeface.h"
+#include "include/private/SkMutex.h"
+
+// Side-store for typefaces and images referenced by serialized pictures.
+//
+// Serial procs returned by serialProcs() put every typeface and image into the store, keyed by
+// a 64-bit hash of its serialized content, and write only a short reference into the picture.
+// Pictures serialized against the same store share a single copy of each resource, and
+// deserial procs resolve references back, sharing decoded SkTypeface and SkImage instances
+// between all pictures read from the store. The store itself can be serialized and shipped
+// alongside the pictures.
+//
+// All public methods are safe to call from any thread; resources are serialized and decoded
+// outside of the lock.
+class PictureResourceStore : public SkRefCnt {
+public:
+    struct Stats {
+        int32_t fTypefaces;       // unique typefaces in the store
+        int32_t fImages;          // unique images in the store
+        int32_t fReferences;      // resource references written into pictures
+        size_t  fStoredBytes;     // size of unique resources
+        size_t  fReferencedBytes; // size of all referenced resources, as they'd be embedded otherwise
+    };
+
+    PictureResourceStore();
+
+    ~PictureResourceStore() override {}
+
+    // Reads store written by serialize(), returns null if data is malformed
+    static sk_sp<PictureResourceStore> MakeFromData(const SkData* data);
+
+    SkSerialProcs serialProcs();
+
+    SkDeserialProcs deserialProcs();
+
+    sk_sp<SkData> serialize() const;
+
+    Stats getStats() const;
+
+private:
+    struct Entry {
+        sk_sp<SkData>      fData;
+        sk_sp<SkTypeface>  fTypeface;
+        sk_sp<SkImage>     fImage;
+    };
+
+    using EntryMap = std::unordered_map<uint64_t, Entry>;
+
+    static uint64_t HashOf(const SkData* data);
+
+    static sk_sp<SkData> SerializeTypeface(SkTypeface* typeface, void* ctx);
+    static sk_sp<SkData> SerializeImage(SkImage* image, void* ctx);
+    static sk_sp<SkTypeface> DeserializeTypeface(const void* data, size_t length, void* ctx);
+    static sk_sp<SkImage> DeserializeImage(const void* data, size_t length, void* ctx);
+
+    // Returns reference record for resource with cached id, or null if object wasn't stored yet
+    sk_sp<SkData> findReference(EntryMap& entries, std::unordered_map<uint32_t, uint64_t>& ids, uint32_t uniqueID);
+    // Stores serialized resource and returns the record to write into picture
+    sk_sp<SkData> put(EntryMap& entries, std::unordered_map<uint32_t, uint64_t>& ids, uint32_t uniqueID, sk_sp<SkData> data);
+    // Parses record, returns stored data or inline data
+    sk_sp<SkData> resolve(EntryMap& entries, const void* record, size_t length, uint64_t* id);
+
+    mutable SkMutex fMutex;
+    EntryMap fTypefaces;
+    EntryMap fImages;
+    // Serialized content ids of already stored objects, keyed by SkTypeface/SkImage uniqueID
+    std::unordered_map<uint32_t, uint64_t> fTypefaceIds;
+    std::unordered_map<uint32_t, uint64_t> fImageIds;
+    int32_t fReferences;
+    size_t fStoredBytes;
+    size_t fReferencedBytes;
+};
@@ -0,0 +1,17 @@
+#pragma once
+#include "SkPixmap.h"
+
+namespace skikoMpp {
+    namespace pixels {
+        /**
+         * Converts src pixels into dst ColorType, AlphaType and ColorSpace. Pixmaps must have
+         * the same dimensions. Produces the same result as src.readPixels(dst).
+         *
+         * RGBA/BGRA swizzles and premul/unpremul between 8888 formats go through Skia's
+         * runtime-dispatched SIMD kernels (SkOpts), everything else (565, F16, Alpha_8, ...)
+         * through SkPixmap::readPixels. Large images are split into row bands converted
+         * on skikoMpp::parallel::executor().
+         */
+        bool convert(const SkPixmap& src, const SkPixmap& dst);
+    }
+}
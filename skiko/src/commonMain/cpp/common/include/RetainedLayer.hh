@@ -0,0 +1,80 @@
+#pragma once
+#include <memory>
+#include "SkCanvas.h"
+#include "SkImage.h"
+#include "SkPaint.h"
+#include "SkPicture.h"
+#include "SkPictureRecorder.h"
+#include "SkRect.h"
+
+// Retained display list for a static part of the UI.
+//
+// Content is recorded once into an SkPicture and replayed with drawPicture while it stays clean,
+// so the drawing commands don't cross the language boundary every frame. Once the picture is
+// replayed often enough, or is complex enough, it's rasterized into an SkImage at the scale of
+// the destination canvas and drawn as a single image while that scale doesn't change.
+//
+// Not thread safe: a layer is owned by the UI thread that records and draws it.
+class RetainedLayer {
+public:
+    struct Stats {
+        int32_t fDraws;           // draw() calls that found valid content
+        int32_t fMisses;          // draw() calls on a dirty layer
+        int32_t fRecordings;      // finished recordings
+        int32_t fRecordMicros;    // total time spent between beginRecording() and finishRecording()
+        int32_t fRasterizations;  // number of times picture was rasterized
+        int32_t fRasterDraws;     // draws served by the rasterized image
+        size_t  fPictureBytes;
+        size_t  fImageBytes;
+    };
+
+    explicit RetainedLayer(const SkRect& bounds);
+
+    // Starts recording new content, returns canvas valid until finishRecording()
+    SkCanvas* beginRecording();
+
+    // Replaces content with the recorded picture and marks layer clean
+    bool finishRecording();
+
+    // Marks layer dirty; content is kept until the next recording, but draw() refuses to use it
+    void invalidate();
+
+    bool isDirty() const { return fDirty; }
+
+    // Draws content into canvas. Returns false without drawing if the layer is dirty.
+    bool draw(SkCanvas* canvas, const SkPaint* paint);
+
+    // Rasterize after the picture was replayed this many times at the same scale, 0 disables
+    void setRasterAfterReplays(int replays) { fRasterAfterReplays = replays; }
+
+    int getRasterAfterReplays() const { return fRasterAfterReplays; }
+
+    // Rasterize right away pictures with at least this many ops, 0 disables
+    void setRasterAboveOpCount(int opCount) { fRasterAboveOpCount = opCount; }
+
+    int getRasterAboveOpCount() const { return fRasterAboveOpCount; }
+
+    Stats getStats() const;
+
+    void resetStats();
+
+private:
+    bool shouldRasterize() const;
+    bool rasterize(SkCanvas* canvas, SkScalar scaleX, SkScalar scaleY);
+
+    SkRect fBounds;
+    SkPictureRecorder fRecorder;
+    bool fRecording;
+    int64_t fRecordStartNanos;
+    bool fDirty;
+    sk_sp<SkPicture> fPicture;
+    sk_sp<SkImage> fImage;
+    SkScalar fImageScaleX;
+    SkScalar fImageScaleY;
+    // Replays of current picture at fReplayScale
+    int fReplays;
+    SkVector fReplayScale;
+    int fRasterAfterReplays;
+    int fRasterAboveOpCount;
+    Stats fStats;
+};
@@ -0,0 +1,150 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "SkData.h"
+#include "SkFont.h"
+#include "SkFontArguments.h"
+#include "SkShaper.h"
+#include "SkString.h"
+#include "SkTypeface.h"
+#include "include/private/SkMutex.h"
+
+// Process-wide cache of shaping results that can be saved to a file and mapped back on the
+// next start, so that UI strings don't have to be reshaped before the first frame.
+//
+// Entries record the RunHandler calls a shaper makes for (text, font, features, options, width)
+// and replay them into any other handler. Typefaces are identified by family name, style, glyph
+// count, the whole-file checksum from the 'head' table and variation axis values. Entries loaded
+// from a file are only replayed if typefaces with the same fingerprints are found and the runs fit
+// the text, otherwise text is shaped live and the entry is recorded again. Files written by a
+// different Skia milestone or HarfBuzz version are not loaded. Loaded entries stay in the mapped
+// file until first use.
+//
+// Only shapers registered with their kind are cached, since different implementations shape
+// the same text differently. All methods are safe to call from any thread.
+class ShapingCache {
+public:
+    enum class ShaperKind : uint8_t {
+        kPrimitive = 1,
+        kShaperDrivenWrapper,
+        kShapeThenWrap,
+        kShapeDontWrapOrReorder,
+        kCoreText,
+        kDefault
+    };
+
+    struct Stats {
+        int32_t fHits;
+        int32_t fMisses;
+        // Entries dropped because their typefaces changed or they couldn't be decoded
+        int32_t fRejected;
+        int32_t fCount;
+    };
+
+    static const size_t kMaxEntries = 8192;
+
+    static ShapingCache& Get();
+
+    // Releases shaper, remembering its kind until Unregister
+    static SkShaper* Register(std::unique_ptr<SkShaper> shaper, ShaperKind kind);
+
+    static void Unregister(SkShaper* shaper);
+
+    // Replays cached result into handler. Otherwise calls shapeLive with a handler that records
+    // calls and forwards them to the given one; shapeLive returns false if it failed.
+    bool shape(SkShaper* shaper, const SkString& text, const SkFont& font,
+               const std::vector<SkShaper::Feature>& features, int options, float width,
+               SkShaper::RunHandler* handler, const std::function<bool(SkShaper::RunHandler*)>& shapeLive);
+
+    // Adds entries from file to the cache, keeping entries already present. The file stays
+    // mapped until its entries are decoded or dropped.
+    bool load(const char* path);
+
+    // Writes all entries to a temporary file and renames it over path, so a mapped file
+    // is never modified in place.
+    bool save(const char* path);
+
+    void setEnabled(bool enabled);
+
+    void clear();
+
+    Stats getStats() const;
+
+private:
+    struct Fingerprint {
+        SkString fFamily;
+        uint32_t fStyle;
+        uint32_t fChecksum;
+        uint32_t fGlyphCount;
+        // Design position of variable font instances, empty for other typefaces
+        std::vector<SkFontArguments::VariationPosition::Coordinate> fVariation;
+
+        bool operator==(const Fingerprint& other) const {
+            if (fStyle != other.fStyle || fChecksum != other.fChecksum || fGlyphCount != other.fGlyphCount
+                || fFamily != other.fFamily || fVariation.size() != other.fVariation.size())
+                return false;
+            for (size_t i = 0; i < fVariation.size(); ++i) {
+                if (fVariation[i].axis != other.fVariation[i].axis || fVariation[i].value != other.fVariation[i].value)
+                    return false;
+            }
+            return true;
+        }
+    };
+
+    struct Run {
+        Fingerprint fFingerprint;
+        // Set for runs recorded by this process
+        sk_sp<SkTypeface> fTypeface;
+        uint8_t fBidiLevel;
+        SkVector fAdvance;
+        size_t fUtf8Begin;
+        size_t fUtf8End;
+        std::vector<SkGlyphID> fGlyphs;
+        // Relative to the run origin, without offsets
+        std::vector<SkPoint> fPositions;
+        std::vector<SkVector> fOffsets;
+        std::vector<uint32_t> fClusters;
+    };
+
+    using Line = std::vector<Run>;
+
+    struct Recording {
+        std::vector<Line> fLines;
+    };
+
+    struct Entry {
+        std::shared_ptr<const Recording> fRecording;
+        // Encoded recording in a mapped file, if not decoded yet
+        sk_sp<SkData> fFile;
+        const uint8_t* fData;
+        size_t fSize;
+    };
+
+    class Recorder;
+
+    ShapingCache();
+
+    bool fingerprint(SkTypeface* typeface, Fingerprint* result);
+    sk_sp<SkTypeface> resolve(const Fingerprint& fingerprint, const SkFont& font);
+    bool makeKey(SkShaper* shaper, const SkString& text, const SkFont& font,
+                 const std::vector<SkShaper::Feature>& features, int options, float width, std::string* key);
+    std::shared_ptr<const Recording> find(const std::string& key);
+    bool replay(const Recording& recording, const SkString& text, const SkFont& font, SkShaper::RunHandler* handler);
+    void reject(const std::string& key);
+
+    static void WriteFingerprint(const Fingerprint& fingerprint, std::string* out);
+    static void Encode(const Recording& recording, std::string* out);
+    static bool Decode(const uint8_t* data, size_t size, Recording* recording);
+
+    mutable SkMutex fMutex;
+    bool fEnabled;
+    std::unordered_map<std::string, Entry> fEntries;
+    std::unordered_map<uint32_t, Fingerprint> fFingerprints;
+    std::unordered_map<std::string, sk_sp<SkTypeface>> fResolved;
+    int32_t fHits;
+    int32_t fMisses;
+    int32_t fRejected;
+};
@@ -0,0 +1,14 @@
+#pragma once
+#include "ParagraphBuilder.h"
+#include "SkString.h"
+
+namespace skikoMpp {
+    namespace paragraph {
+        // Adds UTF-8 text to builder, with span i of [starts[i], ends[i]) in UTF-16 code
+        // units styled by styles[i]. Where spans overlap the one with the greater index wins,
+        // text outside of spans gets the builder's current style.
+        void addStyledText(skia::textlayout::ParagraphBuilder* builder, const SkString& text,
+                           const int* starts, const int* ends,
+                           const skia::textlayout::TextStyle* const* styles, int count);
+    }
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "SkRect.h"
+#include "SkTextBlob.h"
+#include "include/private/SkMutex.h"
+
+// Everything skikoMpp::textblob derives from a blob, computed in one pass over its runs
+struct TextBlobMetrics {
+    int fGlyphsLength;
+    int fPositionsLength;
+    // Bounds and last baseline need kFull_Positioning in every run
+    bool fHasBounds;
+    SkRect fBlockBounds;
+    SkRect fTightBounds;
+    bool fHasFirstBaseline;
+    float fFirstBaseline;
+    float fLastBaseline;
+    // Clusters need extended runs, i.e. blobs that come from the shaper, in UTF-16 indices
+    bool fHasClusters;
+    std::vector<int> fClusters;
+
+    static std::shared_ptr<const TextBlobMetrics> Compute(const SkTextBlob& blob);
+
+    size_t bytes() const {
+        return sizeof(TextBlobMetrics) + fClusters.capacity() * sizeof(int);
+    }
+};
+
+// Process-wide side table of TextBlobMetrics keyed by SkTextBlob::uniqueID().
+//
+// Entries don't keep blobs alive: they are dropped when the last Kotlin reference to a blob
+// is released, and least recently used entries are evicted once the byte budget is exceeded,
+// which covers blobs released elsewhere. Unique IDs are never reused, so a stale entry can
+// only waste memory, never return wrong metrics. All methods are safe to call from any thread.
+class TextBlobMetricsCache {
+public:
+    struct Stats {
+        int32_t fHits;
+        int32_t fMisses;
+        int32_t fEvictions;
+        int32_t fCount;
+        size_t  fBytesUsed;
+        size_t  fByteBudget;
+    };
+
+    static const size_t kDefaultByteBudget = 4 * 1024 * 1024;
+
+    static TextBlobMetricsCache& Get();
+
+    std::shared_ptr<const TextBlobMetrics> find(const SkTextBlob& blob);
+
+    void remove(uint32_t uniqueID);
+
+    void setByteBudget(size_t byteBudget);
+
+    void purgeAll();
+
+    Stats getStats() const;
+
+    void resetStats();
+
+private:
+    TextBlobMetricsCache();
+
+    struct Entry {
+        uint32_t fUniqueID;
+        std::shared_ptr<const TextBlobMetrics> fMetrics;
+        size_t fBytes;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    void eraseLocked(EntryList::iterator it);
+    void purgeLocked(size_t targetBytes);
+
+    mutable SkMutex fMutex;
+    // Front is the most recently used entry
+    EntryList fEntries;
+    std::unordered_map<uint32_t, EntryList::iterator> fIndex;
+    size_t fBytesUsed;
+    size_t fByteBudget;
+    int32_t fHits;
+    int32_t fMisses;
+    int32_t fEvictions;
+};
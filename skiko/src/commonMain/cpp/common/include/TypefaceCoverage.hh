@@ -0,0 +1,63 @@
+#pragma once
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "SkTypeface.h"
+#include "include/private/SkMutex.h"
+
+// Set of characters a typeface has glyphs for, read from its cmap table once.
+//
+// Coverage is a two-level bitmap: every 256 characters of the 17 Unicode planes point to a
+// block of 256 bits. Empty and full blocks are shared, so most fonts take a few kilobytes.
+// Typefaces without a Unicode cmap are queried character by character instead.
+class TypefaceCoverage {
+public:
+    static const size_t kMaxEntries = 256;
+
+    // Coverage of typeface, shared by all callers until evicted from the process-wide LRU.
+    // Safe to call from any thread.
+    static std::shared_ptr<const TypefaceCoverage> Get(SkTypeface* typeface);
+
+    bool covers(SkUnichar unichar) const {
+        if (fTypeface)
+            return unichar >= 0 && fTypeface->unicharToGlyph(unichar) != 0;
+        if (static_cast<uint32_t>(unichar) >= kUnicodeSize)
+            return false;
+        uint32_t block = fPages[unichar >> 8];
+        return (fBits[block * kBlockWords + ((unichar >> 5) & (kBlockWords - 1))] >> (unichar & 31)) & 1;
+    }
+
+    bool coversAll(const SkUnichar* unichars, int count) const;
+
+    // Number of covered characters, or -1 if not known from cmap
+    int count() const;
+
+private:
+    static const uint32_t kUnicodeSize = 0x110000;
+    static const uint32_t kBlockWords = 8;
+    static const uint32_t kEmptyBlock = 0;
+    static const uint32_t kFullBlock = 1;
+
+    TypefaceCoverage() = default;
+
+    static bool Parse(const uint8_t* cmap, size_t size, std::vector<uint32_t>* bitmap);
+    void compress(const std::vector<uint32_t>& bitmap);
+
+    // Set if coverage couldn't be read from cmap
+    sk_sp<SkTypeface> fTypeface;
+    std::vector<uint16_t> fPages;
+    std::vector<uint32_t> fBits;
+    int fCount;
+
+    struct Cache {
+        using EntryList = std::list<std::pair<SkTypefaceID, std::shared_ptr<const TypefaceCoverage>>>;
+
+        SkMutex fMutex;
+        // Front is the most recently used entry
+        EntryList fEntries;
+        std::unordered_map<SkTypefaceID, EntryList::iterator> fIndex;
+    };
+
+    static Cache& GetCache();
+};
@@ -0,0 +1,65 @@
+#pragma once
+#include <list>
+#include <string>
+#include <unordered_map>
+#include "SkFontArguments.h"
+#include "SkTypeface.h"
+#include "include/private/SkMutex.h"
+
+// Process-wide LRU cache of variable font instances.
+//
+// Typeface::makeClone creates a new typeface with its own glyph cache on every call, so
+// animating an axis throws glyph caches away each frame. Instances here are keyed by base
+// typeface unique ID, collection index and axis values rounded to a multiple of the
+// quantization step of their axis, so nearby values share one typeface. All methods are safe
+// to call from any thread.
+class VariationCache {
+public:
+    struct Stats {
+        int32_t fHits;
+        int32_t fMisses;
+        int32_t fEvictions;
+        int32_t fCount;
+        int32_t fCapacity;
+    };
+
+    static const int32_t kDefaultCapacity = 64;
+
+    static VariationCache& Get();
+
+    // Instance of base with given axis values, or nullptr if it can't be made
+    sk_sp<SkTypeface> makeClone(SkTypeface* base, const SkFontArguments::VariationPosition::Coordinate* coordinates,
+                                int count, int collectionIndex);
+
+    void setCapacity(int32_t capacity);
+
+    // Values of axis are rounded to multiples of step. 0, the default for every axis, keeps
+    // them exact, and so does a step larger than the axis range of a typeface.
+    void setQuantization(SkFourByteTag axis, float step);
+
+    void purgeAll();
+
+    Stats getStats() const;
+
+private:
+    VariationCache();
+
+    struct Entry {
+        std::string fKey;
+        sk_sp<SkTypeface> fTypeface;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    void purgeLocked(size_t targetCount);
+
+    mutable SkMutex fMutex;
+    // Front is the most recently used entry
+    EntryList fEntries;
+    std::unordered_map<std::string, EntryList::iterator> fIndex;
+    int32_t fCapacity;
+    std::unordered_map<SkFourByteTag, float> fQuantization;
+    int32_t fHits;
+    int32_t fMisses;
+    int32_t fEvictions;
+};
@@ -0,0 +1,59 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include "SkRect.h"
+#include "SkVertices.h"
+
+// Mesh that is built once and drawn many times without copying vertex data on every draw.
+//
+// Attributes live in storage owned by the buffer for its whole lifetime. SkVertices is immutable
+// and may still be referenced by a recorded picture or a pending GPU op, so vertices() copies the
+// storage into a new snapshot only when it was edited since the previous call, and reuses the
+// snapshot otherwise. Data is written through set*(), or through the raw pointers returned by
+// *Storage() followed by markEdited().
+//
+// Not thread safe.
+class VerticesBuffer {
+public:
+    static std::unique_ptr<VerticesBuffer> Make(SkVertices::VertexMode mode, int vertexCount, int indexCount,
+                                                bool hasTexCoords, bool hasColors);
+
+    SkVertices::VertexMode mode() const { return fMode; }
+    int vertexCount() const { return fVertexCount; }
+    int indexCount() const { return fIndexCount; }
+    bool hasTexCoords() const { return !fTexCoords.empty(); }
+    bool hasColors() const { return !fColors.empty(); }
+
+    // Writable storage, valid while the buffer exists. Null if mesh has no such attribute.
+    SkPoint* positionsStorage() { return fPositions.empty() ? nullptr : fPositions.data(); }
+    SkPoint* texCoordsStorage() { return fTexCoords.empty() ? nullptr : fTexCoords.data(); }
+    SkColor* colorsStorage() { return fColors.empty() ? nullptr : fColors.data(); }
+    uint16_t* indicesStorage() { return fIndices.empty() ? nullptr : fIndices.data(); }
+
+    // Makes the next vertices() call pick up writes made through storage pointers
+    void markEdited() { fEdited = true; }
+
+    // Copy count items into storage starting at offset, return false if out of range
+    bool setPositions(const float* xy, int offset, int count);
+    bool setTexCoords(const float* uv, int offset, int count);
+    bool setColors(const SkColor* colors, int offset, int count);
+    bool setIndices(const uint16_t* indices, int offset, int count);
+
+    // Immutable snapshot to draw, commits pending edits
+    sk_sp<SkVertices> vertices();
+
+    SkRect bounds() { return vertices()->bounds(); }
+
+private:
+    VerticesBuffer(SkVertices::VertexMode mode, int vertexCount, int indexCount, bool hasTexCoords, bool hasColors);
+
+    SkVertices::VertexMode fMode;
+    int fVertexCount;
+    int fIndexCount;
+    std::vector<SkPoint> fPositions;
+    std::vector<SkPoint> fTexCoords;
+    std::vector<SkColor> fColors;
+    std::vector<uint16_t> fIndices;
+    bool fEdited;
+    sk_sp<SkVertices> fVertices;
+};
@@ -1,6 +1,8 @@
 #include "mppinterop.h"
 #include "RunRecordClone.hh"
+#include "TextBlobMetricsCache.hh"
 #include "src/utils/SkUTF.h"
+#include <algorithm>
 #include <iostream>
 
 namespace skikoMpp {
@@ -28,66 +30,21 @@ namespace skikoMpp {
 
     namespace textblob {
         std::unique_ptr<SkRect> getBlockBounds(SkTextBlob* instance) {
-            SkTextBlob::Iter iter(*instance);
-            SkTextBlob::Iter::Run run;
-
-            auto bounds = new SkRect();
-            SkFontMetrics metrics;
-
-            while (iter.next(&run)) {
-                // run.fGlyphIndices points directly to runRecord.glyphBuffer(), which comes directly after RunRecord itself
-                auto runRecord = reinterpret_cast<const RunRecordClone*>(run.fGlyphIndices) - 1;
-                if (runRecord->positioning() != 2) // kFull_Positioning
-                    return std::unique_ptr<SkRect>(nullptr);
-
-                SkScalar* posBuffer = runRecord->posBuffer();
-                const SkFont& font = runRecord->fFont;
-                font.getMetrics(&metrics);
-
-                SkScalar lastLeft = posBuffer[(run.fGlyphCount - 1) * 2];
-                SkScalar lastWidth;
-                if (run.fGlyphCount > 1 && SkScalarNearlyEqual(posBuffer[(run.fGlyphCount - 2) * 2], lastLeft))
-                    lastWidth = 0;
-                else
-                    font.getWidths(&run.fGlyphIndices[run.fGlyphCount - 1], 1, &lastWidth);
-
-                auto runBounds = SkRect::MakeLTRB(posBuffer[0], posBuffer[1] + metrics.fAscent, lastLeft + lastWidth, posBuffer[1] + metrics.fDescent);
-                bounds->join(runBounds);
-            }
-
-            return std::unique_ptr<SkRect>(bounds);
+            auto metrics = TextBlobMetricsCache::Get().find(*instance);
+            if (!metrics->fHasBounds)
+                return std::unique_ptr<SkRect>(nullptr);
+            return std::unique_ptr<SkRect>(new SkRect(metrics->fBlockBounds));
         }
 
         std::unique_ptr<SkRect> getTightBounds(SkTextBlob* instance) {
-            SkTextBlob::Iter iter(*instance);
-            SkTextBlob::Iter::Run run;
-            auto bounds = new SkRect();
-            SkRect tmpBounds;
-            while (iter.next(&run)) {
-                // run.fGlyphIndices points directly to runRecord.glyphBuffer(), which comes directly after RunRecord itself
-                auto runRecord = reinterpret_cast<const RunRecordClone*>(run.fGlyphIndices) - 1;
-                if (runRecord->positioning() != 2) // kFull_Positioning
-                    return std::unique_ptr<SkRect>(nullptr);
-
-                runRecord->fFont.measureText(runRecord->glyphBuffer(), run.fGlyphCount * sizeof(uint16_t), SkTextEncoding::kGlyphID, &tmpBounds, nullptr);
-                SkScalar* posBuffer = runRecord->posBuffer();
-                tmpBounds.offset(posBuffer[0], posBuffer[1]);
-                bounds->join(tmpBounds);
-            }
-            return std::unique_ptr<SkRect>(bounds);
+            auto metrics = TextBlobMetricsCache::Get().find(*instance);
+            if (!metrics->fHasBounds)
+                return std::unique_ptr<SkRect>(nullptr);
+            return std::unique_ptr<SkRect>(new SkRect(metrics->fTightBounds));
         }
 
         int getPositionsLength(SkTextBlob* instance) {
-            SkTextBlob::Iter iter(*instance);
-            SkTextBlob::Iter::Run run;
-            int count = 0;
-            while (iter.next(&run)) {
-                // run.fGlyphIndices points directly to runRecord.glyphBuffer(), which comes directly after RunRecord itself
-                auto runRecord = reinterpret_cast<const RunRecordClone*>(run.fGlyphIndices) - 1;
-                unsigned scalarsPerGlyph = RunRecordClone::ScalarsPerGlyph(runRecord->positioning());
-                count += run.fGlyphCount * scalarsPerGlyph;
-            }
-            return count;
+            return TextBlobMetricsCache::Get().find(*instance)->fPositionsLength;
         }
 
         void getPositions(SkTextBlob* instance, float* resultArray) {
@@ -116,80 +73,35 @@ namespace skikoMpp {
         }
 
         int getGlyphsLength(SkTextBlob* instance) {
-            SkTextBlob::Iter iter(*instance);
-            SkTextBlob::Iter::Run run;
-            int stored = 0;
-            while (iter.next(&run)) {
-                stored += run.fGlyphCount;
-            }
-            return stored;
+            return TextBlobMetricsCache::Get().find(*instance)->fGlyphsLength;
         }
 
         bool getFirstBaseline(SkTextBlob* instance, float* resultArray) {
-            SkTextBlob::Iter iter(*instance);
-            SkTextBlob::Iter::Run run;
-            if (iter.next(&run)) {
-                auto runRecord = reinterpret_cast<const RunRecordClone*>(run.fGlyphIndices) - 1;
-                if (runRecord->positioning() != 2) // kFull_Positioning
-                    return false;
-                resultArray[0] = runRecord->posBuffer()[1];
-                return true;
-            }
-            return false;
+            auto metrics = TextBlobMetricsCache::Get().find(*instance);
+            if (!metrics->fHasFirstBaseline)
+                return false;
+            resultArray[0] = metrics->fFirstBaseline;
+            return true;
         }
 
         bool getLastBaseline(SkTextBlob* instance, float* resultArray) {
-            SkTextBlob::Iter iter(*instance);
-            SkTextBlob::Iter::Run run;
-            SkScalar baseline = 0;
-            while (iter.next(&run)) {
-                // run.fGlyphIndices points directly to runRecord.glyphBuffer(), which comes directly after RunRecord itself
-                auto runRecord = reinterpret_cast<const RunRecordClone*>(run.fGlyphIndices) - 1;
-                if (runRecord->positioning() != 2) // kFull_Positioning
-                    return false;
-
-                baseline = std::max(baseline, runRecord->posBuffer()[1]);
-            }
-            resultArray[0] = baseline;
+            auto metrics = TextBlobMetricsCache::Get().find(*instance);
+            if (!metrics->fHasBounds)
+                return false;
+            resultArray[0] = metrics->fLastBaseline;
             return true;
         }
 
         int getClustersLength(SkTextBlob* instance) {
-            SkTextBlob::Iter iter(*instance);
-            SkTextBlob::Iter::Run run;
-            size_t count = 0;
-            while (iter.next(&run)) {
-                auto runRecord = reinterpret_cast<const RunRecordClone*>(run.fGlyphIndices) - 1;
-                if (!runRecord->isExtended())
-                    return 0;
-                count += run.fGlyphCount;
-            }
-            return count;
+            auto metrics = TextBlobMetricsCache::Get().find(*instance);
+            return metrics->fHasClusters ? static_cast<int>(metrics->fClusters.size()) : 0;
         }
 
-        bool getClusters(SkTextBlob* instance, int* clusters) { // implementation was taken from skija
-            SkTextBlob::Iter iter(*instance);
-            SkTextBlob::Iter::Run run;
-            size_t stored = 0;
-            // uint32_t cluster8 = 0;
-            uint32_t runStart16 = 0;
-
-            while (iter.next(&run)) {
-                // run.fGlyphIndices points directly to runRecord.glyphBuffer(), which comes directly after RunRecord itself
-                auto runRecord = reinterpret_cast<const RunRecordClone*>(run.fGlyphIndices) - 1;
-                if (!runRecord->isExtended()) {
-                    return false;
-                }
-
-                skija::UtfIndicesConverter conv(runRecord->textBuffer(), runRecord->textSize());
-                uint32_t* clusterBuffer = runRecord->clusterBuffer();
-                for (int i = 0; i < run.fGlyphCount; ++i)
-                    clusters[stored + i] = runStart16 + conv.from8To16(clusterBuffer[i]);
-                runStart16 += conv.from8To16(runRecord->textSize());
-                // memcpy(&clusters[stored], runRecord->clusterBuffer(), run.fGlyphCount * sizeof(uint32_t));
-
-                stored += run.fGlyphCount;
-            }
+        bool getClusters(SkTextBlob* instance, int* clusters) {
+            auto metrics = TextBlobMetricsCache::Get().find(*instance);
+            if (!metrics->fHasClusters)
+                return false;
+            std::copy(metrics->fClusters.begin(), metrics->fClusters.end(), clusters);
             return true;
         }
     }
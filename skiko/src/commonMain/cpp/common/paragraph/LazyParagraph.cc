@@ -0,0 +1,240 @@
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include "LazyParagraph.hh"
+#include "ParagraphBuilder.h"
+#include "ParagraphCacheMonitor.hh"
+#include "mppinterop.h"
+
+using namespace skia::textlayout;
+
+namespace {
+    // Chunks are at least this many bytes long, so that short lines are shaped in batches
+    const size_t kMinChunkBytes = 16 * 1024;
+
+    uint32_t utf16Length(const char* data, size_t length) {
+        uint32_t result = 0;
+        for (size_t i = 0; i < length; ++i) {
+            uint8_t byte = static_cast<uint8_t>(data[i]);
+            if ((byte & 0xC0) != 0x80)
+                ++result;
+            // Four-byte sequences are surrogate pairs in UTF-16
+            if (byte >= 0xF0)
+                ++result;
+        }
+        return result;
+    }
+}
+
+LazyParagraph::LazyParagraph(SkString text, ParagraphStyle style, sk_sp<FontCollection> fontCollection):
+  fText(std::move(text)),
+  fStyle(std::move(style)),
+  fFontCollection(std::move(fontCollection)),
+  fWidth(0),
+  fLaidOutCount(0),
+  fLaidOutHeight(0),
+  fLaidOutLineCount(0),
+  fLaidOutLength16(0),
+  fLength16(0)
+{
+    fChunks = split(0, fText.size(), 0);
+    const Chunk& last = fChunks.back();
+    fLength16 = last.fStart16 + last.fLength16;
+}
+
+std::vector<LazyParagraph::Chunk> LazyParagraph::split(size_t start, size_t end, uint32_t start16) const {
+    const char* data = fText.c_str();
+    std::vector<Chunk> chunks;
+    size_t chunkEnd;
+    size_t next;
+    do {
+        chunkEnd = end;
+        next = end;
+        if (end - start > kMinChunkBytes) {
+            const void* newline = memchr(data + start + kMinChunkBytes, '\n', end - start - kMinChunkBytes);
+            if (newline != nullptr) {
+                chunkEnd = static_cast<const char*>(newline) - data;
+                next = chunkEnd + 1;
+            }
+        }
+        Chunk chunk;
+        chunk.fStart8 = start;
+        chunk.fEnd8 = chunkEnd;
+        chunk.fStart16 = start16;
+        chunk.fLength16 = utf16Length(data + start, chunkEnd - start);
+        chunk.fTop = 0;
+        chunk.fFirstLine = 0;
+        start16 += chunk.fLength16 + (next > chunkEnd ? 1 : 0);
+        chunks.push_back(std::move(chunk));
+        start = next;
+        // Range ending with a line break at a chunk split still has an empty last line
+    } while (start < end || next > chunkEnd);
+    return chunks;
+}
+
+void LazyParagraph::layout(float width) {
+    fWidth = width;
+    fLaidOutCount = 0;
+    fLaidOutHeight = 0;
+    fLaidOutLineCount = 0;
+    fLaidOutLength16 = 0;
+}
+
+bool LazyParagraph::layoutNext() {
+    if (isLaidOutCompletely())
+        return false;
+
+    Chunk& chunk = fChunks[fLaidOutCount];
+    if (!chunk.fParagraph) {
+        std::unique_ptr<ParagraphBuilder> builder = ParagraphBuilder::make(fStyle, fFontCollection);
+        builder->addText(fText.c_str() + chunk.fStart8, chunk.fEnd8 - chunk.fStart8);
+        chunk.fParagraph = builder->Build();
+    }
+    chunk.fParagraph->layout(fWidth);
+    ParagraphCacheMonitor::EnforceBudget(chunk.fParagraph.get());
+    chunk.fTop = fLaidOutHeight;
+    chunk.fFirstLine = fLaidOutLineCount;
+
+    fLaidOutHeight += chunk.fParagraph->getHeight();
+    fLaidOutLineCount += static_cast<int>(chunk.fParagraph->lineNumber());
+    fLaidOutLength16 += chunk.fLength16 + (hasSeparator(chunk) ? 1 : 0);
+    ++fLaidOutCount;
+    return true;
+}
+
+void LazyParagraph::replaceText(uint32_t from, uint32_t to, const SkString& text) {
+    to = std::max(from, to);
+    size_t first = chunkIndexAt16(from);
+    size_t last = chunkIndexAt16(to);
+    // Positions of the edited chunks, read before they are replaced
+    size_t start8 = fChunks[first].fStart8;
+    uint32_t start16 = fChunks[first].fStart16;
+    float top = fChunks[first].fTop;
+    int firstLine = fChunks[first].fFirstLine;
+    size_t oldEnd8 = fChunks[last].fEnd8;
+    uint32_t oldEnd16 = fChunks[last].fStart16 + fChunks[last].fLength16;
+
+    skija::UtfIndicesConverter fromConv(fText.c_str() + start8, fText.size() - start8);
+    size_t from8 = start8 + fromConv.from16To8(from - start16);
+    size_t lastStart8 = fChunks[last].fStart8;
+    skija::UtfIndicesConverter toConv(fText.c_str() + lastStart8, fText.size() - lastStart8);
+    size_t to8 = std::max(from8, lastStart8 + toConv.from16To8(to - fChunks[last].fStart16));
+
+    SkString newText;
+    newText.append(fText.c_str(), from8);
+    newText.append(text);
+    newText.append(fText.c_str() + to8, fText.size() - to8);
+    fText.swap(newText);
+
+    // Only chunks touching the edit are split again and reshaped, later chunks keep their
+    // shaped and laid out paragraphs and just move
+    size_t end8 = oldEnd8 - to8 + from8 + text.size();
+    std::vector<Chunk> replacement = split(start8, end8, start16);
+    uint32_t end16 = replacement.back().fStart16 + replacement.back().fLength16;
+    for (size_t i = last + 1; i < fChunks.size(); ++i) {
+        fChunks[i].fStart8 = fChunks[i].fStart8 - oldEnd8 + end8;
+        fChunks[i].fEnd8 = fChunks[i].fEnd8 - oldEnd8 + end8;
+        fChunks[i].fStart16 = fChunks[i].fStart16 - oldEnd16 + end16;
+    }
+    fLength16 = fLength16 - oldEnd16 + end16;
+    fChunks.erase(fChunks.begin() + first, fChunks.begin() + last + 1);
+    fChunks.insert(fChunks.begin() + first, std::make_move_iterator(replacement.begin()),
+                   std::make_move_iterator(replacement.end()));
+
+    // Lines are broken again from the first changed chunk
+    if (fLaidOutCount > first) {
+        fLaidOutCount = first;
+        fLaidOutHeight = top;
+        fLaidOutLineCount = firstLine;
+        fLaidOutLength16 = start16;
+    }
+}
+
+size_t LazyParagraph::chunkIndexAt16(uint32_t i16) const {
+    // Last chunk starting at or before i16
+    auto it = std::upper_bound(fChunks.begin(), fChunks.end(), i16, [](uint32_t value, const Chunk& chunk) {
+        return value < chunk.fStart16;
+    });
+    return it == fChunks.begin() ? 0 : static_cast<size_t>(it - fChunks.begin()) - 1;
+}
+
+void LazyParagraph::layoutUntil(float y) {
+    while (fLaidOutHeight <= y && layoutNext()) {}
+}
+
+void LazyParagraph::layoutUntilLine(int line) {
+    while (fLaidOutLineCount <= line && layoutNext()) {}
+}
+
+void LazyParagraph::layoutAll() {
+    while (layoutNext()) {}
+}
+
+float LazyParagraph::height() {
+    if (fLaidOutCount == 0)
+        layoutNext();
+    if (isLaidOutCompletely() || fLaidOutLength16 == 0)
+        return fLaidOutHeight;
+    float remaining = static_cast<float>(fLength16 - std::min(fLength16, fLaidOutLength16));
+    return fLaidOutHeight + remaining * fLaidOutHeight / fLaidOutLength16;
+}
+
+const LazyParagraph::Chunk* LazyParagraph::chunkAt(float y) const {
+    if (fLaidOutCount == 0)
+        return nullptr;
+    auto begin = fChunks.begin();
+    auto end = begin + fLaidOutCount;
+    // First chunk starting below y, the one before it contains y
+    auto it = std::upper_bound(begin, end, y, [](float value, const Chunk& chunk) {
+        return value < chunk.fTop;
+    });
+    return it == begin ? &*begin : &*(it - 1);
+}
+
+void LazyParagraph::paint(SkCanvas* canvas, float x, float y, float top, float bottom) {
+    layoutUntil(bottom);
+    for (size_t i = 0; i < fLaidOutCount; ++i) {
+        const Chunk& chunk = fChunks[i];
+        float chunkBottom = chunk.fTop + chunk.fParagraph->getHeight();
+        if (chunkBottom <= top)
+            continue;
+        if (chunk.fTop >= bottom)
+            break;
+        chunk.fParagraph->paint(canvas, x, y + chunk.fTop);
+    }
+}
+
+void LazyParagraph::getLineMetrics(std::vector<LineMetrics>& metrics) {
+    metrics.clear();
+    metrics.reserve(fLaidOutLineCount);
+    std::vector<LineMetrics> chunkMetrics;
+    for (size_t i = 0; i < fLaidOutCount; ++i) {
+        const Chunk& chunk = fChunks[i];
+        chunk.fParagraph->getLineMetrics(chunkMetrics);
+        for (size_t j = 0; j < chunkMetrics.size(); ++j) {
+            LineMetrics lm = chunkMetrics[j];
+            lm.fStartIndex += chunk.fStart16;
+            lm.fEndIndex += chunk.fStart16;
+            lm.fEndExcludingWhitespaces += chunk.fStart16;
+            lm.fEndIncludingNewline += chunk.fStart16;
+            lm.fBaseline += chunk.fTop;
+            lm.fLineNumber += chunk.fFirstLine;
+            // Line break separating chunks isn't part of any chunk's text
+            if (j + 1 == chunkMetrics.size() && hasSeparator(chunk)) {
+                lm.fEndIncludingNewline += 1;
+                lm.fHardBreak = true;
+            }
+            metrics.push_back(lm);
+        }
+    }
+}
+
+PositionWithAffinity LazyParagraph::getGlyphPositionAtCoordinate(float dx, float dy) {
+    layoutUntil(dy);
+    const Chunk* chunk = chunkAt(dy);
+    if (chunk == nullptr)
+        return PositionWithAffinity(0, Affinity::kDownstream);
+    PositionWithAffinity result = chunk->fParagraph->getGlyphPositionAtCoordinate(dx, dy - chunk->fTop);
+    result.position += chunk->fStart16;
+    return result;
+}
@@ -0,0 +1,256 @@
+#include <atomic>
+#include <cstring>
+#include <string_view>
+#include "ParagraphCacheMonitor.hh"
+#include "FontCollection.h"
+#include "modules/skparagraph/src/ParagraphImpl.h"
+
+using namespace skia::textlayout;
+
+namespace {
+    // Bounds fShaping if paragraphs miss the cache and then are never added to it,
+    // which happens to texts ParagraphCache considers being edited
+    const size_t kMaxShaping = 64;
+
+    // Entry count limit of ParagraphCache, which keeps it private
+    const size_t kMaxCacheEntries = 128;
+
+    SkMutex gRegistryMutex;
+    std::unordered_map<ParagraphCache*, std::weak_ptr<ParagraphCacheMonitor>>* gRegistry = nullptr;
+    // Number of monitors over budget, lets layouts skip the registry lookup
+    std::atomic<int> gOverBudgetCount(0);
+
+    uint32_t floatBits(float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+}
+
+std::shared_ptr<ParagraphCacheMonitor> ParagraphCacheMonitor::Get(ParagraphCache* cache) {
+    SkAutoMutexExclusive lock(gRegistryMutex);
+    if (gRegistry == nullptr)
+        gRegistry = new std::unordered_map<ParagraphCache*, std::weak_ptr<ParagraphCacheMonitor>>();
+
+    auto it = gRegistry->find(cache);
+    if (it != gRegistry->end()) {
+        if (std::shared_ptr<ParagraphCacheMonitor> monitor = it->second.lock())
+            return monitor;
+    }
+
+    // Cache owns the checker, and the checker owns the monitor
+    std::shared_ptr<ParagraphCacheMonitor> monitor(new ParagraphCacheMonitor(cache));
+    cache->setChecker([monitor](ParagraphImpl* paragraph, const char* event, bool) {
+        monitor->check(paragraph, event);
+    });
+    (*gRegistry)[cache] = monitor;
+    // Drop entries of destroyed caches
+    for (auto entry = gRegistry->begin(); entry != gRegistry->end();) {
+        if (entry->second.expired())
+            entry = gRegistry->erase(entry);
+        else
+            ++entry;
+    }
+    return monitor;
+}
+
+void ParagraphCacheMonitor::EnforceBudget(Paragraph* paragraph) {
+    if (gOverBudgetCount.load(std::memory_order_relaxed) == 0)
+        return;
+    ParagraphImpl* impl = static_cast<ParagraphImpl*>(paragraph);
+    Get(impl->fontCollection()->getParagraphCache())->trimIfOverBudget();
+}
+
+ParagraphCacheMonitor::ParagraphCacheMonitor(ParagraphCache* cache)
+    : fCache(cache)
+    , fBytesUsed(0)
+    , fByteBudget(kDefaultByteBudget)
+    , fOverBudget(false)
+    , fHits(0)
+    , fMisses(0)
+    , fEvictions(0)
+    , fTimeSavedNanos(0)
+{
+}
+
+ParagraphCacheMonitor::~ParagraphCacheMonitor() {
+    if (fOverBudget)
+        gOverBudgetCount--;
+}
+
+size_t ParagraphCacheMonitor::Hash(ParagraphImpl* paragraph) {
+    // Same fields ParagraphCacheKey compares, so entries that differ only in spacing,
+    // families or placeholders don't share a mirror entry
+    SkSpan<const char> text = paragraph->text();
+    size_t h = std::hash<std::string_view>()(std::string_view(text.data(), text.size()));
+    auto mix = [&h](size_t value) { h = h * 31 + value; };
+    auto mixString = [&mix](const SkString& value) {
+        mix(std::hash<std::string_view>()(std::string_view(value.c_str(), value.size())));
+    };
+    auto mixFontStyle = [&mix](const SkFontStyle& style) {
+        mix(style.weight());
+        mix(style.width());
+        mix(style.slant());
+    };
+
+    const ParagraphStyle& paragraphStyle = paragraph->paragraphStyle();
+    mix(floatBits(paragraphStyle.getHeight()));
+    mix(static_cast<size_t>(paragraphStyle.getTextDirection()));
+    mix(paragraphStyle.getReplaceTabCharacters());
+    const StrutStyle& strut = paragraphStyle.getStrutStyle();
+    if (strut.getStrutEnabled()) {
+        for (const SkString& family : strut.getFontFamilies())
+            mixString(family);
+        mixFontStyle(strut.getFontStyle());
+        mix(floatBits(strut.getFontSize()));
+        mix(floatBits(strut.getHeight()));
+        mix(floatBits(strut.getLeading()));
+        mix(strut.getForceStrutHeight());
+    }
+
+    for (const Block& block : paragraph->styles()) {
+        const TextStyle& style = block.fStyle;
+        if (style.isPlaceholder())
+            continue;
+        mix(block.fRange.start);
+        mix(block.fRange.end);
+        for (const SkString& family : style.getFontFamilies())
+            mixString(family);
+        for (const FontFeature& feature : style.getFontFeatures()) {
+            mixString(feature.fName);
+            mix(feature.fValue);
+        }
+        if (style.getFontArguments())
+            mix(std::hash<FontArguments>()(*style.getFontArguments()));
+        mixFontStyle(style.getFontStyle());
+        mix(floatBits(style.getFontSize()));
+        mix(floatBits(style.getHeight()));
+        mix(floatBits(style.getLetterSpacing()));
+        mix(floatBits(style.getWordSpacing()));
+        mixString(style.getLocale());
+    }
+
+    for (const Placeholder& placeholder : paragraph->placeholders()) {
+        if (placeholder.fRange.width() == 0)
+            continue;
+        mix(placeholder.fRange.start);
+        mix(floatBits(placeholder.fStyle.fWidth));
+        mix(floatBits(placeholder.fStyle.fHeight));
+        mix(static_cast<size_t>(placeholder.fStyle.fAlignment));
+        mix(floatBits(placeholder.fStyle.fBaselineOffset));
+        mix(static_cast<size_t>(placeholder.fStyle.fBaseline));
+    }
+    return h;
+}
+
+size_t ParagraphCacheMonitor::EstimateBytes(ParagraphImpl* paragraph) {
+    // Cache value copies runs, clusters and per code unit properties of the shaped text
+    size_t bytes = sizeof(Entry) + paragraph->text().size() * (1 + sizeof(size_t));
+    for (const Run& run : paragraph->runs())
+        bytes += sizeof(Run) + run.size() * (sizeof(SkGlyphID) + 2 * sizeof(SkPoint) + 2 * sizeof(uint32_t));
+    bytes += paragraph->clusters().size() * sizeof(Cluster);
+    return bytes;
+}
+
+void ParagraphCacheMonitor::check(ParagraphImpl* paragraph, const char* event) {
+    SkAutoMutexExclusive lock(fMutex);
+    if (strcmp(event, "foundParagraph") == 0) {
+        fHits++;
+        auto it = fIndex.find(Hash(paragraph));
+        if (it != fIndex.end()) {
+            fTimeSavedNanos += it->second->fShapeNanos;
+            fEntries.splice(fEntries.begin(), fEntries, it->second);
+        }
+    } else if (strcmp(event, "missingParagraph") == 0) {
+        fMisses++;
+        if (fShaping.size() >= kMaxShaping)
+            fShaping.clear();
+        fShaping[paragraph] = Clock::now();
+    } else if (strcmp(event, "addedParagraph") == 0) {
+        int64_t shapeNanos = 0;
+        auto shaping = fShaping.find(paragraph);
+        if (shaping != fShaping.end()) {
+            shapeNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - shaping->second).count();
+            fShaping.erase(shaping);
+        }
+
+        size_t hash = Hash(paragraph);
+        auto it = fIndex.find(hash);
+        if (it != fIndex.end())
+            evictLocked(it->second);
+        // Cache drops its least recently used entry when it reaches the entry count limit
+        while (!fEntries.empty() && fEntries.size() >= kMaxCacheEntries)
+            evictLocked(std::prev(fEntries.end()));
+
+        fEntries.push_front({ hash, EstimateBytes(paragraph), shapeNanos });
+        fIndex.emplace(hash, fEntries.begin());
+        fBytesUsed += fEntries.front().fBytes;
+        if (!fOverBudget && fByteBudget > 0 && fBytesUsed > fByteBudget) {
+            fOverBudget = true;
+            gOverBudgetCount++;
+        }
+    }
+}
+
+void ParagraphCacheMonitor::evictLocked(EntryList::iterator it) {
+    fEvictions++;
+    fBytesUsed -= it->fBytes;
+    fIndex.erase(it->fHash);
+    fEntries.erase(it);
+}
+
+// ParagraphCache has no way to drop single entries, so going over budget flushes all of them
+void ParagraphCacheMonitor::trimIfOverBudget() {
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        if (!fOverBudget)
+            return;
+    }
+    fCache->reset();
+    onReset();
+}
+
+void ParagraphCacheMonitor::setByteBudget(size_t byteBudget) {
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        fByteBudget = byteBudget;
+        if (fByteBudget == 0 || fBytesUsed <= fByteBudget)
+            return;
+    }
+    fCache->reset();
+    onReset();
+}
+
+ParagraphCacheMonitor::Stats ParagraphCacheMonitor::getStats() const {
+    SkAutoMutexExclusive lock(fMutex);
+    return {
+        fHits,
+        fMisses,
+        fEvictions,
+        static_cast<int64_t>(fCache->count()),
+        static_cast<int64_t>(fBytesUsed),
+        static_cast<int64_t>(fByteBudget),
+        fTimeSavedNanos
+    };
+}
+
+void ParagraphCacheMonitor::resetStats() {
+    SkAutoMutexExclusive lock(fMutex);
+    fHits = 0;
+    fMisses = 0;
+    fEvictions = 0;
+    fTimeSavedNanos = 0;
+}
+
+void ParagraphCacheMonitor::onReset() {
+    SkAutoMutexExclusive lock(fMutex);
+    fEvictions += fEntries.size();
+    fEntries.clear();
+    fIndex.clear();
+    fShaping.clear();
+    fBytesUsed = 0;
+    if (fOverBudget) {
+        fOverBudget = false;
+        gOverBudgetCount--;
+    }
+}
@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <vector>
+#include "ParagraphEdit.hh"
+#include "ParagraphBuilder.h"
+#include "mppinterop.h"
+#include "modules/skparagraph/src/ParagraphImpl.h"
+
+using namespace skia::textlayout;
+
+namespace skikoMpp {
+    namespace paragraph {
+        std::unique_ptr<Paragraph> rebuildWithText(Paragraph* paragraph, uint32_t from, uint32_t to, const SkString& text,
+                                                   SkString* newText) {
+            // ParagraphBuilder only ever makes ParagraphImpl
+            ParagraphImpl* impl = static_cast<ParagraphImpl*>(paragraph);
+
+            SkSpan<const char> oldText = impl->text();
+            skija::UtfIndicesConverter conv(oldText.data(), oldText.size());
+            size_t from8 = conv.from16To8(from);
+            size_t to8 = std::max(from8, conv.from16To8(to));
+            size_t insertEnd8 = from8 + text.size();
+
+            newText->reset();
+            newText->append(oldText.data(), from8);
+            newText->append(text);
+            newText->append(oldText.data() + to8, oldText.size() - to8);
+
+            // Offsets before the edit stay, offsets after it move by the length difference,
+            // offsets inside the replaced range collapse to the end of the inserted text
+            auto map = [&](size_t i8) {
+                if (i8 < from8) return i8;
+                if (i8 >= to8) return i8 - to8 + insertEnd8;
+                return insertEnd8;
+            };
+
+            std::unique_ptr<ParagraphBuilder> builder = ParagraphBuilder::make(impl->paragraphStyle(), impl->fontCollection());
+            auto addText = [&](const TextStyle& style, size_t start, size_t end) {
+                if (end <= start)
+                    return;
+                builder->pushStyle(style);
+                builder->addText(newText->c_str() + start, end - start);
+                builder->pop();
+            };
+
+            // Blocks are split around the placeholders inside them. The builder gives every
+            // replacement character a block of its own, but nothing here relies on that. It also
+            // appends an empty sentinel placeholder, which is skipped.
+            struct Piece {
+                size_t fStart;
+                size_t fEnd;
+                const TextStyle* fStyle;
+                const Placeholder* fPlaceholder;
+            };
+            std::vector<Piece> pieces;
+            auto placeholders = impl->placeholders();
+            size_t nextPlaceholder = 0;
+            for (const Block& block : impl->styles()) {
+                size_t start = block.fRange.start;
+                while (nextPlaceholder < placeholders.size() && placeholders[nextPlaceholder].fRange.end <= block.fRange.end) {
+                    const Placeholder& placeholder = placeholders[nextPlaceholder++];
+                    if (placeholder.fRange.width() == 0 || placeholder.fRange.start < start)
+                        continue;
+                    if (start < placeholder.fRange.start)
+                        pieces.push_back({ start, placeholder.fRange.start, &block.fStyle, nullptr });
+                    pieces.push_back({ placeholder.fRange.start, placeholder.fRange.end, &block.fStyle, &placeholder });
+                    start = placeholder.fRange.end;
+                }
+                if (start < block.fRange.end)
+                    pieces.push_back({ start, block.fRange.end, &block.fStyle, nullptr });
+            }
+
+            bool inserted = text.isEmpty();
+            for (const Piece& piece : pieces) {
+                // Inserted text continues the piece of the preceding character, or the first piece
+                bool first = !inserted && from8 == 0;
+                bool owner = !inserted && piece.fStart < from8 && from8 <= piece.fEnd;
+
+                if (!piece.fPlaceholder) {
+                    addText(*piece.fStyle, first || owner ? piece.fStart : map(piece.fStart), map(piece.fEnd));
+                    inserted = inserted || first || owner;
+                    continue;
+                }
+
+                if (first) {
+                    addText(*piece.fStyle, 0, insertEnd8);
+                    inserted = true;
+                }
+                if (piece.fEnd <= from8 || piece.fStart >= to8) {
+                    builder->pushStyle(piece.fPlaceholder->fTextStyle);
+                    builder->addPlaceholder(piece.fPlaceholder->fStyle);
+                    builder->pop();
+                }
+                if (owner) {
+                    addText(*piece.fStyle, from8, insertEnd8);
+                    inserted = true;
+                }
+            }
+            if (!inserted)
+                builder->addText(text.c_str(), text.size());
+            return builder->Build();
+        }
+    }
+}
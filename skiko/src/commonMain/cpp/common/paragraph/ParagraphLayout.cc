@@ -0,0 +1,87 @@
+#include <optional>
+#include <unordered_set>
+#include <vector>
+#include "ParagraphLayout.hh"
+#include "ParagraphCacheMonitor.hh"
+#include "Parallel.hh"
+#include "FontCollection.h"
+#include "modules/skparagraph/src/ParagraphImpl.h"
+
+using namespace skia::textlayout;
+
+namespace skikoMpp {
+    namespace paragraph {
+        namespace {
+            // Below this many paragraphs dispatching to the pool costs more than it saves
+            const int kMinParallelCount = 4;
+
+            struct FontLookup {
+                FontCollection* fCollection;
+                std::vector<SkString> fFamilies;
+                SkFontStyle fStyle;
+                std::optional<FontArguments> fFontArguments;
+
+                bool operator==(const FontLookup& other) const {
+                    return fCollection == other.fCollection && fStyle == other.fStyle && fFamilies == other.fFamilies
+                        && fFontArguments == other.fFontArguments;
+                }
+            };
+
+            struct FontLookupHash {
+                size_t operator()(const FontLookup& lookup) const {
+                    size_t hash = std::hash<const void*>()(lookup.fCollection);
+                    hash = hash * 31 + std::hash<int>()(lookup.fStyle.weight() << 8 | lookup.fStyle.width() << 4 | lookup.fStyle.slant());
+                    for (const SkString& family : lookup.fFamilies)
+                        hash = hash * 31 + std::hash<std::string>()(std::string(family.c_str(), family.size()));
+                    if (lookup.fFontArguments)
+                        hash = hash * 31 + std::hash<FontArguments>()(*lookup.fFontArguments);
+                    return hash;
+                }
+            };
+
+            // Same lookup the shaper makes for style, FontCollection keys its cache on font arguments too
+            void warmUp(std::unordered_set<FontLookup, FontLookupHash>& seen, FontCollection* collection,
+                        const TextStyle& style) {
+                FontLookup lookup { collection, style.getFontFamilies(), style.getFontStyle(), style.getFontArguments() };
+                if (seen.insert(lookup).second)
+                    collection->findTypefaces(lookup.fFamilies, lookup.fStyle, lookup.fFontArguments);
+            }
+        }
+
+        void layoutAll(Paragraph* const* paragraphs, const float* widths, int count) {
+            if (count < kMinParallelCount || parallel::threadCount() < 2) {
+                for (int i = 0; i < count; ++i) {
+                    paragraphs[i]->layout(widths[i]);
+                    ParagraphCacheMonitor::EnforceBudget(paragraphs[i]);
+                }
+                return;
+            }
+
+            std::unordered_set<FontLookup, FontLookupHash> seen;
+            for (int i = 0; i < count; ++i) {
+                // ParagraphBuilder only ever makes ParagraphImpl
+                ParagraphImpl* impl = static_cast<ParagraphImpl*>(paragraphs[i]);
+                FontCollection* collection = impl->fontCollection().get();
+                const ParagraphStyle& paragraphStyle = impl->paragraphStyle();
+                warmUp(seen, collection, paragraphStyle.getTextStyle());
+                if (paragraphStyle.getStrutStyle().getStrutEnabled()) {
+                    const StrutStyle& strut = paragraphStyle.getStrutStyle();
+                    FontLookup lookup { collection, strut.getFontFamilies(), strut.getFontStyle(), std::nullopt };
+                    if (seen.insert(lookup).second)
+                        collection->findTypefaces(lookup.fFamilies, lookup.fStyle);
+                }
+                for (const Block& block : impl->styles())
+                    warmUp(seen, collection, block.fStyle);
+                // Placeholder styles are shaped for their metrics too
+                for (const Placeholder& placeholder : impl->placeholders())
+                    warmUp(seen, collection, placeholder.fTextStyle);
+            }
+
+            parallel::forEach(count, [&](int i) {
+                paragraphs[i]->layout(widths[i]);
+            });
+            for (int i = 0; i < count; ++i)
+                ParagraphCacheMonitor::EnforceBudget(paragraphs[i]);
+        }
+    }
+}
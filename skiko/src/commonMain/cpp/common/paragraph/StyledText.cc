@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <set>
+#include <vector>
+#include "StyledText.hh"
+#include "mppinterop.h"
+
+using namespace skia::textlayout;
+
+namespace skikoMpp {
+    namespace paragraph {
+        void addStyledText(ParagraphBuilder* builder, const SkString& text,
+                           const int* starts, const int* ends,
+                           const TextStyle* const* styles, int count) {
+            if (count == 0) {
+                builder->addText(text.c_str(), text.size());
+                return;
+            }
+
+            // Span i starts at event 2 * i and ends at 2 * i + 1, ends go before starts at the same index
+            std::vector<std::pair<int, int>> events;
+            events.reserve(count * 2);
+            for (int i = 0; i < count; ++i) {
+                events.emplace_back(starts[i], i * 2);
+                events.emplace_back(ends[i], i * 2 + 1);
+            }
+            std::sort(events.begin(), events.end(), [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+                if (a.first != b.first)
+                    return a.first < b.first;
+                return (a.second & 1) > (b.second & 1);
+            });
+
+            skija::UtfIndicesConverter conv(text);
+            std::set<int> active;
+            size_t start8 = 0;
+            auto addSegment = [&](size_t end8) {
+                if (end8 <= start8)
+                    return;
+                if (active.empty()) {
+                    builder->addText(text.c_str() + start8, end8 - start8);
+                } else {
+                    builder->pushStyle(*styles[*active.rbegin()]);
+                    builder->addText(text.c_str() + start8, end8 - start8);
+                    builder->pop();
+                }
+                start8 = end8;
+            };
+
+            for (const auto& event : events) {
+                addSegment(conv.from16To8(event.first));
+                int span = event.second / 2;
+                if (event.second & 1)
+                    active.erase(span);
+                else if (starts[span] < ends[span])
+                    active.insert(span);
+            }
+            addSegment(text.size());
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#include <cmath>
+#include "FrameCapture.hh"
+#include "SkImage.h"
+#include "SkSerialProcs.h"
+#include "SkTypeface.h"
+
+namespace {
+    sk_sp<SkData> serializeTypeface(SkTypeface* typeface, void*) {
+        return typeface->serialize(SkTypeface::SerializeBehavior::kDoIncludeData);
+    }
+
+    sk_sp<SkData> serializeImage(SkImage* image, void*) {
+        if (sk_sp<SkData> encoded = image->refEncodedData())
+            return encoded;
+        sk_sp<SkImage> raster = image->makeRasterImage();
+        if (!raster)
+            return nullptr;
+        return raster->encodeToData(SkEncodedImageFormat::kPNG, 100);
+    }
+}
+
+FrameCapture::FrameCapture(): fTarget(nullptr), fTargetSaveCount(0) {}
+
+SkCanvas* FrameCapture::beginCapture(SkCanvas* target, const SkRect& bounds) {
+    if (fTee)
+        return fTee.get();
+    int width = static_cast<int>(std::ceil(bounds.right()));
+    int height = static_cast<int>(std::ceil(bounds.bottom()));
+    fTee.reset(new SkNWayCanvas(width, height));
+    fTarget = target;
+    if (target) {
+        // Tee forwards transforms and clips of the frame to target, they are undone on finish
+        fTargetSaveCount = target->save();
+        fTee->addCanvas(target);
+    }
+    fTee->addCanvas(fRecorder.beginRecording(bounds));
+    return fTee.get();
+}
+
+sk_sp<SkPicture> FrameCapture::finishCapture() {
+    if (!fTee)
+        return nullptr;
+    fTee->restoreToCount(1);
+    if (fTarget)
+        fTarget->restoreToCount(fTargetSaveCount);
+    fTee->removeAll();
+    fTarget = nullptr;
+    fTee.reset();
+    return fRecorder.finishRecordingAsPicture();
+}
+
+sk_sp<SkData> FrameCapture::Serialize(const SkPicture* picture) {
+    SkSerialProcs procs;
+    procs.fTypefaceProc = serializeTypeface;
+    procs.fImageProc = serializeImage;
+    return picture->serialize(&procs);
+}
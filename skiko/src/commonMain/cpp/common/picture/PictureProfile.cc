@@ -0,0 +1,399 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include "PictureProfile.hh"
+#include "SkCanvas.h"
+#include "SkDrawable.h"
+#include "SkOverdrawCanvas.h"
+#include "SkRRect.h"
+#include "SkRegion.h"
+#include "SkStream.h"
+#include "SkTextBlob.h"
+#include "SkVertices.h"
+#include "include/utils/SkNWayCanvas.h"
+#include "src/utils/SkJSONWriter.h"
+
+namespace {
+    const char* kOpNames[PictureProfile::kOpTypeCount] = {
+        "save",
+        "saveLayer",
+        "restore",
+        "clipRect",
+        "clipRRect",
+        "clipPath",
+        "clipShader",
+        "clipRegion",
+        "drawPaint",
+        "drawBehind",
+        "drawRect",
+        "drawRRect",
+        "drawDRRect",
+        "drawOval",
+        "drawArc",
+        "drawPath",
+        "drawRegion",
+        "drawTextBlob",
+        "drawPatch",
+        "drawPoints",
+        "drawImage",
+        "drawImageRect",
+        "drawImageLattice",
+        "drawAtlas",
+        "drawEdgeAAImageSet",
+        "drawVertices",
+        "drawAnnotation",
+        "drawShadow",
+        "drawDrawable",
+        "drawPicture",
+        "drawEdgeAAQuad"
+    };
+
+    int64_t nowNanos() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Forwards every op to the raster canvas and records how long it took. Matrix changes
+    // are forwarded too, but they are cheap enough not to be worth listing.
+    class ProfilingCanvas : public SkNWayCanvas {
+    public:
+        ProfilingCanvas(SkCanvas* target, std::vector<PictureProfile::Op>* ops)
+            : SkNWayCanvas(target->imageInfo().width(), target->imageInfo().height())
+            , fOps(ops) {
+            this->addCanvas(target);
+        }
+
+    private:
+        class AutoOp {
+        public:
+            AutoOp(ProfilingCanvas* canvas, PictureProfile::OpType type, const SkRect* bounds = nullptr, const SkPaint* paint = nullptr)
+                : fCanvas(canvas)
+                , fType(type)
+                , fBounds(canvas->deviceBounds(bounds, paint))
+                , fStartNanos(nowNanos()) {}
+
+            ~AutoOp() {
+                fCanvas->fOps->push_back({ fType, fBounds, nowNanos() - fStartNanos });
+            }
+
+        private:
+            ProfilingCanvas* fCanvas;
+            PictureProfile::OpType fType;
+            SkIRect fBounds;
+            int64_t fStartNanos;
+        };
+
+        // Ops without local bounds, or whose paint can't bound them, are assumed to cover the clip
+        SkIRect deviceBounds(const SkRect* bounds, const SkPaint* paint) {
+            SkIRect clip = this->getDeviceClipBounds();
+            if (bounds == nullptr)
+                return clip;
+            SkRect local = *bounds;
+            if (paint) {
+                if (!paint->canComputeFastBounds())
+                    return clip;
+                SkRect storage;
+                local = paint->computeFastBounds(local, &storage);
+            }
+            SkIRect device = this->getTotalMatrix().mapRect(local).roundOut();
+            if (!device.intersect(clip))
+                return SkIRect::MakeEmpty();
+            return device;
+        }
+
+        void recordContainer(PictureProfile::OpType type, const SkRect* bounds) {
+            fOps->push_back({ type, this->deviceBounds(bounds, nullptr), 0 });
+        }
+
+        void willSave() override {
+            AutoOp op(this, PictureProfile::kSave);
+            SkNWayCanvas::willSave();
+        }
+
+        SaveLayerStrategy getSaveLayerStrategy(const SaveLayerRec& rec) override {
+            AutoOp op(this, PictureProfile::kSaveLayer, rec.fBounds, rec.fPaint);
+            return SkNWayCanvas::getSaveLayerStrategy(rec);
+        }
+
+        void willRestore() override {
+            AutoOp op(this, PictureProfile::kRestore);
+            SkNWayCanvas::willRestore();
+        }
+
+        void onClipRect(const SkRect& rect, SkClipOp clipOp, ClipEdgeStyle edgeStyle) override {
+            AutoOp op(this, PictureProfile::kClipRect, &rect);
+            SkNWayCanvas::onClipRect(rect, clipOp, edgeStyle);
+        }
+
+        void onClipRRect(const SkRRect& rrect, SkClipOp clipOp, ClipEdgeStyle edgeStyle) override {
+            AutoOp op(this, PictureProfile::kClipRRect, &rrect.getBounds());
+            SkNWayCanvas::onClipRRect(rrect, clipOp, edgeStyle);
+        }
+
+        void onClipPath(const SkPath& path, SkClipOp clipOp, ClipEdgeStyle edgeStyle) override {
+            AutoOp op(this, PictureProfile::kClipPath, path.isInverseFillType() ? nullptr : &path.getBounds());
+            SkNWayCanvas::onClipPath(path, clipOp, edgeStyle);
+        }
+
+        void onClipShader(sk_sp<SkShader> shader, SkClipOp clipOp) override {
+            AutoOp op(this, PictureProfile::kClipShader);
+            SkNWayCanvas::onClipShader(std::move(shader), clipOp);
+        }
+
+        void onClipRegion(const SkRegion& deviceRgn, SkClipOp clipOp) override {
+            AutoOp op(this, PictureProfile::kClipRegion);
+            SkNWayCanvas::onClipRegion(deviceRgn, clipOp);
+        }
+
+        void onDrawPaint(const SkPaint& paint) override {
+            AutoOp op(this, PictureProfile::kDrawPaint);
+            SkNWayCanvas::onDrawPaint(paint);
+        }
+
+        void onDrawBehind(const SkPaint& paint) override {
+            AutoOp op(this, PictureProfile::kDrawBehind);
+            SkNWayCanvas::onDrawBehind(paint);
+        }
+
+        void onDrawRect(const SkRect& rect, const SkPaint& paint) override {
+            AutoOp op(this, PictureProfile::kDrawRect, &rect, &paint);
+            SkNWayCanvas::onDrawRect(rect, paint);
+        }
+
+        void onDrawRRect(const SkRRect& rrect, const SkPaint& paint) override {
+            AutoOp op(this, PictureProfile::kDrawRRect, &rrect.getBounds(), &paint);
+            SkNWayCanvas::onDrawRRect(rrect, paint);
+        }
+
+        void onDrawDRRect(const SkRRect& outer, const SkRRect& inner, const SkPaint& paint) override {
+            AutoOp op(this, PictureProfile::kDrawDRRect, &outer.getBounds(), &paint);
+            SkNWayCanvas::onDrawDRRect(outer, inner, paint);
+        }
+
+        void onDrawOval(const SkRect& rect, const SkPaint& paint) override {
+            AutoOp op(this, PictureProfile::kDrawOval, &rect, &paint);
+            SkNWayCanvas::onDrawOval(rect, paint);
+        }
+
+        void onDrawArc(const SkRect& rect, SkScalar startAngle, SkScalar sweepAngle, bool useCenter, const SkPaint& paint) override {
+            AutoOp op(this, PictureProfile::kDrawArc, &rect, &paint);
+            SkNWayCanvas::onDrawArc(rect, startAngle, sweepAngle, useCenter, paint);
+        }
+
+        void onDrawPath(const SkPath& path, const SkPaint& paint) override {
+            AutoOp op(this, PictureProfile::kDrawPath, path.isInverseFillType() ? nullptr : &path.getBounds(), &paint);
+            SkNWayCanvas::onDrawPath(path, paint);
+        }
+
+        void onDrawRegion(const SkRegion& region, const SkPaint& paint) override {
+            SkRect bounds = SkRect::Make(region.getBounds());
+            AutoOp op(this, PictureProfile::kDrawRegion, &bounds, &paint);
+            SkNWayCanvas::onDrawRegion(region, paint);
+        }
+
+        void onDrawTextBlob(const SkTextBlob* blob, SkScalar x, SkScalar y, const SkPaint& paint) override {
+            SkRect bounds = blob->bounds().makeOffset(x, y);
+            AutoOp op(this, PictureProfile::kDrawTextBlob, &bounds, &paint);
+            SkNWayCanvas::onDrawTextBlob(blob, x, y, paint);
+        }
+
+        void onDrawPatch(const SkPoint cubics[12], const SkColor colors[4], const SkPoint texCoords[4], SkBlendMode mode, const SkPaint& paint) override {
+            SkRect bounds;
+            bounds.setBounds(cubics, 12);
+            AutoOp op(this, PictureProfile::kDrawPatch, &bounds, &paint);
+            SkNWayCanvas::onDrawPatch(cubics, colors, texCoords, mode, paint);
+        }
+
+        void onDrawPoints(PointMode mode, size_t count, const SkPoint pts[], const SkPaint& paint) override {
+            SkRect bounds;
+            bounds.setBounds(pts, static_cast<int>(count));
+            AutoOp op(this, PictureProfile::kDrawPoints, &bounds, &paint);
+            SkNWayCanvas::onDrawPoints(mode, count, pts, paint);
+        }
+
+        void onDrawImage2(const SkImage* image, SkScalar x, SkScalar y, const SkSamplingOptions& sampling, const SkPaint* paint) override {
+            SkRect bounds = SkRect::MakeXYWH(x, y, image->width(), image->height());
+            AutoOp op(this, PictureProfile::kDrawImage, &bounds, paint);
+            SkNWayCanvas::onDrawImage2(image, x, y, sampling, paint);
+        }
+
+        void onDrawImageRect2(const SkImage* image, const SkRect& src, const SkRect& dst, const SkSamplingOptions& sampling,
+                              const SkPaint* paint, SrcRectConstraint constraint) override {
+            AutoOp op(this, PictureProfile::kDrawImageRect, &dst, paint);
+            SkNWayCanvas::onDrawImageRect2(image, src, dst, sampling, paint, constraint);
+        }
+
+        void onDrawImageLattice2(const SkImage* image, const Lattice& lattice, const SkRect& dst, SkFilterMode filter,
+                                 const SkPaint* paint) override {
+            AutoOp op(this, PictureProfile::kDrawImageLattice, &dst, paint);
+            SkNWayCanvas::onDrawImageLattice2(image, lattice, dst, filter, paint);
+        }
+
+        void onDrawAtlas2(const SkImage* atlas, const SkRSXform xforms[], const SkRect tex[], const SkColor colors[], int count,
+                          SkBlendMode mode, const SkSamplingOptions& sampling, const SkRect* cull, const SkPaint* paint) override {
+            AutoOp op(this, PictureProfile::kDrawAtlas, cull, paint);
+            SkNWayCanvas::onDrawAtlas2(atlas, xforms, tex, colors, count, mode, sampling, cull, paint);
+        }
+
+        void onDrawEdgeAAImageSet2(const ImageSetEntry set[], int count, const SkPoint dstClips[], const SkMatrix preViewMatrices[],
+                                   const SkSamplingOptions& sampling, const SkPaint* paint, SrcRectConstraint constraint) override {
+            AutoOp op(this, PictureProfile::kDrawEdgeAAImageSet);
+            SkNWayCanvas::onDrawEdgeAAImageSet2(set, count, dstClips, preViewMatrices, sampling, paint, constraint);
+        }
+
+        void onDrawVerticesObject(const SkVertices* vertices, SkBlendMode mode, const SkPaint& paint) override {
+            AutoOp op(this, PictureProfile::kDrawVertices, &vertices->bounds(), &paint);
+            SkNWayCanvas::onDrawVerticesObject(vertices, mode, paint);
+        }
+
+        void onDrawAnnotation(const SkRect& rect, const char key[], SkData* value) override {
+            AutoOp op(this, PictureProfile::kDrawAnnotation, &rect);
+            SkNWayCanvas::onDrawAnnotation(rect, key, value);
+        }
+
+        // Shadows may extend far beyond the path, so they are assumed to cover the clip
+        void onDrawShadowRec(const SkPath& path, const SkDrawShadowRec& rec) override {
+            AutoOp op(this, PictureProfile::kDrawShadow);
+            SkNWayCanvas::onDrawShadowRec(path, rec);
+        }
+
+        void onDrawEdgeAAQuad(const SkRect& rect, const SkPoint clip[4], QuadAAFlags aaFlags, const SkColor4f& color,
+                              SkBlendMode mode) override {
+            AutoOp op(this, PictureProfile::kDrawEdgeAAQuad, &rect);
+            SkNWayCanvas::onDrawEdgeAAQuad(rect, clip, aaFlags, color, mode);
+        }
+
+        // Nested content is played back through this canvas, so its ops are profiled one by one
+        void onDrawDrawable(SkDrawable* drawable, const SkMatrix* matrix) override {
+            SkRect bounds = drawable->getBounds();
+            if (matrix)
+                matrix->mapRect(&bounds);
+            this->recordContainer(PictureProfile::kDrawDrawable, &bounds);
+            SkCanvas::onDrawDrawable(drawable, matrix);
+        }
+
+        void onDrawPicture(const SkPicture* picture, const SkMatrix* matrix, const SkPaint* paint) override {
+            SkRect bounds = picture->cullRect();
+            if (matrix)
+                matrix->mapRect(&bounds);
+            this->recordContainer(PictureProfile::kDrawPicture, &bounds);
+            SkCanvas::onDrawPicture(picture, matrix, paint);
+        }
+
+        std::vector<PictureProfile::Op>* fOps;
+    };
+}
+
+PictureProfile::PictureProfile(const SkPicture* picture, int width, int height)
+    : fMaxOverdraw(0)
+    , fAverageOverdraw(0) {
+    for (int i = 0; i < kOpTypeCount; ++i) {
+        fCounts[i] = 0;
+        fNanos[i] = 0;
+    }
+    if (picture == nullptr || width <= 0 || height <= 0)
+        return;
+
+    SkBitmap target;
+    if (!target.tryAllocN32Pixels(width, height))
+        return;
+    target.eraseColor(SK_ColorTRANSPARENT);
+    SkCanvas targetCanvas(target);
+    ProfilingCanvas profilingCanvas(&targetCanvas, &fOps);
+    picture->playback(&profilingCanvas);
+
+    for (const Op& op : fOps) {
+        fCounts[op.fType]++;
+        fNanos[op.fType] += op.fNanos;
+    }
+
+    if (!fOverdraw.tryAllocPixels(SkImageInfo::MakeA8(width, height)))
+        return;
+    fOverdraw.eraseColor(SK_ColorTRANSPARENT);
+    SkCanvas overdrawTarget(fOverdraw);
+    SkOverdrawCanvas overdrawCanvas(&overdrawTarget);
+    picture->playback(&overdrawCanvas);
+
+    int64_t sum = 0;
+    for (int y = 0; y < height; ++y) {
+        const uint8_t* row = fOverdraw.getAddr8(0, y);
+        for (int x = 0; x < width; ++x) {
+            sum += row[x];
+            fMaxOverdraw = std::max(fMaxOverdraw, static_cast<int>(row[x]));
+        }
+    }
+    fAverageOverdraw = static_cast<double>(sum) / (static_cast<int64_t>(width) * height);
+}
+
+const char* PictureProfile::OpName(OpType type) {
+    return kOpNames[type];
+}
+
+int64_t PictureProfile::totalNanos() const {
+    int64_t total = 0;
+    for (int i = 0; i < kOpTypeCount; ++i)
+        total += fNanos[i];
+    return total;
+}
+
+SkString PictureProfile::toJson(bool includeOps) const {
+    SkDynamicMemoryWStream stream;
+    {
+        SkJSONWriter writer(&stream, SkJSONWriter::Mode::kPretty);
+        writer.beginObject();
+        writer.appendS32("width", width());
+        writer.appendS32("height", height());
+        writer.appendS32("opCount", static_cast<int32_t>(fOps.size()));
+        writer.appendDouble("totalMicros", totalNanos() / 1000.0);
+
+        writer.beginArray("histogram");
+        for (int i = 0; i < kOpTypeCount; ++i) {
+            if (fCounts[i] == 0)
+                continue;
+            writer.beginObject(nullptr, false);
+            writer.appendString("op", kOpNames[i]);
+            writer.appendS32("count", fCounts[i]);
+            writer.appendDouble("micros", fNanos[i] / 1000.0);
+            writer.endObject();
+        }
+        writer.endArray();
+
+        writer.beginObject("overdraw");
+        writer.appendS32("max", fMaxOverdraw);
+        writer.appendDouble("average", fAverageOverdraw);
+        // Number of pixels drawn exactly N times, for N from 0 to max
+        std::vector<int32_t> pixels(fMaxOverdraw + 1, 0);
+        for (int y = 0; y < fOverdraw.height(); ++y) {
+            const uint8_t* row = fOverdraw.getAddr8(0, y);
+            for (int x = 0; x < fOverdraw.width(); ++x)
+                pixels[row[x]]++;
+        }
+        writer.beginArray("pixels", false);
+        for (int32_t count : pixels)
+            writer.appendS32(count);
+        writer.endArray();
+        writer.endObject();
+
+        if (includeOps) {
+            writer.beginArray("ops");
+            for (const Op& op : fOps) {
+                writer.beginObject(nullptr, false);
+                writer.appendString("op", kOpNames[op.fType]);
+                writer.beginArray("bounds", false);
+                writer.appendS32(op.fBounds.left());
+                writer.appendS32(op.fBounds.top());
+                writer.appendS32(op.fBounds.right());
+                writer.appendS32(op.fBounds.bottom());
+                writer.endArray();
+                writer.appendDouble("micros", op.fNanos / 1000.0);
+                writer.endObject();
+            }
+            writer.endArray();
+        }
+
+        writer.endObject();
+        writer.flush();
+    }
+    sk_sp<SkData> data = stream.detachAsData();
+    return SkString(static_cast<const char*>(data->data()), data->size());
+}
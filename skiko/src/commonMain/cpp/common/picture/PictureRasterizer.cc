@@ -0,0 +1,60 @@
+#include <algorithm>
+#include <atomic>
+#include "Parallel.hh"
+#include "PictureRasterizer.hh"
+#include "SkCanvas.h"
+
+namespace skikoMpp {
+    namespace picture {
+        namespace {
+            const int kTileAlignment = 16;
+
+            void rasterizeTile(const SkPicture* picture, const SkPixmap& dst, const SkMatrix* matrix, const SkIRect& tile) {
+                SkPixmap tilePixels;
+                if (!dst.extractSubset(&tilePixels, tile))
+                    return;
+                std::unique_ptr<SkCanvas> canvas = SkCanvas::MakeRasterDirect(tilePixels.info(), tilePixels.writable_addr(), tilePixels.rowBytes());
+                if (!canvas)
+                    return;
+                canvas->translate(-tile.left(), -tile.top());
+                if (matrix)
+                    canvas->concat(*matrix);
+                canvas->drawPicture(picture);
+            }
+        }
+
+        bool rasterizeTiled(const SkPicture* picture, const SkPixmap& dst, const SkMatrix* matrix, int tileSize, int maxThreads) {
+            if (picture == nullptr || dst.addr() == nullptr || dst.width() <= 0 || dst.height() <= 0)
+                return false;
+            // Same validation raster surfaces do, so unsupported color types fail up front
+            if (!SkCanvas::MakeRasterDirect(dst.info(), dst.writable_addr(), dst.rowBytes()))
+                return false;
+
+            if (tileSize <= 0)
+                tileSize = kDefaultTileSize;
+            tileSize = (tileSize + kTileAlignment - 1) / kTileAlignment * kTileAlignment;
+
+            int columns = (dst.width() + tileSize - 1) / tileSize;
+            int rows = (dst.height() + tileSize - 1) / tileSize;
+            int tileCount = columns * rows;
+
+            int workers = parallel::threadCount();
+            if (maxThreads > 0)
+                workers = std::min(workers, maxThreads);
+            workers = std::min(workers, tileCount);
+
+            // Workers pull tiles in row-major order, so uneven tiles don't leave threads idle
+            std::atomic<int> nextTile(0);
+            parallel::forEach(workers, [&](int) {
+                for (int i = nextTile++; i < tileCount; i = nextTile++) {
+                    int x = (i % columns) * tileSize;
+                    int y = (i / columns) * tileSize;
+                    SkIRect tile = SkIRect::MakeXYWH(x, y, tileSize, tileSize);
+                    tile.intersect(dst.bounds());
+                    rasterizeTile(picture, dst, matrix, tile);
+                }
+            });
+            return true;
+        }
+    }
+}
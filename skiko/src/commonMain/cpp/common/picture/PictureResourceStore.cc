@@ -0,0 +1,318 @@
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <vector>
+#include "PictureResourceStore.hh"
+#include "SkStream.h"
+#include "src/core/SkOpts.h"
+
+namespace {
+    // Resource stored in the side-store, followed by 64-bit content id
+    const uint32_t kReferenceTag = SkSetFourByteTag('s', 'k', 'R', 'r');
+    // Resource embedded in the picture because its id collided with different content,
+    // followed by 32-bit size and the serialized resource
+    const uint32_t kInlineTag = SkSetFourByteTag('s', 'k', 'R', 'i');
+    const uint32_t kStoreTag = SkSetFourByteTag('s', 'k', 'R', 's');
+    const uint32_t kStoreVersion = 1;
+    const size_t kReferenceSize = 12;
+
+    sk_sp<SkData> makeReference(uint64_t id) {
+        uint32_t record[3] = { kReferenceTag, static_cast<uint32_t>(id >> 32), static_cast<uint32_t>(id) };
+        return SkData::MakeWithCopy(record, sizeof(record));
+    }
+
+    sk_sp<SkData> makeInline(const SkData* data) {
+        sk_sp<SkData> record = SkData::MakeUninitialized(8 + data->size());
+        uint32_t header[2] = { kInlineTag, static_cast<uint32_t>(data->size()) };
+        memcpy(record->writable_data(), header, sizeof(header));
+        memcpy(static_cast<uint8_t*>(record->writable_data()) + 8, data->data(), data->size());
+        return record;
+    }
+
+    sk_sp<SkData> encodeImage(SkImage* image) {
+        if (sk_sp<SkData> encoded = image->refEncodedData())
+            return encoded;
+        sk_sp<SkImage> raster = image->makeRasterImage();
+        if (!raster)
+            return nullptr;
+        return raster->encodeToData(SkEncodedImageFormat::kPNG, 100);
+    }
+
+    bool readU64(SkStream* stream, uint64_t* value) {
+        uint32_t hi, lo;
+        if (!stream->readU32(&hi) || !stream->readU32(&lo))
+            return false;
+        *value = (static_cast<uint64_t>(hi) << 32) | lo;
+        return true;
+    }
+
+    bool isRecordTag(uint32_t tag) {
+        return tag == kReferenceTag || tag == kInlineTag;
+    }
+
+    // Reads next word without consuming it, false if stream can neither peek nor move back
+    bool peekU32(SkStream* stream, uint32_t* value) {
+        if (stream->peek(value, sizeof(*value)) == sizeof(*value))
+            return true;
+        if (!stream->hasPosition())
+            return false;
+        size_t position = stream->getPosition();
+        bool read = stream->readU32(value);
+        return stream->seek(position) && read;
+    }
+
+    // Reads size bytes without trusting size for the allocation, streams of unknown length are read in chunks
+    bool readTail(SkStream* stream, size_t size, std::vector<uint8_t>* out) {
+        if (stream->hasLength() && stream->hasPosition()) {
+            size_t remaining = stream->getLength() - std::min(stream->getLength(), stream->getPosition());
+            if (size > remaining)
+                return false;
+        }
+        const size_t kChunk = 64 * 1024;
+        while (size > 0) {
+            size_t chunk = std::min(size, kChunk);
+            size_t offset = out->size();
+            out->resize(offset + chunk);
+            if (stream->read(out->data() + offset, chunk) != chunk)
+                return false;
+            size -= chunk;
+        }
+        return true;
+    }
+
+    void writeU64(SkWStream* stream, uint64_t value) {
+        stream->write32(static_cast<uint32_t>(value >> 32));
+        stream->write32(static_cast<uint32_t>(value));
+    }
+}
+
+PictureResourceStore::PictureResourceStore()
+    : fReferences(0)
+    , fStoredBytes(0)
+    , fReferencedBytes(0)
+{
+}
+
+uint64_t PictureResourceStore::HashOf(const SkData* data) {
+    uint32_t hi = SkOpts::hash(data->data(), data->size(), 0);
+    uint32_t lo = SkOpts::hash(data->data(), data->size(), 0x9E3779B9);
+    return (static_cast<uint64_t>(hi) << 32) | lo;
+}
+
+SkSerialProcs PictureResourceStore::serialProcs() {
+    SkSerialProcs procs;
+    procs.fTypefaceProc = SerializeTypeface;
+    procs.fTypefaceCtx = this;
+    procs.fImageProc = SerializeImage;
+    procs.fImageCtx = this;
+    return procs;
+}
+
+SkDeserialProcs PictureResourceStore::deserialProcs() {
+    SkDeserialProcs procs;
+    procs.fTypefaceProc = DeserializeTypeface;
+    procs.fTypefaceCtx = this;
+    procs.fImageProc = DeserializeImage;
+    procs.fImageCtx = this;
+    return procs;
+}
+
+sk_sp<SkData> PictureResourceStore::findReference(EntryMap& entries, std::unordered_map<uint32_t, uint64_t>& ids, uint32_t uniqueID) {
+    SkAutoMutexExclusive lock(fMutex);
+    auto it = ids.find(uniqueID);
+    if (it == ids.end())
+        return nullptr;
+    fReferences++;
+    fReferencedBytes += entries[it->second].fData->size();
+    return makeReference(it->second);
+}
+
+sk_sp<SkData> PictureResourceStore::put(EntryMap& entries, std::unordered_map<uint32_t, uint64_t>& ids, uint32_t uniqueID, sk_sp<SkData> data) {
+    uint64_t id = HashOf(data.get());
+    SkAutoMutexExclusive lock(fMutex);
+    auto it = entries.find(id);
+    if (it == entries.end()) {
+        fStoredBytes += data->size();
+        entries[id].fData = data;
+    } else if (!it->second.fData->equals(data.get())) {
+        return makeInline(data.get());
+    }
+    ids[uniqueID] = id;
+    fReferences++;
+    fReferencedBytes += data->size();
+    return makeReference(id);
+}
+
+sk_sp<SkData> PictureResourceStore::resolve(EntryMap& entries, const void* record, size_t length, uint64_t* id) {
+    *id = 0;
+    if (length < 8)
+        return nullptr;
+    uint32_t header[3];
+    memcpy(header, record, 8);
+    if (header[0] == kInlineTag) {
+        if (header[1] != length - 8)
+            return nullptr;
+        return SkData::MakeWithCopy(static_cast<const uint8_t*>(record) + 8, header[1]);
+    }
+    if (header[0] != kReferenceTag || length != kReferenceSize)
+        return nullptr;
+    memcpy(header, record, kReferenceSize);
+    *id = (static_cast<uint64_t>(header[1]) << 32) | header[2];
+    SkAutoMutexExclusive lock(fMutex);
+    auto it = entries.find(*id);
+    return it == entries.end() ? nullptr : it->second.fData;
+}
+
+sk_sp<SkData> PictureResourceStore::SerializeTypeface(SkTypeface* typeface, void* ctx) {
+    PictureResourceStore* store = static_cast<PictureResourceStore*>(ctx);
+    if (sk_sp<SkData> reference = store->findReference(store->fTypefaces, store->fTypefaceIds, typeface->uniqueID()))
+        return reference;
+    sk_sp<SkData> data = typeface->serialize(SkTypeface::SerializeBehavior::kDoIncludeData);
+    if (!data)
+        return nullptr;
+    return store->put(store->fTypefaces, store->fTypefaceIds, typeface->uniqueID(), std::move(data));
+}
+
+sk_sp<SkData> PictureResourceStore::SerializeImage(SkImage* image, void* ctx) {
+    PictureResourceStore* store = static_cast<PictureResourceStore*>(ctx);
+    if (sk_sp<SkData> reference = store->findReference(store->fImages, store->fImageIds, image->uniqueID()))
+        return reference;
+    sk_sp<SkData> data = encodeImage(image);
+    if (!data)
+        return nullptr;
+    return store->put(store->fImages, store->fImageIds, image->uniqueID(), std::move(data));
+}
+
+sk_sp<SkTypeface> PictureResourceStore::DeserializeTypeface(const void* data, size_t length, void* ctx) {
+    PictureResourceStore* store = static_cast<PictureResourceStore*>(ctx);
+    std::vector<uint8_t> record;
+    if (length == sizeof(SkStream*)) {
+        // Typeface table of a picture passes the stream positioned at the typeface instead of bytes
+        SkStream* stream = *static_cast<SkStream* const*>(data);
+        uint32_t tag;
+        // Pictures not serialized against a store embed typefaces in Skia's own format
+        if (peekU32(stream, &tag) && !isRecordTag(tag))
+            return SkTypeface::MakeDeserialize(stream);
+        uint32_t header[2];
+        if (!stream->readU32(&header[0]) || !isRecordTag(header[0]) || !stream->readU32(&header[1]))
+            return nullptr;
+        record.assign(reinterpret_cast<const uint8_t*>(header), reinterpret_cast<const uint8_t*>(header) + 8);
+        if (!readTail(stream, header[0] == kInlineTag ? header[1] : kReferenceSize - 8, &record))
+            return nullptr;
+        data = record.data();
+        length = record.size();
+    } else {
+        uint32_t tag = 0;
+        if (length >= 4)
+            memcpy(&tag, data, 4);
+        if (!isRecordTag(tag)) {
+            SkMemoryStream stream(data, length, false);
+            return SkTypeface::MakeDeserialize(&stream);
+        }
+    }
+
+    uint64_t id;
+    sk_sp<SkData> serialized = store->resolve(store->fTypefaces, data, length, &id);
+    if (!serialized)
+        return nullptr;
+    if (id != 0) {
+        SkAutoMutexExclusive lock(store->fMutex);
+        if (sk_sp<SkTypeface> typeface = store->fTypefaces[id].fTypeface)
+            return typeface;
+    }
+
+    SkMemoryStream stream(serialized);
+    sk_sp<SkTypeface> typeface = SkTypeface::MakeDeserialize(&stream);
+    if (typeface && id != 0) {
+        SkAutoMutexExclusive lock(store->fMutex);
+        Entry& entry = store->fTypefaces[id];
+        if (!entry.fTypeface)
+            entry.fTypeface = typeface;
+        return entry.fTypeface;
+    }
+    return typeface;
+}
+
+sk_sp<SkImage> PictureResourceStore::DeserializeImage(const void* data, size_t length, void* ctx) {
+    PictureResourceStore* store = static_cast<PictureResourceStore*>(ctx);
+    uint32_t tag = 0;
+    if (length >= 4)
+        memcpy(&tag, data, 4);
+    // Images embedded without the store are plain encoded data
+    if (!isRecordTag(tag))
+        return SkImage::MakeFromEncoded(SkData::MakeWithCopy(data, length));
+    uint64_t id;
+    sk_sp<SkData> encoded = store->resolve(store->fImages, data, length, &id);
+    if (!encoded)
+        return nullptr;
+    if (id != 0) {
+        SkAutoMutexExclusive lock(store->fMutex);
+        if (sk_sp<SkImage> image = store->fImages[id].fImage)
+            return image;
+    }
+
+    sk_sp<SkImage> image = SkImage::MakeFromEncoded(encoded);
+    if (image && id != 0) {
+        SkAutoMutexExclusive lock(store->fMutex);
+        Entry& entry = store->fImages[id];
+        if (!entry.fImage)
+            entry.fImage = image;
+        return entry.fImage;
+    }
+    return image;
+}
+
+sk_sp<SkData> PictureResourceStore::serialize() const {
+    SkDynamicMemoryWStream stream;
+    SkAutoMutexExclusive lock(fMutex);
+    stream.write32(kStoreTag);
+    stream.write32(kStoreVersion);
+    for (const EntryMap* entries : { &fTypefaces, &fImages }) {
+        stream.write32(static_cast<uint32_t>(entries->size()));
+        for (const auto& it : *entries) {
+            writeU64(&stream, it.first);
+            stream.write32(static_cast<uint32_t>(it.second.fData->size()));
+            stream.write(it.second.fData->data(), it.second.fData->size());
+        }
+    }
+    return stream.detachAsData();
+}
+
+sk_sp<PictureResourceStore> PictureResourceStore::MakeFromData(const SkData* data) {
+    if (data == nullptr)
+        return nullptr;
+    SkMemoryStream stream(data->data(), data->size());
+    uint32_t tag, version;
+    if (!stream.readU32(&tag) || !stream.readU32(&version) || tag != kStoreTag || version != kStoreVersion)
+        return nullptr;
+
+    sk_sp<PictureResourceStore> store(new PictureResourceStore());
+    for (EntryMap* entries : { &store->fTypefaces, &store->fImages }) {
+        uint32_t count;
+        if (!stream.readU32(&count))
+            return nullptr;
+        for (uint32_t i = 0; i < count; ++i) {
+            uint64_t id;
+            uint32_t size;
+            if (!readU64(&stream, &id) || !stream.readU32(&size) || size > stream.getLength() - stream.getPosition())
+                return nullptr;
+            sk_sp<SkData> resource = SkData::MakeUninitialized(size);
+            if (stream.read(resource->writable_data(), size) != size || HashOf(resource.get()) != id)
+                return nullptr;
+            store->fStoredBytes += size;
+            (*entries)[id].fData = std::move(resource);
+        }
+    }
+    return store;
+}
+
+PictureResourceStore::Stats PictureResourceStore::getStats() const {
+    SkAutoMutexExclusive lock(fMutex);
+    Stats stats;
+    stats.fTypefaces = static_cast<int32_t>(fTypefaces.size());
+    stats.fImages = static_cast<int32_t>(fImages.size());
+    stats.fReferences = fReferences;
+    stats.fStoredBytes = fStoredBytes;
+    stats.fReferencedBytes = fReferencedBytes;
+    return stats;
+}
@@ -0,0 +1,142 @@
+#include <chrono>
+#include <cmath>
+#include "RetainedLayer.hh"
+#include "SkSurface.h"
+
+namespace {
+    // Rasterized content larger than this is not worth the memory, picture is replayed instead
+    const int64_t kMaxRasterPixels = 4096 * 4096;
+
+    int64_t nowNanos() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+RetainedLayer::RetainedLayer(const SkRect& bounds)
+    : fBounds(bounds)
+    , fRecording(false)
+    , fRecordStartNanos(0)
+    , fDirty(true)
+    , fImageScaleX(0)
+    , fImageScaleY(0)
+    , fReplays(0)
+    , fReplayScale(SkVector::Make(0, 0))
+    , fRasterAfterReplays(0)
+    , fRasterAboveOpCount(0) {
+    resetStats();
+}
+
+SkCanvas* RetainedLayer::beginRecording() {
+    if (fRecording)
+        return fRecorder.getRecordingCanvas();
+    fRecording = true;
+    fRecordStartNanos = nowNanos();
+    return fRecorder.beginRecording(fBounds);
+}
+
+bool RetainedLayer::finishRecording() {
+    if (!fRecording)
+        return false;
+    fRecording = false;
+    fPicture = fRecorder.finishRecordingAsPicture();
+    fImage.reset();
+    fReplays = 0;
+    fDirty = false;
+    fStats.fRecordings++;
+    fStats.fRecordMicros += static_cast<int32_t>((nowNanos() - fRecordStartNanos) / 1000);
+    return true;
+}
+
+void RetainedLayer::invalidate() {
+    fDirty = true;
+}
+
+bool RetainedLayer::shouldRasterize() const {
+    if (fRasterAfterReplays > 0 && fReplays > fRasterAfterReplays)
+        return true;
+    return fRasterAboveOpCount > 0 && fPicture->approximateOpCount() >= fRasterAboveOpCount;
+}
+
+bool RetainedLayer::rasterize(SkCanvas* canvas, SkScalar scaleX, SkScalar scaleY) {
+    int width = static_cast<int>(std::ceil(fBounds.width() * scaleX));
+    int height = static_cast<int>(std::ceil(fBounds.height() * scaleY));
+    if (width <= 0 || height <= 0 || static_cast<int64_t>(width) * height > kMaxRasterPixels)
+        return false;
+
+    SkImageInfo info = SkImageInfo::MakeN32Premul(width, height, canvas->imageInfo().refColorSpace());
+    sk_sp<SkSurface> surface;
+    // Keep the image on GPU when drawing into a GPU canvas
+    if (auto context = canvas->recordingContext())
+        surface = SkSurface::MakeRenderTarget(context, SkBudgeted::kYes, info);
+    if (!surface)
+        surface = SkSurface::MakeRaster(info);
+    if (!surface)
+        return false;
+
+    SkCanvas* rasterCanvas = surface->getCanvas();
+    rasterCanvas->clear(SK_ColorTRANSPARENT);
+    rasterCanvas->scale(scaleX, scaleY);
+    rasterCanvas->translate(-fBounds.left(), -fBounds.top());
+    rasterCanvas->drawPicture(fPicture);
+    fImage = surface->makeImageSnapshot();
+    if (!fImage)
+        return false;
+    fImageScaleX = scaleX;
+    fImageScaleY = scaleY;
+    fStats.fRasterizations++;
+    return true;
+}
+
+bool RetainedLayer::draw(SkCanvas* canvas, const SkPaint* paint) {
+    if (fDirty || !fPicture) {
+        fStats.fMisses++;
+        return false;
+    }
+    fStats.fDraws++;
+
+    // Raster cache only makes sense when content isn't rotated or skewed
+    SkMatrix matrix = canvas->getTotalMatrix();
+    bool canRasterize = matrix.isScaleTranslate() && matrix.getScaleX() > 0 && matrix.getScaleY() > 0;
+    SkScalar scaleX = matrix.getScaleX();
+    SkScalar scaleY = matrix.getScaleY();
+
+    if (fImage && (!canRasterize || scaleX != fImageScaleX || scaleY != fImageScaleY))
+        fImage.reset();
+
+    if (canRasterize && !fImage) {
+        if (scaleX != fReplayScale.fX || scaleY != fReplayScale.fY) {
+            fReplayScale = SkVector::Make(scaleX, scaleY);
+            fReplays = 0;
+        }
+        fReplays++;
+        if (shouldRasterize())
+            rasterize(canvas, scaleX, scaleY);
+    }
+
+    if (fImage) {
+        // Image pixels match device pixels at this scale, so it's drawn unfiltered at the nearest
+        // whole pixel instead of being resampled at a fractional offset
+        SkPoint origin = matrix.mapXY(fBounds.left(), fBounds.top());
+        canvas->save();
+        canvas->resetMatrix();
+        canvas->drawImage(fImage, SkScalarRoundToScalar(origin.fX), SkScalarRoundToScalar(origin.fY),
+                          SkSamplingOptions(SkFilterMode::kNearest), paint);
+        canvas->restore();
+        fStats.fRasterDraws++;
+    } else {
+        canvas->drawPicture(fPicture, nullptr, paint);
+    }
+    return true;
+}
+
+RetainedLayer::Stats RetainedLayer::getStats() const {
+    Stats stats = fStats;
+    stats.fPictureBytes = fPicture ? fPicture->approximateBytesUsed() : 0;
+    stats.fImageBytes = fImage ? fImage->imageInfo().computeMinByteSize() : 0;
+    return stats;
+}
+
+void RetainedLayer::resetStats() {
+    fStats = Stats();
+}
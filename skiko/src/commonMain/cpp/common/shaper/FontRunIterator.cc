@@ -12,12 +12,12 @@ static inline SkUnichar utf8_next(const char** ptr, const char* end) {
     return val < 0 ? 0xFFFD : val;
 }
 
-bool can_handle_cluster(SkTypeface* typeface, const char* clusterStart, const char* clusterEnd) {
+bool can_handle_cluster(const TypefaceCoverage& coverage, const char* clusterStart, const char* clusterEnd) {
     const char *ptr = clusterStart;
     while (ptr < clusterEnd) {
         SkUnichar u = SkUTF::NextUTF8(&ptr, clusterEnd);
         u = u < 0 ? 0xFFFD : u;
-        if (0 == typeface->unicharToGlyph(u))
+        if (!coverage.covers(u))
             return false;
     }
     return true;
@@ -29,10 +29,10 @@ void FontRunIterator::consume() {
     UErrorCode status = U_ZERO_ERROR;
 
     // If the starting typeface can handle this character, use it.
-    if (can_handle_cluster(fFont.getTypeface(), clusterStart, clusterEnd)) {
+    if (can_handle_cluster(*fFontCoverage, clusterStart, clusterEnd)) {
         fCurrentFont = &fFont;
     // If the current fallback can handle this character, use it.
-    } else if (fFallbackFont.getTypeface() && can_handle_cluster(fFallbackFont.getTypeface(), clusterStart, clusterEnd)) {
+    } else if (fFallbackFont.getTypeface() && can_handle_cluster(*fFallbackCoverage, clusterStart, clusterEnd)) {
         fCurrentFont = &fFallbackFont;
     // If not, try to find a fallback typeface
     } else {
@@ -44,8 +44,12 @@ void FontRunIterator::consume() {
             SkUnichar u = SkUTF::NextUTF8(&ptr, clusterEnd);
             u = u < 0 ? 0xFFFD : u;
             sk_sp<SkTypeface> candidate(fFallbackMgr->matchFamilyStyleCharacter(fRequestName, fRequestStyle, &language, languageCount, u));
-            if (candidate && can_handle_cluster(candidate.get(), clusterStart, clusterEnd)) {
+            if (!candidate)
+                continue;
+            std::shared_ptr<const TypefaceCoverage> coverage = TypefaceCoverage::Get(candidate.get());
+            if (can_handle_cluster(*coverage, clusterStart, clusterEnd)) {
                 fFallbackFont.setTypeface(std::move(candidate));
+                fFallbackCoverage = std::move(coverage);
                 fCurrentFont = &fFallbackFont;
                 break;
             }
@@ -61,20 +65,20 @@ void FontRunIterator::consume() {
 
         // Do not switch font on control, whitespace or punct
         if (ptr == clusterEnd
-            && fCurrentFont->getTypeface()->unicharToGlyph(u) != 0
+            && currentCoverage().covers(u)
             && (u_iscntrl(u)
                 || (fApproximateSpaces && u_isWhitespace(u))
                 || (fApproximatePunctuation && u_ispunct(u))))
             continue;
 
         // End run if not using initial typeface and initial typeface has this character.
-        if (fCurrentFont->getTypeface() != fFont.getTypeface() && can_handle_cluster(fFont.getTypeface(), clusterStart, clusterEnd)) {
+        if (fCurrentFont->getTypeface() != fFont.getTypeface() && can_handle_cluster(*fFontCoverage, clusterStart, clusterEnd)) {
             fCurrent = clusterStart;
             return;
         }
 
         // End run if current typeface does not have this character and some other font does.
-        if (!can_handle_cluster(fCurrentFont->getTypeface(), clusterStart, clusterEnd)) {
+        if (!can_handle_cluster(currentCoverage(), clusterStart, clusterEnd)) {
             const char* language = fLanguage ? fLanguage->currentLanguage() : nullptr;
             int languageCount = fLanguage ? 1 : 0;
             const char *ptr = clusterStart;
@@ -82,7 +86,7 @@ void FontRunIterator::consume() {
                 SkUnichar u = SkUTF::NextUTF8(&ptr, clusterEnd);
                 u = u < 0 ? 0xFFFD : u;
                 sk_sp<SkTypeface> candidate(fFallbackMgr->matchFamilyStyleCharacter(fRequestName, fRequestStyle, &language, languageCount, u));
-                if (candidate && can_handle_cluster(candidate.get(), clusterStart, clusterEnd)) {
+                if (candidate && can_handle_cluster(*TypefaceCoverage::Get(candidate.get()), clusterStart, clusterEnd)) {
                     fCurrent = clusterStart;
                     return;
                 }
@@ -0,0 +1,623 @@
+#include <cstdio>
+#include <cstring>
+#include "ShapingCache.hh"
+#include "SkFontMgr.h"
+#include "SkStream.h"
+#include "hb.h"
+#include "include/core/SkMilestone.h"
+
+namespace {
+    const char kMagic[4] = { 'S', 'K', 'S', 'C' };
+    const uint32_t kVersion = 2;
+    // Shaping results depend on Skia and HarfBuzz, files written by other versions are ignored
+    const uint32_t kSkiaMilestone = SK_MILESTONE;
+    const uint32_t kHarfBuzzVersion = HB_VERSION_MAJOR << 20 | HB_VERSION_MINOR << 10 | HB_VERSION_MICRO;
+    // Files are written in native byte order and rejected on machines with a different one
+    const uint32_t kByteOrder = 0x01020304;
+    const SkFontTableTag kHeadTag = SkSetFourByteTag('h', 'e', 'a', 'd');
+
+    SkMutex gShapersMutex;
+    std::unordered_map<SkShaper*, ShapingCache::ShaperKind>* gShapers = nullptr;
+
+    template <typename T>
+    void write(std::string* out, T value) {
+        out->append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void writeBytes(std::string* out, const void* data, size_t size) {
+        write<uint32_t>(out, static_cast<uint32_t>(size));
+        out->append(static_cast<const char*>(data), size);
+    }
+
+    template <typename T>
+    void writeArray(std::string* out, const std::vector<T>& values) {
+        out->append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+
+    // Bounds checked reader of data written by the functions above
+    class Reader {
+    public:
+        Reader(const uint8_t* data, size_t size): fPtr(data), fEnd(data + size) {}
+
+        template <typename T>
+        bool read(T* value) {
+            return readRaw(value, sizeof(T));
+        }
+
+        bool readBytes(const uint8_t** data, size_t* size) {
+            uint32_t length;
+            if (!read(&length) || length > remaining())
+                return false;
+            *data = fPtr;
+            *size = length;
+            fPtr += length;
+            return true;
+        }
+
+        bool readString(SkString* value) {
+            const uint8_t* data;
+            size_t size;
+            if (!readBytes(&data, &size))
+                return false;
+            value->set(reinterpret_cast<const char*>(data), size);
+            return true;
+        }
+
+        template <typename T>
+        bool readArray(std::vector<T>* values, size_t count) {
+            if (count > remaining() / sizeof(T))
+                return false;
+            values->resize(count);
+            return readRaw(values->data(), count * sizeof(T));
+        }
+
+        bool atEnd() const {
+            return fPtr == fEnd;
+        }
+
+    private:
+        bool readRaw(void* dst, size_t size) {
+            if (size > remaining())
+                return false;
+            memcpy(dst, fPtr, size);
+            fPtr += size;
+            return true;
+        }
+
+        size_t remaining() const {
+            return static_cast<size_t>(fEnd - fPtr);
+        }
+
+        const uint8_t* fPtr;
+        const uint8_t* fEnd;
+    };
+
+    uint8_t fontFlags(const SkFont& font) {
+        return (font.isEmbolden() ? 1 : 0)
+            | (font.isSubpixel() ? 2 : 0)
+            | (font.isLinearMetrics() ? 4 : 0)
+            | (font.isBaselineSnap() ? 8 : 0)
+            | (font.isForceAutoHinting() ? 16 : 0)
+            | (font.isEmbeddedBitmaps() ? 32 : 0);
+    }
+
+    // Everything but typeface, which font run iterators replace for fallback runs
+    bool sameParameters(const SkFont& a, const SkFont& b) {
+        return a.getSize() == b.getSize() && a.getScaleX() == b.getScaleX() && a.getSkewX() == b.getSkewX()
+            && a.getEdging() == b.getEdging() && a.getHinting() == b.getHinting() && fontFlags(a) == fontFlags(b);
+    }
+}
+
+class ShapingCache::Recorder: public SkShaper::RunHandler {
+public:
+    Recorder(ShapingCache* cache, const SkFont& font, SkShaper::RunHandler* target):
+      fCache(cache),
+      fFont(font),
+      fTarget(target),
+      fRecording(std::make_shared<Recording>()),
+      fValid(true)
+    {
+    }
+
+    void beginLine() override {
+        fRecording->fLines.emplace_back();
+        fTarget->beginLine();
+    }
+
+    void runInfo(const RunInfo& info) override {
+        fTarget->runInfo(info);
+    }
+
+    void commitRunInfo() override {
+        fTarget->commitRunInfo();
+    }
+
+    Buffer runBuffer(const RunInfo& info) override {
+        fTargetBuffer = fTarget->runBuffer(info);
+        // Offsets and clusters are always recorded, whether target asked for them or not
+        fOffsets.assign(info.glyphCount, { 0, 0 });
+        fClusters.assign(info.glyphCount, 0);
+        fBuffer = fTargetBuffer;
+        if (!fBuffer.offsets)
+            fBuffer.offsets = fOffsets.data();
+        if (!fBuffer.clusters)
+            fBuffer.clusters = fClusters.data();
+        return fBuffer;
+    }
+
+    void commitRunBuffer(const RunInfo& info) override {
+        record(info);
+        // Target that didn't ask for offsets expects them included in positions
+        if (!fTargetBuffer.offsets) {
+            for (size_t i = 0; i < info.glyphCount; ++i)
+                fTargetBuffer.positions[i] += fOffsets[i];
+        }
+        fTarget->commitRunBuffer(info);
+    }
+
+    void commitLine() override {
+        fTarget->commitLine();
+    }
+
+    std::shared_ptr<const Recording> recording() const {
+        return fValid ? fRecording : nullptr;
+    }
+
+private:
+    void record(const RunInfo& info) {
+        if (!fValid)
+            return;
+        if (fRecording->fLines.empty() || !fBuffer.glyphs || !fBuffer.positions || !sameParameters(info.fFont, fFont)) {
+            fValid = false;
+            return;
+        }
+
+        Run run;
+        run.fTypeface = info.fFont.refTypefaceOrDefault();
+        if (!fCache->fingerprint(run.fTypeface.get(), &run.fFingerprint)) {
+            fValid = false;
+            return;
+        }
+        size_t count = info.glyphCount;
+        run.fBidiLevel = info.fBidiLevel;
+        run.fAdvance = info.fAdvance;
+        run.fUtf8Begin = info.utf8Range.begin();
+        run.fUtf8End = info.utf8Range.end();
+        run.fGlyphs.assign(fBuffer.glyphs, fBuffer.glyphs + count);
+        run.fPositions.resize(count);
+        for (size_t i = 0; i < count; ++i)
+            run.fPositions[i] = fBuffer.positions[i] - fBuffer.point;
+        run.fOffsets.assign(fBuffer.offsets, fBuffer.offsets + count);
+        run.fClusters.assign(fBuffer.clusters, fBuffer.clusters + count);
+        fRecording->fLines.back().push_back(std::move(run));
+    }
+
+    ShapingCache* fCache;
+    SkFont fFont;
+    SkShaper::RunHandler* fTarget;
+    std::shared_ptr<Recording> fRecording;
+    bool fValid;
+    Buffer fTargetBuffer;
+    Buffer fBuffer;
+    std::vector<SkVector> fOffsets;
+    std::vector<uint32_t> fClusters;
+};
+
+ShapingCache& ShapingCache::Get() {
+    static ShapingCache* instance = new ShapingCache();
+    return *instance;
+}
+
+SkShaper* ShapingCache::Register(std::unique_ptr<SkShaper> shaper, ShaperKind kind) {
+    SkShaper* result = shaper.release();
+    if (result == nullptr)
+        return nullptr;
+    SkAutoMutexExclusive lock(gShapersMutex);
+    if (gShapers == nullptr)
+        gShapers = new std::unordered_map<SkShaper*, ShaperKind>();
+    (*gShapers)[result] = kind;
+    return result;
+}
+
+void ShapingCache::Unregister(SkShaper* shaper) {
+    SkAutoMutexExclusive lock(gShapersMutex);
+    if (gShapers != nullptr)
+        gShapers->erase(shaper);
+}
+
+ShapingCache::ShapingCache()
+    : fEnabled(false)
+    , fHits(0)
+    , fMisses(0)
+    , fRejected(0)
+{
+}
+
+bool ShapingCache::fingerprint(SkTypeface* typeface, Fingerprint* result) {
+    uint32_t id = typeface->uniqueID();
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        auto it = fFingerprints.find(id);
+        if (it != fFingerprints.end()) {
+            *result = it->second;
+            return true;
+        }
+    }
+
+    // checkSumAdjustment makes the whole file sum up to a constant, so it changes with any byte of it
+    uint8_t head[12];
+    if (typeface->getTableData(kHeadTag, 0, sizeof(head), head) != sizeof(head))
+        return false;
+    result->fChecksum = static_cast<uint32_t>(head[8]) << 24 | head[9] << 16 | head[10] << 8 | head[11];
+    typeface->getFamilyName(&result->fFamily);
+    SkFontStyle style = typeface->fontStyle();
+    result->fStyle = style.weight() << 16 | style.width() << 8 | style.slant();
+    result->fGlyphCount = typeface->countGlyphs();
+    // Instances made by makeClone share the file, family and style of their base typeface
+    int axisCount = typeface->getVariationDesignPosition(nullptr, 0);
+    result->fVariation.resize(axisCount > 0 ? axisCount : 0);
+    if (axisCount > 0 && typeface->getVariationDesignPosition(result->fVariation.data(), axisCount) != axisCount)
+        result->fVariation.clear();
+
+    SkAutoMutexExclusive lock(fMutex);
+    fFingerprints[id] = *result;
+    return true;
+}
+
+sk_sp<SkTypeface> ShapingCache::resolve(const Fingerprint& fingerprint, const SkFont& font) {
+    sk_sp<SkTypeface> primary = font.refTypefaceOrDefault();
+    Fingerprint primaryFingerprint;
+    if (this->fingerprint(primary.get(), &primaryFingerprint) && primaryFingerprint == fingerprint)
+        return primary;
+
+    std::string key;
+    WriteFingerprint(fingerprint, &key);
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        auto it = fResolved.find(key);
+        if (it != fResolved.end())
+            return it->second;
+    }
+
+    SkFontStyle style(fingerprint.fStyle >> 16, (fingerprint.fStyle >> 8) & 0xFF,
+                      static_cast<SkFontStyle::Slant>(fingerprint.fStyle & 0xFF));
+    sk_sp<SkTypeface> typeface(SkFontMgr::RefDefault()->matchFamilyStyle(fingerprint.fFamily.c_str(), style));
+    if (typeface && !fingerprint.fVariation.empty()) {
+        SkFontArguments::VariationPosition position = {
+            fingerprint.fVariation.data(), static_cast<int>(fingerprint.fVariation.size())
+        };
+        typeface = typeface->makeClone(SkFontArguments().setVariationDesignPosition(position));
+    }
+    Fingerprint found;
+    if (typeface && !(this->fingerprint(typeface.get(), &found) && found == fingerprint))
+        typeface = nullptr;
+
+    SkAutoMutexExclusive lock(fMutex);
+    fResolved[key] = typeface;
+    return typeface;
+}
+
+bool ShapingCache::makeKey(SkShaper* shaper, const SkString& text, const SkFont& font,
+                           const std::vector<SkShaper::Feature>& features, int options, float width, std::string* key) {
+    ShaperKind kind;
+    {
+        SkAutoMutexExclusive lock(gShapersMutex);
+        if (gShapers == nullptr)
+            return false;
+        auto it = gShapers->find(shaper);
+        if (it == gShapers->end())
+            return false;
+        kind = it->second;
+    }
+
+    Fingerprint typeface;
+    if (!fingerprint(font.getTypefaceOrDefault(), &typeface))
+        return false;
+
+    key->reserve(64 + text.size());
+    write(key, static_cast<uint8_t>(kind));
+    write(key, static_cast<int32_t>(options));
+    write(key, width);
+    WriteFingerprint(typeface, key);
+    write(key, font.getSize());
+    write(key, font.getScaleX());
+    write(key, font.getSkewX());
+    write(key, static_cast<uint8_t>(font.getEdging()));
+    write(key, static_cast<uint8_t>(font.getHinting()));
+    write(key, fontFlags(font));
+    write(key, static_cast<uint32_t>(features.size()));
+    for (const SkShaper::Feature& feature : features) {
+        write(key, static_cast<uint32_t>(feature.tag));
+        write(key, feature.value);
+        write(key, static_cast<uint64_t>(feature.start));
+        write(key, static_cast<uint64_t>(feature.end));
+    }
+    writeBytes(key, text.c_str(), text.size());
+    return true;
+}
+
+std::shared_ptr<const ShapingCache::Recording> ShapingCache::find(const std::string& key) {
+    SkAutoMutexExclusive lock(fMutex);
+    auto it = fEntries.find(key);
+    if (it == fEntries.end()) {
+        fMisses++;
+        return nullptr;
+    }
+
+    Entry& entry = it->second;
+    if (!entry.fRecording) {
+        std::shared_ptr<Recording> recording = std::make_shared<Recording>();
+        if (!Decode(entry.fData, entry.fSize, recording.get())) {
+            fEntries.erase(it);
+            fRejected++;
+            fMisses++;
+            return nullptr;
+        }
+        entry.fRecording = recording;
+        entry.fFile = nullptr;
+        entry.fData = nullptr;
+        entry.fSize = 0;
+    }
+    return entry.fRecording;
+}
+
+void ShapingCache::reject(const std::string& key) {
+    SkAutoMutexExclusive lock(fMutex);
+    fEntries.erase(key);
+    fRejected++;
+    fMisses++;
+}
+
+bool ShapingCache::replay(const Recording& recording, const SkString& text, const SkFont& font,
+                          SkShaper::RunHandler* handler) {
+    // Check runs and resolve every typeface before the first call, so that handler is untouched
+    // on failure. Handlers index text with ranges and clusters, loaded files must not go past it.
+    std::vector<std::vector<SkFont>> fonts(recording.fLines.size());
+    for (size_t l = 0; l < recording.fLines.size(); ++l) {
+        for (const Run& run : recording.fLines[l]) {
+            if (run.fUtf8Begin > run.fUtf8End || run.fUtf8End > text.size())
+                return false;
+            for (size_t i = 0; i < run.fGlyphs.size(); ++i) {
+                if (run.fClusters[i] < run.fUtf8Begin || run.fClusters[i] > run.fUtf8End
+                    || run.fGlyphs[i] >= run.fFingerprint.fGlyphCount)
+                    return false;
+            }
+            sk_sp<SkTypeface> typeface = run.fTypeface ? run.fTypeface : resolve(run.fFingerprint, font);
+            if (!typeface)
+                return false;
+            fonts[l].push_back(font);
+            fonts[l].back().setTypeface(std::move(typeface));
+        }
+    }
+
+    for (size_t l = 0; l < recording.fLines.size(); ++l) {
+        const Line& line = recording.fLines[l];
+        handler->beginLine();
+        for (size_t r = 0; r < line.size(); ++r) {
+            const Run& run = line[r];
+            SkShaper::RunHandler::RunInfo info = { fonts[l][r], run.fBidiLevel, run.fAdvance, run.fGlyphs.size(),
+                                                   SkShaper::RunHandler::Range(run.fUtf8Begin, run.fUtf8End - run.fUtf8Begin) };
+            handler->runInfo(info);
+        }
+        handler->commitRunInfo();
+        for (size_t r = 0; r < line.size(); ++r) {
+            const Run& run = line[r];
+            SkShaper::RunHandler::RunInfo info = { fonts[l][r], run.fBidiLevel, run.fAdvance, run.fGlyphs.size(),
+                                                   SkShaper::RunHandler::Range(run.fUtf8Begin, run.fUtf8End - run.fUtf8Begin) };
+            SkShaper::RunHandler::Buffer buffer = handler->runBuffer(info);
+            size_t count = run.fGlyphs.size();
+            memcpy(buffer.glyphs, run.fGlyphs.data(), count * sizeof(SkGlyphID));
+            for (size_t i = 0; i < count; ++i) {
+                buffer.positions[i] = buffer.point + run.fPositions[i];
+                if (!buffer.offsets)
+                    buffer.positions[i] += run.fOffsets[i];
+            }
+            if (buffer.offsets)
+                memcpy(buffer.offsets, run.fOffsets.data(), count * sizeof(SkVector));
+            if (buffer.clusters)
+                memcpy(buffer.clusters, run.fClusters.data(), count * sizeof(uint32_t));
+            handler->commitRunBuffer(info);
+        }
+        handler->commitLine();
+    }
+    return true;
+}
+
+bool ShapingCache::shape(SkShaper* shaper, const SkString& text, const SkFont& font,
+                         const std::vector<SkShaper::Feature>& features, int options, float width,
+                         SkShaper::RunHandler* handler, const std::function<bool(SkShaper::RunHandler*)>& shapeLive) {
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        if (!fEnabled)
+            return shapeLive(handler);
+    }
+
+    std::string key;
+    if (!makeKey(shaper, text, font, features, options, width, &key))
+        return shapeLive(handler);
+
+    if (std::shared_ptr<const Recording> recording = find(key)) {
+        if (replay(*recording, text, font, handler)) {
+            SkAutoMutexExclusive lock(fMutex);
+            fHits++;
+            return true;
+        }
+        reject(key);
+    }
+
+    Recorder recorder(this, font, handler);
+    if (!shapeLive(&recorder))
+        return false;
+    if (std::shared_ptr<const Recording> recording = recorder.recording()) {
+        SkAutoMutexExclusive lock(fMutex);
+        if (fEntries.size() < kMaxEntries || fEntries.count(key) > 0)
+            fEntries[key] = { recording, nullptr, nullptr, 0 };
+    }
+    return true;
+}
+
+void ShapingCache::WriteFingerprint(const Fingerprint& fingerprint, std::string* out) {
+    write(out, fingerprint.fStyle);
+    write(out, fingerprint.fChecksum);
+    write(out, fingerprint.fGlyphCount);
+    writeBytes(out, fingerprint.fFamily.c_str(), fingerprint.fFamily.size());
+    write(out, static_cast<uint32_t>(fingerprint.fVariation.size()));
+    writeArray(out, fingerprint.fVariation);
+}
+
+void ShapingCache::Encode(const Recording& recording, std::string* out) {
+    write(out, static_cast<uint32_t>(recording.fLines.size()));
+    for (const Line& line : recording.fLines) {
+        write(out, static_cast<uint32_t>(line.size()));
+        for (const Run& run : line) {
+            WriteFingerprint(run.fFingerprint, out);
+            write(out, run.fBidiLevel);
+            write(out, run.fAdvance);
+            write(out, static_cast<uint64_t>(run.fUtf8Begin));
+            write(out, static_cast<uint64_t>(run.fUtf8End));
+            write(out, static_cast<uint32_t>(run.fGlyphs.size()));
+            writeArray(out, run.fGlyphs);
+            writeArray(out, run.fPositions);
+            writeArray(out, run.fOffsets);
+            writeArray(out, run.fClusters);
+        }
+    }
+}
+
+bool ShapingCache::Decode(const uint8_t* data, size_t size, Recording* recording) {
+    Reader reader(data, size);
+    uint32_t lineCount;
+    if (!reader.read(&lineCount))
+        return false;
+    for (uint32_t l = 0; l < lineCount; ++l) {
+        uint32_t runCount;
+        if (!reader.read(&runCount))
+            return false;
+        recording->fLines.emplace_back();
+        for (uint32_t r = 0; r < runCount; ++r) {
+            Run run;
+            uint64_t utf8Begin;
+            uint64_t utf8End;
+            uint32_t axisCount;
+            uint32_t glyphCount;
+            if (!reader.read(&run.fFingerprint.fStyle) || !reader.read(&run.fFingerprint.fChecksum)
+                || !reader.read(&run.fFingerprint.fGlyphCount) || !reader.readString(&run.fFingerprint.fFamily)
+                || !reader.read(&axisCount) || !reader.readArray(&run.fFingerprint.fVariation, axisCount)
+                || !reader.read(&run.fBidiLevel) || !reader.read(&run.fAdvance)
+                || !reader.read(&utf8Begin) || !reader.read(&utf8End) || utf8End < utf8Begin
+                || !reader.read(&glyphCount)
+                || !reader.readArray(&run.fGlyphs, glyphCount) || !reader.readArray(&run.fPositions, glyphCount)
+                || !reader.readArray(&run.fOffsets, glyphCount) || !reader.readArray(&run.fClusters, glyphCount))
+                return false;
+            run.fUtf8Begin = static_cast<size_t>(utf8Begin);
+            run.fUtf8End = static_cast<size_t>(utf8End);
+            recording->fLines.back().push_back(std::move(run));
+        }
+    }
+    return reader.atEnd();
+}
+
+bool ShapingCache::load(const char* path) {
+    sk_sp<SkData> file = SkData::MakeFromFileName(path);
+    if (!file)
+        return false;
+
+    Reader reader(file->bytes(), file->size());
+    char magic[4];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t skiaMilestone;
+    uint32_t harfBuzzVersion;
+    uint32_t count;
+    if (!reader.read(&magic) || memcmp(magic, kMagic, sizeof(kMagic)) != 0
+        || !reader.read(&version) || version != kVersion
+        || !reader.read(&byteOrder) || byteOrder != kByteOrder
+        || !reader.read(&skiaMilestone) || skiaMilestone != kSkiaMilestone
+        || !reader.read(&harfBuzzVersion) || harfBuzzVersion != kHarfBuzzVersion
+        || !reader.read(&count))
+        return false;
+
+    std::vector<std::pair<std::string, Entry>> entries;
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint8_t* keyData;
+        size_t keySize;
+        const uint8_t* valueData;
+        size_t valueSize;
+        if (!reader.readBytes(&keyData, &keySize) || !reader.readBytes(&valueData, &valueSize))
+            return false;
+        entries.emplace_back(std::string(reinterpret_cast<const char*>(keyData), keySize),
+                             Entry { nullptr, file, valueData, valueSize });
+    }
+
+    SkAutoMutexExclusive lock(fMutex);
+    for (auto& entry : entries) {
+        if (fEntries.size() >= kMaxEntries)
+            break;
+        fEntries.emplace(std::move(entry.first), std::move(entry.second));
+    }
+    return true;
+}
+
+bool ShapingCache::save(const char* path) {
+    std::string out;
+    out.append(kMagic, sizeof(kMagic));
+    write(&out, kVersion);
+    write(&out, kByteOrder);
+    write(&out, kSkiaMilestone);
+    write(&out, kHarfBuzzVersion);
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        // Decoding releases mapped files, which Windows doesn't allow to replace
+        for (auto it = fEntries.begin(); it != fEntries.end();) {
+            Entry& entry = it->second;
+            if (!entry.fRecording) {
+                std::shared_ptr<Recording> recording = std::make_shared<Recording>();
+                if (!Decode(entry.fData, entry.fSize, recording.get())) {
+                    it = fEntries.erase(it);
+                    fRejected++;
+                    continue;
+                }
+                entry = { recording, nullptr, nullptr, 0 };
+            }
+            ++it;
+        }
+
+        write(&out, static_cast<uint32_t>(fEntries.size()));
+        std::string value;
+        for (const auto& entry : fEntries) {
+            writeBytes(&out, entry.first.data(), entry.first.size());
+            value.clear();
+            Encode(*entry.second.fRecording, &value);
+            writeBytes(&out, value.data(), value.size());
+        }
+    }
+
+    SkString tmpPath = SkStringPrintf("%s.tmp", path);
+    {
+        SkFILEWStream stream(tmpPath.c_str());
+        if (!stream.isValid() || !stream.write(out.data(), out.size()))
+            return false;
+        stream.flush();
+    }
+#ifdef SK_BUILD_FOR_WIN
+    // rename doesn't replace existing files on Windows
+    std::remove(path);
+#endif
+    return std::rename(tmpPath.c_str(), path) == 0;
+}
+
+void ShapingCache::setEnabled(bool enabled) {
+    SkAutoMutexExclusive lock(fMutex);
+    fEnabled = enabled;
+}
+
+void ShapingCache::clear() {
+    SkAutoMutexExclusive lock(fMutex);
+    fEntries.clear();
+    fResolved.clear();
+}
+
+ShapingCache::Stats ShapingCache::getStats() const {
+    SkAutoMutexExclusive lock(fMutex);
+    return { fHits, fMisses, fRejected, static_cast<int32_t>(fEntries.size()) };
+}
@@ -0,0 +1,173 @@
+#include <algorithm>
+#include "TextBlobMetricsCache.hh"
+#include "SkFont.h"
+#include "SkFontMetrics.h"
+#include "RunRecordClone.hh"
+#include "mppinterop.h"
+
+std::shared_ptr<const TextBlobMetrics> TextBlobMetrics::Compute(const SkTextBlob& blob) {
+    std::shared_ptr<TextBlobMetrics> result = std::make_shared<TextBlobMetrics>();
+    result->fGlyphsLength = 0;
+    result->fPositionsLength = 0;
+    result->fHasBounds = true;
+    result->fBlockBounds = SkRect::MakeEmpty();
+    result->fTightBounds = SkRect::MakeEmpty();
+    result->fHasFirstBaseline = false;
+    result->fFirstBaseline = 0;
+    result->fLastBaseline = 0;
+    result->fHasClusters = true;
+
+    SkTextBlob::Iter iter(blob);
+    SkTextBlob::Iter::Run run;
+    SkFontMetrics metrics;
+    SkRect tmpBounds;
+    uint32_t runStart16 = 0;
+    bool isFirst = true;
+
+    while (iter.next(&run)) {
+        // run.fGlyphIndices points directly to runRecord.glyphBuffer(), which comes directly after RunRecord itself
+        auto runRecord = reinterpret_cast<const RunRecordClone*>(run.fGlyphIndices) - 1;
+        uint8_t positioning = runRecord->positioning();
+        result->fGlyphsLength += run.fGlyphCount;
+        result->fPositionsLength += run.fGlyphCount * RunRecordClone::ScalarsPerGlyph(positioning);
+
+        bool isFull = positioning == 2; // kFull_Positioning
+        if (isFirst && isFull) {
+            result->fHasFirstBaseline = true;
+            result->fFirstBaseline = runRecord->posBuffer()[1];
+        }
+        isFirst = false;
+        if (!isFull)
+            result->fHasBounds = false;
+
+        if (result->fHasBounds) {
+            SkScalar* posBuffer = runRecord->posBuffer();
+            const SkFont& font = runRecord->fFont;
+            font.getMetrics(&metrics);
+
+            SkScalar lastLeft = posBuffer[(run.fGlyphCount - 1) * 2];
+            SkScalar lastWidth;
+            if (run.fGlyphCount > 1 && SkScalarNearlyEqual(posBuffer[(run.fGlyphCount - 2) * 2], lastLeft))
+                lastWidth = 0;
+            else
+                font.getWidths(&run.fGlyphIndices[run.fGlyphCount - 1], 1, &lastWidth);
+            result->fBlockBounds.join(SkRect::MakeLTRB(posBuffer[0], posBuffer[1] + metrics.fAscent,
+                                                       lastLeft + lastWidth, posBuffer[1] + metrics.fDescent));
+
+            font.measureText(runRecord->glyphBuffer(), run.fGlyphCount * sizeof(uint16_t), SkTextEncoding::kGlyphID, &tmpBounds, nullptr);
+            tmpBounds.offset(posBuffer[0], posBuffer[1]);
+            result->fTightBounds.join(tmpBounds);
+
+            result->fLastBaseline = std::max(result->fLastBaseline, posBuffer[1]);
+        }
+
+        if (!runRecord->isExtended())
+            result->fHasClusters = false;
+        if (result->fHasClusters) {
+            skija::UtfIndicesConverter conv(runRecord->textBuffer(), runRecord->textSize());
+            uint32_t* clusterBuffer = runRecord->clusterBuffer();
+            for (uint32_t i = 0; i < run.fGlyphCount; ++i)
+                result->fClusters.push_back(runStart16 + conv.from8To16(clusterBuffer[i]));
+            runStart16 += conv.from8To16(runRecord->textSize());
+        }
+    }
+
+    if (!result->fHasBounds) {
+        result->fBlockBounds = SkRect::MakeEmpty();
+        result->fTightBounds = SkRect::MakeEmpty();
+        result->fLastBaseline = 0;
+    }
+    if (!result->fHasClusters)
+        std::vector<int>().swap(result->fClusters);
+    else
+        result->fClusters.shrink_to_fit();
+    return result;
+}
+
+TextBlobMetricsCache& TextBlobMetricsCache::Get() {
+    static TextBlobMetricsCache* instance = new TextBlobMetricsCache();
+    return *instance;
+}
+
+TextBlobMetricsCache::TextBlobMetricsCache()
+    : fBytesUsed(0)
+    , fByteBudget(kDefaultByteBudget)
+    , fHits(0)
+    , fMisses(0)
+    , fEvictions(0)
+{
+}
+
+std::shared_ptr<const TextBlobMetrics> TextBlobMetricsCache::find(const SkTextBlob& blob) {
+    uint32_t uniqueID = blob.uniqueID();
+    {
+        SkAutoMutexExclusive lock(fMutex);
+        auto it = fIndex.find(uniqueID);
+        if (it != fIndex.end()) {
+            fHits++;
+            fEntries.splice(fEntries.begin(), fEntries, it->second);
+            return it->second->fMetrics;
+        }
+        fMisses++;
+    }
+
+    // Blob is immutable, so concurrent misses compute identical metrics and the first one wins
+    std::shared_ptr<const TextBlobMetrics> metrics = TextBlobMetrics::Compute(blob);
+    size_t bytes = metrics->bytes();
+
+    SkAutoMutexExclusive lock(fMutex);
+    auto it = fIndex.find(uniqueID);
+    if (it != fIndex.end())
+        return it->second->fMetrics;
+    if (bytes > fByteBudget)
+        return metrics;
+
+    fEntries.push_front({ uniqueID, metrics, bytes });
+    fIndex.emplace(uniqueID, fEntries.begin());
+    fBytesUsed += bytes;
+    purgeLocked(fByteBudget);
+    return metrics;
+}
+
+void TextBlobMetricsCache::remove(uint32_t uniqueID) {
+    SkAutoMutexExclusive lock(fMutex);
+    auto it = fIndex.find(uniqueID);
+    if (it != fIndex.end())
+        eraseLocked(it->second);
+}
+
+void TextBlobMetricsCache::setByteBudget(size_t byteBudget) {
+    SkAutoMutexExclusive lock(fMutex);
+    fByteBudget = byteBudget;
+    purgeLocked(fByteBudget);
+}
+
+void TextBlobMetricsCache::purgeAll() {
+    SkAutoMutexExclusive lock(fMutex);
+    purgeLocked(0);
+}
+
+TextBlobMetricsCache::Stats TextBlobMetricsCache::getStats() const {
+    SkAutoMutexExclusive lock(fMutex);
+    return { fHits, fMisses, fEvictions, static_cast<int32_t>(fEntries.size()), fBytesUsed, fByteBudget };
+}
+
+void TextBlobMetricsCache::resetStats() {
+    SkAutoMutexExclusive lock(fMutex);
+    fHits = 0;
+    fMisses = 0;
+    fEvictions = 0;
+}
+
+void TextBlobMetricsCache::eraseLocked(EntryList::iterator it) {
+    fIndex.erase(it->fUniqueID);
+    fBytesUsed -= it->fBytes;
+    fEntries.erase(it);
+}
+
+void TextBlobMetricsCache::purgeLocked(size_t targetBytes) {
+    while (fBytesUsed > targetBytes && !fEntries.empty()) {
+        eraseLocked(std::prev(fEntries.end()));
+        fEvictions++;
+    }
+}
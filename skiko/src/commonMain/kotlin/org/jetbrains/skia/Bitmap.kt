@@ -31,6 +31,9 @@ class Bitmap internal constructor(ptr: NativePointer) : Managed(ptr, _FinalizerH
 
     internal var _imageInfo: ImageInfo? = null
 
+    // Keeps memory installed via installPixels(Pixmap) reachable while Bitmap refers to it
+    internal var _pixelsOwner: Any? = null
+
     /**
      * Creates an empty Bitmap without pixels, with [ColorType.UNKNOWN],
      * [ColorAlphaType.UNKNOWN], and with a width and height of zero.
@@ -265,6 +268,7 @@ class Bitmap internal constructor(ptr: NativePointer) : Managed(ptr, _FinalizerH
         Stats.onNativeCall()
         _imageInfo = null
         _nReset(_ptr)
+        _pixelsOwner = null
         return this
     }
 
@@ -570,6 +574,7 @@ class Bitmap internal constructor(ptr: NativePointer) : Managed(ptr, _FinalizerH
     ): Boolean {
         return try {
             _imageInfo = null
+            _pixelsOwner = null
             Stats.onNativeCall()
             interopScope {
                 _nInstallPixels(
@@ -590,6 +595,28 @@ class Bitmap internal constructor(ptr: NativePointer) : Managed(ptr, _FinalizerH
         }
     }
 
+    /**
+     * Sets ImageInfo, pixel address and rowBytes from pixmap without copying pixels.
+     *
+     * Bitmap keeps pixmap reachable until pixels are replaced by installPixels() or reset(),
+     * but the memory pixmap points to must stay valid while Bitmap draws or reads from it.
+     *
+     * @param pixmap  ImageInfo, pixel address, and rowBytes
+     * @return        true if ImageInfo was set to pixmap.info
+     */
+    fun installPixels(pixmap: Pixmap): Boolean {
+        return try {
+            _imageInfo = null
+            Stats.onNativeCall()
+            _nInstallPixelsFromPixmap(_ptr, getPtr(pixmap)).also {
+                _pixelsOwner = if (it) pixmap else null
+            }
+        } finally {
+            reachabilityBarrier(this)
+            reachabilityBarrier(pixmap)
+        }
+    }
+
     /**
      *
      * Allocates pixel memory with HeapAllocator, and replaces existing PixelRef.
@@ -937,6 +964,106 @@ class Bitmap internal constructor(ptr: NativePointer) : Managed(ptr, _FinalizerH
         }
     }
 
+    /**
+     * Same as [readPixels], but copies pixels into the caller-provided dst array, so that it can be
+     * reused between calls instead of allocating a new array for every read.
+     *
+     * @param dst          array of at least min(dstInfo.height, height - srcY) * dstRowBytes bytes
+     * @param dstInfo      destination width, height, ColorType, AlphaType, ColorSpace
+     * @param dstRowBytes  destination row length
+     * @param srcX         column index whose absolute value is less than width()
+     * @param srcY         row index whose absolute value is less than height()
+     * @return             true if pixels were copied to dst
+     */
+    fun readPixels(
+        dst: ByteArray,
+        dstInfo: ImageInfo = imageInfo,
+        dstRowBytes: Int = rowBytes,
+        srcX: Int = 0,
+        srcY: Int = 0
+    ): Boolean {
+        val size = min(dstInfo.height, height - srcY) * dstRowBytes
+        require(dst.size >= size) { "dst has ${dst.size} bytes, $size required" }
+        return try {
+            Stats.onNativeCall()
+            interopScope {
+                val handle = toInterop(dst)
+                _nReadPixels(
+                    _ptr,
+                    dstInfo.width,
+                    dstInfo.height,
+                    dstInfo.colorInfo.colorType.ordinal,
+                    dstInfo.colorInfo.alphaType.ordinal,
+                    getPtr(dstInfo.colorInfo.colorSpace),
+                    dstRowBytes,
+                    srcX,
+                    srcY,
+                    handle
+                ).also {
+                    if (it) handle.fromInterop(dst)
+                }
+            }
+        } finally {
+            reachabilityBarrier(this)
+            reachabilityBarrier(dstInfo.colorInfo.colorSpace)
+        }
+    }
+
+    /**
+     * Copies Rect of pixels from Bitmap straight into the memory pixmap points to,
+     * converting to pixmap ColorType and AlphaType if required.
+     *
+     * @param pixmap  destination pixels and ImageInfo
+     * @param srcX    column index whose absolute value is less than width()
+     * @param srcY    row index whose absolute value is less than height()
+     * @return        true if pixels were copied
+     */
+    fun readPixels(pixmap: Pixmap, srcX: Int = 0, srcY: Int = 0): Boolean {
+        return try {
+            Stats.onNativeCall()
+            _nReadPixelsToPixmap(_ptr, getPtr(pixmap), srcX, srcY)
+        } finally {
+            reachabilityBarrier(this)
+            reachabilityBarrier(pixmap)
+        }
+    }
+
+    /**
+     * Copies Rect of pixels from pixmap into Bitmap at (dstX, dstY),
+     * converting to Bitmap ColorType and AlphaType if required.
+     *
+     * @param pixmap  source pixels and ImageInfo
+     * @param dstX    column index whose absolute value is less than width()
+     * @param dstY    row index whose absolute value is less than height()
+     * @return        true if pixels were written to Bitmap
+     */
+    fun writePixels(pixmap: Pixmap, dstX: Int = 0, dstY: Int = 0): Boolean {
+        return try {
+            Stats.onNativeCall()
+            _nWritePixelsFromPixmap(_ptr, getPtr(pixmap), dstX, dstY)
+        } finally {
+            reachabilityBarrier(this)
+            reachabilityBarrier(pixmap)
+        }
+    }
+
+    /**
+     * Converts all Bitmap pixels into dstPixmap ColorType, AlphaType and ColorSpace.
+     * See [Pixmap.convertPixels].
+     *
+     * @param dstPixmap  destination of the same width and height
+     * @return           true if pixels were converted
+     */
+    fun convertPixels(dstPixmap: Pixmap): Boolean {
+        return try {
+            Stats.onNativeCall()
+            _nConvertPixels(_ptr, getPtr(dstPixmap))
+        } finally {
+            reachabilityBarrier(this)
+            reachabilityBarrier(dstPixmap)
+        }
+    }
+
     /**
      *
      * Sets dst to alpha described by pixels. Returns false if dst cannot
@@ -1148,6 +1275,9 @@ private external fun _nInstallPixels(
 ): Boolean
 
 
+@ExternalSymbolName("org_jetbrains_skia_Bitmap__1nInstallPixelsFromPixmap")
+private external fun _nInstallPixelsFromPixmap(ptr: NativePointer, pixmapPtr: NativePointer): Boolean
+
 @ExternalSymbolName("org_jetbrains_skia_Bitmap__1nAllocPixels")
 private external fun _nAllocPixels(ptr: NativePointer): Boolean
 
@@ -1207,3 +1337,12 @@ private external fun _nPeekPixels(ptr: NativePointer): NativePointer
 
 @ExternalSymbolName("org_jetbrains_skia_Bitmap__1nMakeShader")
 private external fun _nMakeShader(ptr: NativePointer, tmx: Int, tmy: Int, samplingModeValue1: Int, samplingModeValue2: Int, localMatrix: InteropPointer): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_Bitmap__1nReadPixelsToPixmap")
+private external fun _nReadPixelsToPixmap(ptr: NativePointer, pixmapPtr: NativePointer, srcX: Int, srcY: Int): Boolean
+
+@ExternalSymbolName("org_jetbrains_skia_Bitmap__1nWritePixelsFromPixmap")
+private external fun _nWritePixelsFromPixmap(ptr: NativePointer, pixmapPtr: NativePointer, dstX: Int, dstY: Int): Boolean
+
+@ExternalSymbolName("org_jetbrains_skia_Bitmap__1nConvertPixels")
+private external fun _nConvertPixels(ptr: NativePointer, dstPixmapPtr: NativePointer): Boolean
@@ -294,6 +294,71 @@ open class Canvas internal constructor(ptr: NativePointer, managed: Boolean, int
         return this
     }
 
+    /**
+     * Draws count rectangles packed as (left, top, right, bottom) quadruples in a single native call.
+     *
+     * If colors is not null, it must have one ARGB color per rectangle which replaces the paint color,
+     * other paint attributes are shared. On GPU or recording canvases, 64 or more rectangles filled
+     * without antialiasing, shader, color filter or other effects are submitted as a triangle mesh.
+     *
+     * @param ltrb    rectangle coordinates, 4 floats per rectangle
+     * @param paint   stroke or fill, blend, color, and so on, used to draw
+     * @param colors  optional per-rectangle colors
+     * @return        this
+     */
+    fun drawRects(ltrb: FloatArray, paint: Paint, colors: IntArray? = null): Canvas {
+        require(ltrb.size % 4 == 0) { "Expected ltrb.size % 4 == 0, got: ${ltrb.size}" }
+        val count = ltrb.size / 4
+        require(colors == null || colors.size == count) { "Expected colors.size == $count, got: ${colors?.size}" }
+        Stats.onNativeCall()
+        interopScope {
+            _nDrawRects(_ptr, toInterop(ltrb), toInterop(colors), count, getPtr(paint))
+        }
+        reachabilityBarrier(paint)
+        return this
+    }
+
+    /**
+     * Draws count rounded rectangles packed as (left, top, right, bottom, radiusX, radiusY)
+     * in a single native call.
+     *
+     * @param rrects  rounded rectangle coordinates and radii, 6 floats per rectangle
+     * @param paint   stroke or fill, blend, color, and so on, used to draw
+     * @param colors  optional per-rectangle colors
+     * @return        this
+     */
+    fun drawRRects(rrects: FloatArray, paint: Paint, colors: IntArray? = null): Canvas {
+        require(rrects.size % 6 == 0) { "Expected rrects.size % 6 == 0, got: ${rrects.size}" }
+        val count = rrects.size / 6
+        require(colors == null || colors.size == count) { "Expected colors.size == $count, got: ${colors?.size}" }
+        Stats.onNativeCall()
+        interopScope {
+            _nDrawRRects(_ptr, toInterop(rrects), toInterop(colors), count, getPtr(paint))
+        }
+        reachabilityBarrier(paint)
+        return this
+    }
+
+    /**
+     * Draws count circles packed as (x, y, radius) triples in a single native call.
+     *
+     * @param circles  circle centers and radii, 3 floats per circle
+     * @param paint    stroke or fill, blend, color, and so on, used to draw
+     * @param colors   optional per-circle colors
+     * @return         this
+     */
+    fun drawCircles(circles: FloatArray, paint: Paint, colors: IntArray? = null): Canvas {
+        require(circles.size % 3 == 0) { "Expected circles.size % 3 == 0, got: ${circles.size}" }
+        val count = circles.size / 3
+        require(colors == null || colors.size == count) { "Expected colors.size == $count, got: ${colors?.size}" }
+        Stats.onNativeCall()
+        interopScope {
+            _nDrawCircles(_ptr, toInterop(circles), toInterop(colors), count, getPtr(paint))
+        }
+        reachabilityBarrier(paint)
+        return this
+    }
+
     fun drawDRRect(outer: RRect, inner: RRect, paint: Paint): Canvas {
         Stats.onNativeCall()
         interopScope {
@@ -438,6 +503,58 @@ open class Canvas internal constructor(ptr: NativePointer, managed: Boolean, int
         return this
     }
 
+    /**
+     * Draws count sprites from atlas image in a single call.
+     *
+     * Sprite i is taken from the texRects rectangle (left, top, right, bottom) at i * 4
+     * and placed with the RSXform (scos, ssin, tx, ty) at i * 4. If colors is not null,
+     * colors[i] is combined with the sprite using blendMode.
+     *
+     * @param image        atlas image containing all sprites
+     * @param xforms       packed RSXform per sprite, 4 floats each
+     * @param texRects     packed source rectangle per sprite, 4 floats each
+     * @param colors       optional color per sprite
+     * @param blendMode    how colors are combined with sprites, ignored if colors is null
+     * @param samplingMode how image is sampled
+     * @param cullRect     optional conservative bounds of all sprites, used for quick reject
+     * @param paint        Paint with ColorFilter, ImageFilter, BlendMode, and so on; or null
+     * @return             this
+     */
+    fun drawAtlas(
+        image: Image,
+        xforms: FloatArray,
+        texRects: FloatArray,
+        colors: IntArray? = null,
+        blendMode: BlendMode = BlendMode.MODULATE,
+        samplingMode: SamplingMode = SamplingMode.DEFAULT,
+        cullRect: Rect? = null,
+        paint: Paint? = null
+    ): Canvas {
+        require(xforms.size % 4 == 0) { "Expected xforms.size % 4 == 0, got: ${xforms.size}" }
+        val count = xforms.size / 4
+        require(texRects.size == xforms.size) { "Expected texRects.size == ${xforms.size}, got: ${texRects.size}" }
+        require(colors == null || colors.size == count) { "Expected colors.size == $count, got: ${colors?.size}" }
+        Stats.onNativeCall()
+        interopScope {
+            _nDrawAtlas(
+                _ptr,
+                getPtr(image),
+                toInterop(xforms),
+                toInterop(texRects),
+                toInterop(colors),
+                count,
+                blendMode.ordinal,
+                samplingMode._packedInt1(),
+                samplingMode._packedInt2(),
+                toInterop(cullRect?.let { floatArrayOf(it.left, it.top, it.right, it.bottom) }),
+                getPtr(paint)
+            )
+        }
+        reachabilityBarrier(image)
+        reachabilityBarrier(paint)
+        return this
+    }
+
     fun drawImageNine(image: Image, center: IRect, dst: Rect, filterMode: FilterMode, paint: Paint?): Canvas {
         Stats.onNativeCall()
         _nDrawImageNine(
@@ -483,6 +600,59 @@ open class Canvas internal constructor(ptr: NativePointer, managed: Boolean, int
         return this
     }
 
+    /**
+     * Draws many short positioned glyph runs that share font and paint in a single call, e.g.
+     * chart axis labels or table cells, without building a [TextBlob] per label.
+     *
+     * Run i covers glyphs from runOffsets[i] up to runOffsets[i + 1], the last run ends at
+     * glyphs.size. Each glyph is drawn at its (x, y) from positions, offset by its run origin
+     * (x, y) from origins.
+     *
+     * @param font        font used for all glyphs
+     * @param glyphs      glyphs of all runs, concatenated
+     * @param positions   (x, y) per glyph relative to its run origin
+     * @param runOffsets  index of the first glyph of each run, starting with 0
+     * @param origins     (x, y) per run
+     * @param paint       blend, color, and so on, used to draw
+     * @return            this
+     */
+    fun drawGlyphRuns(
+        font: Font,
+        glyphs: ShortArray,
+        positions: FloatArray,
+        runOffsets: IntArray,
+        origins: FloatArray,
+        paint: Paint
+    ): Canvas {
+        require(positions.size == glyphs.size * 2) { "Expected positions.size == ${glyphs.size * 2}, got: ${positions.size}" }
+        require(origins.size == runOffsets.size * 2) { "Expected origins.size == ${runOffsets.size * 2}, got: ${origins.size}" }
+        if (glyphs.isEmpty() || runOffsets.isEmpty())
+            return this
+        require(runOffsets[0] == 0) { "Expected runOffsets[0] == 0, got: ${runOffsets[0]}" }
+        for (i in 1 until runOffsets.size) {
+            require(runOffsets[i] >= runOffsets[i - 1] && runOffsets[i] <= glyphs.size) {
+                "Expected non-decreasing runOffsets within [0, ${glyphs.size}], got: ${runOffsets[i]} at $i"
+            }
+        }
+        Stats.onNativeCall()
+        interopScope {
+            _nDrawGlyphRuns(
+                _ptr,
+                getPtr(font),
+                toInterop(glyphs),
+                toInterop(positions),
+                glyphs.size,
+                toInterop(runOffsets),
+                toInterop(origins),
+                runOffsets.size,
+                getPtr(paint)
+            )
+        }
+        reachabilityBarrier(font)
+        reachabilityBarrier(paint)
+        return this
+    }
+
     fun drawTextLine(line: TextLine, x: Float, y: Float, paint: Paint): Canvas {
         line.textBlob?.use { blob -> blob.let { drawTextBlob(it, x, y, paint) } }
         return this
@@ -887,6 +1057,25 @@ open class Canvas internal constructor(ptr: NativePointer, managed: Boolean, int
         return this
     }
 
+    /**
+     * Draws a mesh that was built once in native memory. Unlike the array overload,
+     * vertex data is not copied on every call.
+     *
+     * @param vertices  mesh to draw
+     * @param mode      combines vertices colors with Shader, if both are present
+     * @param paint     specifies the Shader, used as Vertices texture
+     * @return          this
+     *
+     * @see [https://fiddle.skia.org/c/@Canvas_drawVertices](https://fiddle.skia.org/c/@Canvas_drawVertices)
+     */
+    fun drawVertices(vertices: Vertices, mode: BlendMode, paint: Paint): Canvas {
+        Stats.onNativeCall()
+        _nDrawVerticesObject(_ptr, getPtr(vertices), mode.ordinal, getPtr(paint))
+        reachabilityBarrier(vertices)
+        reachabilityBarrier(paint)
+        return this
+    }
+
     /**
      *
      * Draws a Coons patch: the interpolation of four cubics with shared corners,
@@ -1306,6 +1495,32 @@ open class Canvas internal constructor(ptr: NativePointer, managed: Boolean, int
         }
     }
 
+    /**
+     * Copies Rect of pixels from Canvas into pixmap. Same as [readPixels] with Bitmap, but
+     * writes straight into the memory pixmap points to, so no intermediate copy is made.
+     *
+     * @param pixmap  destination pixels and ImageInfo
+     * @param srcX    offset into readable pixels on x-axis; may be negative
+     * @param srcY    offset into readable pixels on y-axis; may be negative
+     * @return        true if pixels were copied
+     *
+     * @see [https://fiddle.skia.org/c/@Canvas_readPixels_2](https://fiddle.skia.org/c/@Canvas_readPixels_2)
+     */
+    fun readPixels(pixmap: Pixmap, srcX: Int, srcY: Int): Boolean {
+        return try {
+            Stats.onNativeCall()
+            _nReadPixelsToPixmap(
+                _ptr,
+                getPtr(pixmap),
+                srcX,
+                srcY
+            )
+        } finally {
+            reachabilityBarrier(this)
+            reachabilityBarrier(pixmap)
+        }
+    }
+
     /**
      *
      * Copies Rect from pixels to Canvas. Matrix and clip are ignored.
@@ -1371,6 +1586,30 @@ open class Canvas internal constructor(ptr: NativePointer, managed: Boolean, int
         }
     }
 
+    /**
+     * Copies Rect from pixmap to Canvas. Same as [writePixels] with Bitmap, but
+     * reads straight from the memory pixmap points to.
+     *
+     * @param pixmap  contains pixels copied to Canvas
+     * @param x       offset into Canvas writable pixels on x-axis; may be negative
+     * @param y       offset into Canvas writable pixels on y-axis; may be negative
+     * @return        true if pixels were written to Canvas
+     */
+    fun writePixels(pixmap: Pixmap, x: Int, y: Int): Boolean {
+        return try {
+            Stats.onNativeCall()
+            _nWritePixelsFromPixmap(
+                _ptr,
+                getPtr(pixmap),
+                x,
+                y
+            )
+        } finally {
+            reachabilityBarrier(this)
+            reachabilityBarrier(pixmap)
+        }
+    }
+
     fun save(): Int {
         return try {
             Stats.onNativeCall()
@@ -1519,6 +1758,15 @@ private external fun _nDrawRRect(
     paintPtr: NativePointer
 )
 
+@ExternalSymbolName("org_jetbrains_skia_Canvas__1nDrawRects")
+private external fun _nDrawRects(ptr: NativePointer, ltrb: InteropPointer, colors: InteropPointer, count: Int, paintPtr: NativePointer)
+
+@ExternalSymbolName("org_jetbrains_skia_Canvas__1nDrawRRects")
+private external fun _nDrawRRects(ptr: NativePointer, rrects: InteropPointer, colors: InteropPointer, count: Int, paintPtr: NativePointer)
+
+@ExternalSymbolName("org_jetbrains_skia_Canvas__1nDrawCircles")
+private external fun _nDrawCircles(ptr: NativePointer, circles: InteropPointer, colors: InteropPointer, count: Int, paintPtr: NativePointer)
+
 
 @ExternalSymbolName("org_jetbrains_skia_Canvas__1nDrawDRRect")
 private external fun _nDrawDRRect(
@@ -1561,6 +1809,22 @@ private external fun _nDrawImageRect(
 )
 
 
+@ExternalSymbolName("org_jetbrains_skia_Canvas__1nDrawAtlas")
+private external fun _nDrawAtlas(
+    ptr: NativePointer,
+    imagePtr: NativePointer,
+    xforms: InteropPointer,
+    texRects: InteropPointer,
+    colors: InteropPointer,
+    count: Int,
+    blendMode: Int,
+    samplingModeVal1: Int,
+    samplingModeVal2: Int,
+    cullRect: InteropPointer,
+    paintPtr: NativePointer
+)
+
+
 @ExternalSymbolName("org_jetbrains_skia_Canvas__1nDrawImageNine")
 private external fun _nDrawImageNine(
     ptr: NativePointer,
@@ -1587,6 +1851,19 @@ private external fun _nDrawString(ptr: NativePointer, string: String?, x: Float,
 @ExternalSymbolName("org_jetbrains_skia_Canvas__1nDrawTextBlob")
 private external fun _nDrawTextBlob(ptr: NativePointer, blob: NativePointer, x: Float, y: Float, paint: NativePointer)
 
+@ExternalSymbolName("org_jetbrains_skia_Canvas__1nDrawGlyphRuns")
+private external fun _nDrawGlyphRuns(
+    ptr: NativePointer,
+    fontPtr: NativePointer,
+    glyphs: InteropPointer,
+    positions: InteropPointer,
+    glyphCount: Int,
+    runOffsets: InteropPointer,
+    origins: InteropPointer,
+    runCount: Int,
+    paintPtr: NativePointer
+)
+
 @ExternalSymbolName("org_jetbrains_skia_Canvas__1nDrawPicture")
 private external fun _nDrawPicture(ptr: NativePointer, picturePtr: NativePointer, matrix: InteropPointer, paintPtr: NativePointer)
 
@@ -1605,6 +1882,9 @@ private external fun _nDrawVertices(
     paintPtr: NativePointer
 )
 
+@ExternalSymbolName("org_jetbrains_skia_Canvas__1nDrawVerticesObject")
+private external fun _nDrawVerticesObject(ptr: NativePointer, verticesPtr: NativePointer, blendMode: Int, paintPtr: NativePointer)
+
 
 @ExternalSymbolName("org_jetbrains_skia_Canvas__1nDrawPatch")
 private external fun _nDrawPatch(
@@ -1681,6 +1961,12 @@ private external fun _nReadPixels(ptr: NativePointer, bitmapPtr: NativePointer,
 @ExternalSymbolName("org_jetbrains_skia_Canvas__1nWritePixels")
 private external fun _nWritePixels(ptr: NativePointer, bitmapPtr: NativePointer, x: Int, y: Int): Boolean
 
+@ExternalSymbolName("org_jetbrains_skia_Canvas__1nReadPixelsToPixmap")
+private external fun _nReadPixelsToPixmap(ptr: NativePointer, pixmapPtr: NativePointer, srcX: Int, srcY: Int): Boolean
+
+@ExternalSymbolName("org_jetbrains_skia_Canvas__1nWritePixelsFromPixmap")
+private external fun _nWritePixelsFromPixmap(ptr: NativePointer, pixmapPtr: NativePointer, x: Int, y: Int): Boolean
+
 @ExternalSymbolName("org_jetbrains_skia_Canvas__1nSave")
 private external fun _nSave(ptr: NativePointer): Int
 
@@ -0,0 +1,17 @@
+package org.jetbrains.skia
+
+/**
+ * Speed/size trade-off used by [Image.encodeToStream].
+ * Currently affects [EncodedImageFormat.PNG] only.
+ */
+enum class EncodePreset {
+    /**
+     * zlib level 6 with adaptive per-row filters, output size comparable to [Image.encodeToData].
+     */
+    DEFAULT,
+
+    /**
+     * zlib level 1 with Sub filter only, several times faster at the cost of bigger output.
+     */
+    FAST;
+}
@@ -19,6 +19,41 @@ class Font : Managed {
             return Font(Font_nMakeClone(ptr))
         }
 
+        /**
+         * Counters of the process-wide glyph outline cache used by [getPath], [getPaths] and
+         * [getPathsCombined].
+         */
+        val pathCacheStats: GlyphPathCacheStats
+            get() {
+                Stats.onNativeCall()
+                val result = withResult(IntArray(6)) {
+                    _nGetPathCacheStats(it)
+                }
+                return GlyphPathCacheStats(
+                    hits = result[0],
+                    misses = result[1],
+                    evictions = result[2],
+                    count = result[3],
+                    bytesUsed = result[4],
+                    byteBudget = result[5]
+                )
+            }
+
+        /**
+         * Sets maximum number of bytes occupied by cached glyph outlines, evicting least recently
+         * used outlines if needed.
+         */
+        fun setPathCacheByteBudget(byteBudget: Int) {
+            require(byteBudget >= 0) { "Expected non-negative byteBudget, got: $byteBudget" }
+            Stats.onNativeCall()
+            _nSetPathCacheByteBudget(byteBudget)
+        }
+
+        fun purgePathCache() {
+            Stats.onNativeCall()
+            _nPurgePathCache()
+        }
+
         init {
             staticLoad()
         }
@@ -532,14 +567,21 @@ class Font : Managed {
     }
 
     /**
-     * Return glyph outlines, some of which might be null.
+     * Return outlines of glyphs that have them, glyphs without outline are skipped.
+     *
+     * Outlines are cached per typeface, size, scale, skew and fake bold, so converting the same
+     * text again doesn't extract them again.
+     *
+     * @param glyphs    glyphs to get outlines of
+     * @param parallel  extract outlines missing from the cache on multiple threads,
+     *                  worth it for thousands of distinct glyphs
      */
-    fun getPaths(glyphs: ShortArray?): Array<Path> {
+    fun getPaths(glyphs: ShortArray?, parallel: Boolean = false): Array<Path> {
         return try {
             Stats.onNativeCall()
             arrayDecoderScope({
                 ArrayDecoder(
-                    interopScope { _nGetPaths(_ptr, toInterop(glyphs), glyphs?.size ?: 0) }, Path_nGetFinalizer()
+                    interopScope { _nGetPaths(_ptr, toInterop(glyphs), glyphs?.size ?: 0, parallel) }, Path_nGetFinalizer()
                 )
             }) { arrayDecoder ->
                 (0 until arrayDecoder.size).map { i->
@@ -551,6 +593,34 @@ class Font : Managed {
         }
     }
 
+    /**
+     * Returns outlines of all glyphs combined into a single [Path], e.g. for outlining a label
+     * or exporting it to SVG, in one native call.
+     *
+     * @param glyphs     glyphs to get outlines of
+     * @param positions  (x, y) per glyph to offset its outline by, or null to keep all at origin
+     * @param parallel   extract outlines missing from the cache on multiple threads
+     * @return           combined path, with [GlyphPaths.verbOffsets] telling where each glyph starts
+     */
+    fun getPathsCombined(glyphs: ShortArray, positions: FloatArray? = null, parallel: Boolean = false): GlyphPaths {
+        require(positions == null || positions.size == glyphs.size * 2) {
+            "Expected positions.size == ${glyphs.size * 2}, got: ${positions?.size}"
+        }
+        return try {
+            Stats.onNativeCall()
+            val verbOffsets = IntArray(glyphs.size + 1)
+            val ptr = interopScope {
+                val verbOffsetsHandle = toInterop(verbOffsets)
+                _nGetPathsCombined(_ptr, toInterop(glyphs), glyphs.size, toInterop(positions), parallel, verbOffsetsHandle).also {
+                    verbOffsetsHandle.fromInterop(verbOffsets)
+                }
+            }
+            GlyphPaths(Path(ptr), verbOffsets)
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
     /**
      * Returns FontMetrics associated with Typeface. Results are scaled by text size but does not take into account
      * dimensions required by text scale, text skew, fake bold, style stroke, and [PathEffect].
@@ -710,7 +780,26 @@ private external fun _nGetXPositions(ptr: NativePointer, glyphs: InteropPointer,
 private external fun _nGetPath(ptr: NativePointer, glyph: Short): NativePointer
 
 @ExternalSymbolName("org_jetbrains_skia_Font__1nGetPaths")
-private external fun _nGetPaths(ptr: NativePointer, glyphs: InteropPointer, count: Int): NativePointer
+private external fun _nGetPaths(ptr: NativePointer, glyphs: InteropPointer, count: Int, parallel: Boolean): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_Font__1nGetPathsCombined")
+private external fun _nGetPathsCombined(
+    ptr: NativePointer,
+    glyphs: InteropPointer,
+    count: Int,
+    positions: InteropPointer,
+    parallel: Boolean,
+    verbOffsets: InteropPointer
+): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_Font__1nGetPathCacheStats")
+private external fun _nGetPathCacheStats(result: InteropPointer)
+
+@ExternalSymbolName("org_jetbrains_skia_Font__1nSetPathCacheByteBudget")
+private external fun _nSetPathCacheByteBudget(byteBudget: Int)
+
+@ExternalSymbolName("org_jetbrains_skia_Font__1nPurgePathCache")
+private external fun _nPurgePathCache()
 
 @ExternalSymbolName("org_jetbrains_skia_Font__1nGetMetrics")
 private external fun _nGetMetrics(ptr: NativePointer, metrics: InteropPointer)
@@ -16,7 +16,34 @@ open class FontMgr : RefCnt {
             staticLoad()
         }
 
+        /**
+         * System font manager. Family names and styles are read once per process and
+         * matching results are remembered, so repeated lookups don't query the system again.
+         */
         val default = FontMgr(_nDefault(), false)
+
+        /**
+         * Takes family names and styles of [default] from a file written by [saveIndex]
+         * instead of enumerating system fonts. Has to be called before [default] is first used.
+         *
+         * Only supported with fontconfig. Snapshots are keyed by the modification time of
+         * fontconfig caches, so they are ignored once fonts are installed or removed.
+         *
+         * @return  false if file is missing, outdated, or family names were read already
+         */
+        fun loadIndex(path: String): Boolean {
+            Stats.onNativeCall()
+            return interopScope { _nLoadIndex(toInterop(path)) }
+        }
+
+        /**
+         * Writes family names and styles of [default] to a temporary file next to path
+         * and renames it over path.
+         */
+        fun saveIndex(path: String): Boolean {
+            Stats.onNativeCall()
+            return interopScope { _nSaveIndex(toInterop(path)) }
+        }
     }
 
     val familiesCount: Int
@@ -194,3 +221,9 @@ private external fun _nMakeFromData(ptr: NativePointer, dataPtr: NativePointer,
 
 @ExternalSymbolName("org_jetbrains_skia_FontMgr__1nDefault")
 private external fun _nDefault(): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_FontMgr__1nLoadIndex")
+private external fun _nLoadIndex(path: InteropPointer): Boolean
+
+@ExternalSymbolName("org_jetbrains_skia_FontMgr__1nSaveIndex")
+private external fun _nSaveIndex(path: InteropPointer): Boolean
@@ -0,0 +1,105 @@
+package org.jetbrains.skia
+
+import org.jetbrains.skia.impl.*
+import org.jetbrains.skia.impl.Library.Companion.staticLoad
+
+/**
+ * Captures everything drawn during a frame into a [Picture], for reproducing rendering problems
+ * and building replay benchmarks.
+ *
+ * While capturing, [beginCapture] returns a canvas that forwards every operation both to the
+ * target canvas and to a picture recorder, so the frame is still rendered as usual.
+ * [serialize] produces a self-contained capture in the standard SKP format, with typefaces and
+ * images embedded; it can be replayed with the skiko-replay harness (`linkReplayHarness*`
+ * Gradle tasks) or any Skia tool that reads SKP files.
+ *
+ * Not thread safe.
+ */
+class FrameCapture internal constructor(ptr: NativePointer) : Managed(ptr, _FinalizerHolder.PTR) {
+    companion object {
+        init {
+            staticLoad()
+        }
+
+        /**
+         * Serializes picture with typeface data and encoded images embedded, so it doesn't
+         * depend on fonts installed on the machine it's replayed on. Texture-backed images are
+         * read back to CPU memory.
+         */
+        fun serialize(picture: Picture): Data {
+            return try {
+                Stats.onNativeCall()
+                Data(_nSerialize(getPtr(picture)))
+            } finally {
+                reachabilityBarrier(picture)
+            }
+        }
+    }
+
+    constructor() : this(FrameCapture_nMake()) {
+        Stats.onNativeCall()
+    }
+
+    private object _FinalizerHolder {
+        val PTR = FrameCapture_nGetFinalizer()
+    }
+
+    /**
+     * Starts capturing. Returned canvas is valid until [finishCapture], target canvas must stay
+     * alive until then as well.
+     *
+     * @param target  canvas to draw the frame into, or null to only record it
+     * @param bounds  captured area in target canvas local coordinates
+     */
+    fun beginCapture(target: Canvas?, bounds: Rect): Canvas {
+        return try {
+            Stats.onNativeCall()
+            Canvas(_nBeginCapture(_ptr, getPtr(target), bounds.left, bounds.top, bounds.right, bounds.bottom), false, this)
+        } finally {
+            reachabilityBarrier(this)
+            reachabilityBarrier(target)
+        }
+    }
+
+    /**
+     * Stops capturing. Matrix, clip and save count of the target are restored to their state
+     * before [beginCapture].
+     *
+     * @return  captured frame, or null if capture was not started
+     */
+    fun finishCapture(): Picture? {
+        return try {
+            Stats.onNativeCall()
+            val ptr = _nFinishCapture(_ptr)
+            if (ptr == NullPointer) null else Picture(ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    val isCapturing: Boolean
+        get() = try {
+            Stats.onNativeCall()
+            _nIsCapturing(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+}
+
+@ExternalSymbolName("org_jetbrains_skia_FrameCapture__1nGetFinalizer")
+private external fun FrameCapture_nGetFinalizer(): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_FrameCapture__1nMake")
+private external fun FrameCapture_nMake(): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_FrameCapture__1nBeginCapture")
+private external fun _nBeginCapture(ptr: NativePointer, canvasPtr: NativePointer, left: Float, top: Float, right: Float, bottom: Float): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_FrameCapture__1nFinishCapture")
+private external fun _nFinishCapture(ptr: NativePointer): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_FrameCapture__1nIsCapturing")
+private external fun _nIsCapturing(ptr: NativePointer): Boolean
+
+@ExternalSymbolName("org_jetbrains_skia_FrameCapture__1nSerialize")
+private external fun _nSerialize(picturePtr: NativePointer): NativePointer
@@ -0,0 +1,20 @@
+package org.jetbrains.skia
+
+/**
+ * Snapshot of the glyph outline cache counters, see [Font.pathCacheStats].
+ *
+ * @property hits        number of outlines served from the cache
+ * @property misses      number of outlines extracted from the typeface
+ * @property evictions   number of outlines dropped to stay within the budget
+ * @property count       number of outlines currently cached
+ * @property bytesUsed   approximate bytes occupied by cached outlines
+ * @property byteBudget  maximum number of bytes the cache may occupy
+ */
+data class GlyphPathCacheStats(
+    val hits: Int,
+    val misses: Int,
+    val evictions: Int,
+    val count: Int,
+    val bytesUsed: Int,
+    val byteBudget: Int
+)
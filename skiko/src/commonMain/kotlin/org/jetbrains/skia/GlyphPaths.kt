@@ -0,0 +1,9 @@
+package org.jetbrains.skia
+
+/**
+ * Outlines of several glyphs combined into one path, see [Font.getPathsCombined].
+ *
+ * @property path         combined outlines
+ * @property verbOffsets  glyphs.size + 1 entries, verbs of glyph i are [verbOffsets[i], verbOffsets[i + 1])
+ */
+class GlyphPaths(val path: Path, val verbOffsets: IntArray)
@@ -209,6 +209,34 @@ class Image internal constructor(ptr: NativePointer) : RefCnt(ptr), IHasImageInf
         }
     }
 
+    /**
+     * Encodes Image pixels into stream without creating an intermediate [Data].
+     *
+     * PNG is encoded in horizontal bands which are filtered and compressed in parallel,
+     * then written into stream in order on the calling thread. Other formats are
+     * streamed with the platform encoder.
+     *
+     * @param stream   destination stream
+     * @param format   one of: [EncodedImageFormat.JPEG], [EncodedImageFormat.PNG], [EncodedImageFormat.WEBP]
+     * @param quality  encoder specific metric with 100 equaling best, ignored by PNG
+     * @param preset   speed/size trade-off, see [EncodePreset]
+     * @return         true if Image was encoded, false if format is not supported or encoding fails
+     */
+    fun encodeToStream(
+        stream: WStream,
+        format: EncodedImageFormat = EncodedImageFormat.PNG,
+        quality: Int = 100,
+        preset: EncodePreset = EncodePreset.DEFAULT
+    ): Boolean {
+        return try {
+            Stats.onNativeCall()
+            _nEncodeToStream(_ptr, getPtr(stream), format.ordinal, quality, preset.ordinal)
+        } finally {
+            reachabilityBarrier(this)
+            reachabilityBarrier(stream)
+        }
+    }
+
     fun makeShader(localMatrix: Matrix33?): Shader {
         return makeShader(FilterTileMode.CLAMP, FilterTileMode.CLAMP, SamplingMode.DEFAULT, localMatrix)
     }
@@ -427,6 +455,9 @@ private external fun _nMakeFromEncoded(bytes: InteropPointer, encodedLength: Int
 @ExternalSymbolName("org_jetbrains_skia_Image__1nEncodeToData")
 private external fun _nEncodeToData(ptr: NativePointer, format: Int, quality: Int): NativePointer
 
+@ExternalSymbolName("org_jetbrains_skia_Image__1nEncodeToStream")
+private external fun _nEncodeToStream(ptr: NativePointer, wstreamPtr: NativePointer, format: Int, quality: Int, preset: Int): Boolean
+
 @ExternalSymbolName("org_jetbrains_skia_Image__1nPeekPixelsToPixmap")
 private external fun _nPeekPixelsToPixmap(ptr: NativePointer, pixmapPtr: NativePointer): Boolean
 
@@ -0,0 +1,179 @@
+package org.jetbrains.skia
+
+import org.jetbrains.skia.impl.*
+import org.jetbrains.skia.impl.Library.Companion.staticLoad
+
+/**
+ * LRU cache of decoded images with a byte budget.
+ *
+ * Images are keyed by the content of their encoded bytes together with the requested
+ * size and color type, so decoding the same resource again returns the same [Image].
+ * The cache can be shared between threads.
+ */
+class ImageCache internal constructor(ptr: NativePointer) : RefCnt(ptr) {
+    companion object {
+        const val DEFAULT_BYTE_BUDGET = 64 * 1024 * 1024
+
+        init {
+            staticLoad()
+        }
+    }
+
+    constructor(byteBudget: Int = DEFAULT_BYTE_BUDGET) : this(ImageCache_nMake(checkByteBudget(byteBudget))) {
+        Stats.onNativeCall()
+    }
+
+    /**
+     * Returns decoded image for encoded bytes, decoding and caching it on miss.
+     *
+     * @param encoded    encoded image data
+     * @param width      requested width, or 0 to use encoded width
+     * @param height     requested height, or 0 to use encoded height
+     * @param colorType  requested color type, or [ColorType.UNKNOWN] to use [ColorType.N32]
+     * @return           decoded image, or null if data can't be decoded
+     */
+    fun findOrDecode(
+        encoded: Data,
+        width: Int = 0,
+        height: Int = 0,
+        colorType: ColorType = ColorType.UNKNOWN
+    ): Image? {
+        return try {
+            Stats.onNativeCall()
+            val ptr = _nFindOrDecode(_ptr, getPtr(encoded), width, height, colorType.ordinal)
+            if (ptr == NullPointer) null else Image(ptr)
+        } finally {
+            reachabilityBarrier(this)
+            reachabilityBarrier(encoded)
+        }
+    }
+
+    fun findOrDecode(
+        bytes: ByteArray,
+        width: Int = 0,
+        height: Int = 0,
+        colorType: ColorType = ColorType.UNKNOWN
+    ): Image? {
+        return Data.makeFromBytes(bytes).use { data ->
+            findOrDecode(data, width, height, colorType)
+        }
+    }
+
+    /**
+     * Maximum number of bytes occupied by decoded pixels and their encoded keys.
+     * Lowering the budget evicts least recently used entries immediately.
+     */
+    var byteBudget: Int
+        get() = try {
+            Stats.onNativeCall()
+            _nGetByteBudget(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+        set(value) = try {
+            checkByteBudget(value)
+            Stats.onNativeCall()
+            _nSetByteBudget(_ptr, value)
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    /**
+     * Evicts least recently used entries until at most targetBytes are used.
+     */
+    fun purgeToBytes(targetBytes: Int) {
+        require(targetBytes >= 0) { "Expected non-negative targetBytes, got: $targetBytes" }
+        try {
+            Stats.onNativeCall()
+            _nPurgeToBytes(_ptr, targetBytes)
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    /**
+     * Evicts all entries and increments [ImageCacheStats.generationId].
+     */
+    fun purgeAll() {
+        try {
+            Stats.onNativeCall()
+            _nPurgeAll(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    /**
+     * Should be called when the platform reports low memory. Halves memory usage,
+     * or drops all entries if critical is true.
+     */
+    fun onMemoryPressure(critical: Boolean) {
+        try {
+            Stats.onNativeCall()
+            _nOnMemoryPressure(_ptr, critical)
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    val stats: ImageCacheStats
+        get() = try {
+            Stats.onNativeCall()
+            val result = withResult(IntArray(7)) {
+                _nGetStats(_ptr, it)
+            }
+            ImageCacheStats(
+                hits = result[0],
+                misses = result[1],
+                evictions = result[2],
+                count = result[3],
+                bytesUsed = result[4],
+                byteBudget = result[5],
+                generationId = result[6]
+            )
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    fun resetStats() {
+        try {
+            Stats.onNativeCall()
+            _nResetStats(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+}
+
+// Native side takes the budget as size_t, where negative values mean no limit at all
+private fun checkByteBudget(byteBudget: Int): Int {
+    require(byteBudget >= 0) { "Expected non-negative byteBudget, got: $byteBudget" }
+    return byteBudget
+}
+
+@ExternalSymbolName("org_jetbrains_skia_ImageCache__1nMake")
+private external fun ImageCache_nMake(byteBudget: Int): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_ImageCache__1nFindOrDecode")
+private external fun _nFindOrDecode(ptr: NativePointer, dataPtr: NativePointer, width: Int, height: Int, colorType: Int): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_ImageCache__1nGetByteBudget")
+private external fun _nGetByteBudget(ptr: NativePointer): Int
+
+@ExternalSymbolName("org_jetbrains_skia_ImageCache__1nSetByteBudget")
+private external fun _nSetByteBudget(ptr: NativePointer, byteBudget: Int)
+
+@ExternalSymbolName("org_jetbrains_skia_ImageCache__1nPurgeToBytes")
+private external fun _nPurgeToBytes(ptr: NativePointer, targetBytes: Int)
+
+@ExternalSymbolName("org_jetbrains_skia_ImageCache__1nPurgeAll")
+private external fun _nPurgeAll(ptr: NativePointer)
+
+@ExternalSymbolName("org_jetbrains_skia_ImageCache__1nOnMemoryPressure")
+private external fun _nOnMemoryPressure(ptr: NativePointer, critical: Boolean)
+
+@ExternalSymbolName("org_jetbrains_skia_ImageCache__1nGetStats")
+private external fun _nGetStats(ptr: NativePointer, result: InteropPointer)
+
+@ExternalSymbolName("org_jetbrains_skia_ImageCache__1nResetStats")
+private external fun _nResetStats(ptr: NativePointer)
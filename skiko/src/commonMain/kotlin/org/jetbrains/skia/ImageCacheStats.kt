@@ -0,0 +1,22 @@
+package org.jetbrains.skia
+
+/**
+ * Snapshot of [ImageCache] counters.
+ *
+ * @property hits          number of lookups served from the cache
+ * @property misses        number of lookups that required decoding
+ * @property evictions     number of entries dropped to stay within the budget
+ * @property count         number of entries currently cached
+ * @property bytesUsed     bytes occupied by cached pixels and encoded keys
+ * @property byteBudget    maximum number of bytes the cache may occupy
+ * @property generationId  incremented every time the cache is purged completely
+ */
+data class ImageCacheStats(
+    val hits: Int,
+    val misses: Int,
+    val evictions: Int,
+    val count: Int,
+    val bytesUsed: Int,
+    val byteBudget: Int,
+    val generationId: Int
+)
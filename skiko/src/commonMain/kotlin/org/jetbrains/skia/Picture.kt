@@ -10,13 +10,23 @@ class Picture internal constructor(ptr: NativePointer) : RefCnt(ptr) {
          * if successful; otherwise, returns null. Fails if data does not permit
          * constructing valid Picture.
          */
-        fun makeFromData(data: Data?): Picture? {
+        fun makeFromData(data: Data?): Picture? = makeFromData(data, null)
+
+        /**
+         * Recreates Picture serialized with [serializeToData] against a [PictureResourceStore].
+         * Typefaces and images are resolved from the store, which must contain the resources
+         * the picture references.
+         *
+         * @param store  store the picture was serialized against; null reads a self-contained picture
+         */
+        fun makeFromData(data: Data?, store: PictureResourceStore?): Picture? {
             return try {
                 Stats.onNativeCall()
-                val ptr = Picture_nMakeFromData(getPtr(data))
+                val ptr = Picture_nMakeFromData(getPtr(data), getPtr(store))
                 if (ptr == NullPointer) null else Picture(ptr)
             } finally {
                 reachabilityBarrier(data)
+                reachabilityBarrier(store)
             }
         }
 
@@ -85,6 +95,36 @@ class Picture internal constructor(ptr: NativePointer) : RefCnt(ptr) {
         }
     }
 
+    /**
+     * Draws this picture into pixmap using several threads.
+     *
+     * Pixmap is split into tiles, and each tile replays the whole picture clipped to the tile
+     * on a native thread pool. The result is identical to [playback] into a raster canvas
+     * backed by the same pixmap.
+     *
+     * @param pixmap      destination pixels
+     * @param matrix      transformation applied to picture, identity if null
+     * @param tileSize    tile width and height in pixels, rounded up to a multiple of 16
+     * @param maxThreads  maximum number of threads to use, 0 to use all available
+     * @return            true if pixmap can be drawn into
+     */
+    fun playbackTiled(
+        pixmap: Pixmap,
+        matrix: Matrix33? = null,
+        tileSize: Int = 256,
+        maxThreads: Int = 0
+    ): Boolean {
+        return try {
+            Stats.onNativeCall()
+            interopScope {
+                _nPlaybackTiled(_ptr, getPtr(pixmap), toInterop(matrix?.mat), tileSize, maxThreads)
+            }
+        } finally {
+            reachabilityBarrier(this)
+            reachabilityBarrier(pixmap)
+        }
+    }
+
     /**
      *
      * Returns cull Rect for this picture, passed in when Picture was created.
@@ -124,12 +164,22 @@ class Picture internal constructor(ptr: NativePointer) : RefCnt(ptr) {
      *
      * @see [https://fiddle.skia.org/c/@Picture_serialize](https://fiddle.skia.org/c/@Picture_serialize)
      */
-    fun serializeToData(): Data {
+    fun serializeToData(): Data = serializeToData(null)
+
+    /**
+     * Serializes Picture without embedding its typefaces and images: each of them is put into
+     * the store once, and the picture only references it. Read it back with [makeFromData]
+     * against the same store, or one restored from [PictureResourceStore.serializeToData].
+     *
+     * @param store  store to put resources into; null embeds them into the picture
+     */
+    fun serializeToData(store: PictureResourceStore?): Data {
         return try {
             Stats.onNativeCall()
-            Data(_nSerializeToData(_ptr))
+            Data(_nSerializeToData(_ptr, getPtr(store)))
         } finally {
             reachabilityBarrier(this)
+            reachabilityBarrier(store)
         }
     }
 
@@ -232,7 +282,10 @@ class Picture internal constructor(ptr: NativePointer) : RefCnt(ptr) {
 }
 
 @ExternalSymbolName("org_jetbrains_skia_Picture__1nMakeFromData")
-private external fun Picture_nMakeFromData(dataPtr: NativePointer /*, SkDeserialProcs */): NativePointer
+private external fun Picture_nMakeFromData(dataPtr: NativePointer, storePtr: NativePointer): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_Picture__1nPlaybackTiled")
+private external fun _nPlaybackTiled(ptr: NativePointer, pixmapPtr: NativePointer, matrix: InteropPointer, tileSize: Int, maxThreads: Int): Boolean
 
 @ExternalSymbolName("org_jetbrains_skia_Picture__1nGetCullRect")
 private external fun _nGetCullRect(ptr: NativePointer, ltrb: InteropPointer)
@@ -241,7 +294,7 @@ private external fun _nGetCullRect(ptr: NativePointer, ltrb: InteropPointer)
 private external fun _nGetUniqueId(ptr: NativePointer): Int
 
 @ExternalSymbolName("org_jetbrains_skia_Picture__1nSerializeToData")
-private external fun _nSerializeToData(ptr: NativePointer /*, SkSerialProcs */): NativePointer
+private external fun _nSerializeToData(ptr: NativePointer, storePtr: NativePointer): NativePointer
 
 @ExternalSymbolName("org_jetbrains_skia_Picture__1nMakePlaceholder")
 private external fun _nMakePlaceholder(left: Float, top: Float, right: Float, bottom: Float): NativePointer
@@ -0,0 +1,15 @@
+package org.jetbrains.skia
+
+/**
+ * Single operation of a profiled picture.
+ *
+ * @property type    kind of the operation
+ * @property bounds  device-space area the operation may touch, clipped to the current clip;
+ *                   empty if the operation was clipped out
+ * @property micros  time the operation took, in microseconds; 0 for nested pictures and drawables
+ */
+data class PictureOp(
+    val type: PictureOpType,
+    val bounds: IRect,
+    val micros: Float
+)
@@ -0,0 +1,14 @@
+package org.jetbrains.skia
+
+/**
+ * Aggregated cost of all operations of one type in a profiled picture.
+ *
+ * @property type    kind of the operations
+ * @property count   number of operations
+ * @property micros  total time of the operations, in microseconds
+ */
+data class PictureOpStats(
+    val type: PictureOpType,
+    val count: Int,
+    val micros: Float
+)
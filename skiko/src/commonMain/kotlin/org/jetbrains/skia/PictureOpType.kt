@@ -0,0 +1,46 @@
+package org.jetbrains.skia
+
+/**
+ * Kinds of canvas operations reported by [PictureProfile].
+ */
+enum class PictureOpType {
+    SAVE,
+    SAVE_LAYER,
+    RESTORE,
+    CLIP_RECT,
+    CLIP_RRECT,
+    CLIP_PATH,
+    CLIP_SHADER,
+    CLIP_REGION,
+    DRAW_PAINT,
+    DRAW_BEHIND,
+    DRAW_RECT,
+    DRAW_RRECT,
+    DRAW_DRRECT,
+    DRAW_OVAL,
+    DRAW_ARC,
+    DRAW_PATH,
+    DRAW_REGION,
+    DRAW_TEXT_BLOB,
+    DRAW_PATCH,
+    DRAW_POINTS,
+    DRAW_IMAGE,
+    DRAW_IMAGE_RECT,
+    DRAW_IMAGE_LATTICE,
+    DRAW_ATLAS,
+    DRAW_EDGE_AA_IMAGE_SET,
+    DRAW_VERTICES,
+    DRAW_ANNOTATION,
+    DRAW_SHADOW,
+
+    /** Nested drawable, its content is reported as separate ops. */
+    DRAW_DRAWABLE,
+
+    /** Nested picture, its content is reported as separate ops. */
+    DRAW_PICTURE,
+    DRAW_EDGE_AA_QUAD;
+
+    companion object {
+        internal val _values = values()
+    }
+}
@@ -0,0 +1,179 @@
+package org.jetbrains.skia
+
+import org.jetbrains.skia.impl.*
+import org.jetbrains.skia.impl.Library.Companion.staticLoad
+
+/**
+ * Cost profile of a single raster playback of a [Picture].
+ *
+ * Picture is replayed into a raster canvas of the given size, timing every operation and
+ * recording its device-space bounds. Nested pictures and drawables are unrolled, so their
+ * content is profiled operation by operation. A second playback counts how many times each
+ * pixel is drawn, see [overdraw].
+ *
+ * Timings are measured on the CPU raster backend and are meant to compare operations
+ * within a picture, not to predict GPU frame time.
+ *
+ * @param picture  picture to profile
+ * @param width    width of the raster canvas, right edge of the picture cull rect by default
+ * @param height   height of the raster canvas, bottom edge of the picture cull rect by default
+ */
+class PictureProfile internal constructor(ptr: NativePointer) : Managed(ptr, _FinalizerHolder.PTR) {
+    companion object {
+        init {
+            staticLoad()
+        }
+    }
+
+    constructor(
+        picture: Picture,
+        width: Int = kotlin.math.ceil(picture.cullRect.right).toInt(),
+        height: Int = kotlin.math.ceil(picture.cullRect.bottom).toInt()
+    ) : this(makeProfile(picture, width, height))
+
+    private object _FinalizerHolder {
+        val PTR = PictureProfile_nGetFinalizer()
+    }
+
+    /**
+     * All operations in playback order.
+     */
+    val ops: List<PictureOp>
+        get() = try {
+            Stats.onNativeCall()
+            val count = _nGetOpCount(_ptr)
+            val types = IntArray(count)
+            val bounds = IntArray(count * 4)
+            val micros = FloatArray(count)
+            interopScope {
+                val typesHandle = toInterop(types)
+                val boundsHandle = toInterop(bounds)
+                val microsHandle = toInterop(micros)
+                _nGetOps(_ptr, typesHandle, boundsHandle, microsHandle)
+                typesHandle.fromInterop(types)
+                boundsHandle.fromInterop(bounds)
+                microsHandle.fromInterop(micros)
+            }
+            List(count) { i ->
+                PictureOp(
+                    PictureOpType._values[types[i]],
+                    IRect.makeLTRB(bounds[i * 4], bounds[i * 4 + 1], bounds[i * 4 + 2], bounds[i * 4 + 3]),
+                    micros[i]
+                )
+            }
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    /**
+     * Count and total time per operation type, sorted by time, most expensive first.
+     * Types that don't occur in the picture are omitted.
+     */
+    val histogram: List<PictureOpStats>
+        get() = try {
+            Stats.onNativeCall()
+            val typeCount = PictureOpType._values.size
+            val counts = IntArray(typeCount)
+            val micros = FloatArray(typeCount)
+            interopScope {
+                val countsHandle = toInterop(counts)
+                val microsHandle = toInterop(micros)
+                _nGetHistogram(_ptr, countsHandle, microsHandle)
+                countsHandle.fromInterop(counts)
+                microsHandle.fromInterop(micros)
+            }
+            PictureOpType._values
+                .filter { counts[it.ordinal] > 0 }
+                .map { PictureOpStats(it, counts[it.ordinal], micros[it.ordinal]) }
+                .sortedByDescending { it.micros }
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    /** Total time of all operations, in microseconds. */
+    val totalMicros: Float
+        get() = histogram.fold(0f) { acc, stats -> acc + stats.micros }
+
+    /**
+     * Overdraw heatmap: [ColorType.ALPHA_8] bitmap of the profiled size where every pixel
+     * holds the number of draws that touched it, saturated at 255.
+     */
+    val overdraw: Bitmap
+        get() = try {
+            Stats.onNativeCall()
+            Bitmap(_nGetOverdraw(_ptr))
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    /** Highest number of draws touching a single pixel. */
+    val maxOverdraw: Int
+        get() = try {
+            Stats.onNativeCall()
+            _nGetMaxOverdraw(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    /** Average number of draws per pixel. */
+    val averageOverdraw: Float
+        get() = try {
+            Stats.onNativeCall()
+            _nGetAverageOverdraw(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    /**
+     * Exports the profile as JSON: size, per-type histogram, overdraw summary with the number
+     * of pixels drawn 0..[maxOverdraw] times, and, if [includeOps] is true, every operation
+     * with its bounds and time.
+     */
+    fun toJson(includeOps: Boolean = true): String {
+        return try {
+            Stats.onNativeCall()
+            withStringResult {
+                _nToJson(_ptr, includeOps)
+            }
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+}
+
+private fun makeProfile(picture: Picture, width: Int, height: Int): NativePointer {
+    require(width > 0 && height > 0) { "Can't profile picture into ${width}x$height canvas" }
+    return try {
+        Stats.onNativeCall()
+        PictureProfile_nMake(getPtr(picture), width, height)
+    } finally {
+        reachabilityBarrier(picture)
+    }
+}
+
+@ExternalSymbolName("org_jetbrains_skia_PictureProfile__1nGetFinalizer")
+private external fun PictureProfile_nGetFinalizer(): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_PictureProfile__1nMake")
+private external fun PictureProfile_nMake(picturePtr: NativePointer, width: Int, height: Int): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_PictureProfile__1nGetOpCount")
+private external fun _nGetOpCount(ptr: NativePointer): Int
+
+@ExternalSymbolName("org_jetbrains_skia_PictureProfile__1nGetOps")
+private external fun _nGetOps(ptr: NativePointer, types: InteropPointer, bounds: InteropPointer, micros: InteropPointer)
+
+@ExternalSymbolName("org_jetbrains_skia_PictureProfile__1nGetHistogram")
+private external fun _nGetHistogram(ptr: NativePointer, counts: InteropPointer, micros: InteropPointer)
+
+@ExternalSymbolName("org_jetbrains_skia_PictureProfile__1nGetOverdraw")
+private external fun _nGetOverdraw(ptr: NativePointer): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_PictureProfile__1nGetMaxOverdraw")
+private external fun _nGetMaxOverdraw(ptr: NativePointer): Int
+
+@ExternalSymbolName("org_jetbrains_skia_PictureProfile__1nGetAverageOverdraw")
+private external fun _nGetAverageOverdraw(ptr: NativePointer): Float
+
+@ExternalSymbolName("org_jetbrains_skia_PictureProfile__1nToJson")
+private external fun _nToJson(ptr: NativePointer, includeOps: Boolean): NativePointer
@@ -0,0 +1,84 @@
+package org.jetbrains.skia
+
+import org.jetbrains.skia.impl.*
+import org.jetbrains.skia.impl.Library.Companion.staticLoad
+
+/**
+ * Shared storage for typefaces and images referenced by serialized pictures.
+ *
+ * Pictures serialized with [Picture.serializeToData] against a store don't embed their
+ * typefaces and images: every resource is put into the store once, keyed by a hash of its
+ * content, and the picture only keeps a short reference. Pictures must be read back with
+ * [Picture.makeFromData] against a store containing the same resources, either the same
+ * instance or one restored with [makeFromData]. Decoded typefaces and images are shared
+ * between all pictures read from the store.
+ *
+ * The store can be shared between threads.
+ */
+class PictureResourceStore internal constructor(ptr: NativePointer) : RefCnt(ptr) {
+    companion object {
+        init {
+            staticLoad()
+        }
+
+        /**
+         * Restores store written by [serializeToData].
+         *
+         * @return  store, or null if data is malformed
+         */
+        fun makeFromData(data: Data): PictureResourceStore? {
+            return try {
+                Stats.onNativeCall()
+                val ptr = PictureResourceStore_nMakeFromData(getPtr(data))
+                if (ptr == NullPointer) null else PictureResourceStore(ptr)
+            } finally {
+                reachabilityBarrier(data)
+            }
+        }
+    }
+
+    constructor() : this(PictureResourceStore_nMake()) {
+        Stats.onNativeCall()
+    }
+
+    /**
+     * Serializes all stored resources, to be shipped together with pictures referencing them.
+     */
+    fun serializeToData(): Data {
+        return try {
+            Stats.onNativeCall()
+            Data(_nSerializeToData(_ptr))
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    val stats: PictureResourceStoreStats
+        get() = try {
+            Stats.onNativeCall()
+            val result = withResult(IntArray(5)) {
+                _nGetStats(_ptr, it)
+            }
+            PictureResourceStoreStats(
+                typefaces = result[0],
+                images = result[1],
+                references = result[2],
+                storedBytes = result[3],
+                referencedBytes = result[4]
+            )
+        } finally {
+            reachabilityBarrier(this)
+        }
+}
+
+@ExternalSymbolName("org_jetbrains_skia_PictureResourceStore__1nMake")
+private external fun PictureResourceStore_nMake(): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_PictureResourceStore__1nMakeFromData")
+private external fun PictureResourceStore_nMakeFromData(dataPtr: NativePointer): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_PictureResourceStore__1nSerializeToData")
+private external fun _nSerializeToData(ptr: NativePointer): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_PictureResourceStore__1nGetStats")
+private external fun _nGetStats(ptr: NativePointer, result: InteropPointer)
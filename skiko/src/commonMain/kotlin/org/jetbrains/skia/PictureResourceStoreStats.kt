@@ -0,0 +1,23 @@
+package org.jetbrains.skia
+
+/**
+ * Snapshot of [PictureResourceStore] counters.
+ *
+ * @property typefaces        unique typefaces in the store
+ * @property images           unique images in the store
+ * @property references       resource references written into serialized pictures
+ * @property storedBytes      size of unique resources kept in the store
+ * @property referencedBytes  size of all referenced resources, as pictures would embed them
+ *                            without the store
+ */
+data class PictureResourceStoreStats(
+    val typefaces: Int,
+    val images: Int,
+    val references: Int,
+    val storedBytes: Int,
+    val referencedBytes: Int
+) {
+    /** Bytes not embedded into pictures thanks to deduplication, store size excluded. */
+    val savedBytes: Int
+        get() = referencedBytes - storedBytes
+}
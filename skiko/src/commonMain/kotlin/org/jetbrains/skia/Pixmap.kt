@@ -236,6 +236,25 @@ class Pixmap internal constructor(ptr: NativePointer, managed: Boolean) :
         }
     }
 
+    /**
+     * Converts pixels into dstPixmap ColorType, AlphaType and ColorSpace.
+     * Result is the same as [readPixels], but RGBA/BGRA swizzles and premul/unpremul
+     * between 8888 formats use SIMD kernels, and large images are converted
+     * by several threads in parallel.
+     *
+     * @param dstPixmap  destination of the same width and height
+     * @return           true if pixels were converted
+     */
+    fun convertPixels(dstPixmap: Pixmap): Boolean {
+        Stats.onNativeCall()
+        return try {
+            _nConvertPixels(_ptr, getPtr(dstPixmap))
+        } finally {
+            reachabilityBarrier(this)
+            reachabilityBarrier(dstPixmap)
+        }
+    }
+
     fun scalePixels(dstPixmap: Pixmap?, samplingMode: SamplingMode): Boolean {
         Stats.onNativeCall()
         return try {
@@ -418,6 +437,9 @@ private external fun _nReadPixelsToPixmap(ptr: NativePointer, dstPixmapPtr: Nati
 @ExternalSymbolName("org_jetbrains_skia_Pixmap__1nReadPixelsToPixmapFromPoint")
 private external fun _nReadPixelsToPixmapFromPoint(ptr: NativePointer, dstPixmapPtr: NativePointer, srcX: Int, srcY: Int): Boolean
 
+@ExternalSymbolName("org_jetbrains_skia_Pixmap__1nConvertPixels")
+private external fun _nConvertPixels(ptr: NativePointer, dstPixmapPtr: NativePointer): Boolean
+
 @ExternalSymbolName("org_jetbrains_skia_Pixmap__1nScalePixels")
 private external fun _nScalePixels(ptr: NativePointer, dstPixmapPtr: NativePointer, samplingOptionsVal1: Int, samplingOptionsVal2: Int): Boolean
 
@@ -0,0 +1,221 @@
+package org.jetbrains.skia
+
+import org.jetbrains.skia.impl.*
+import org.jetbrains.skia.impl.Library.Companion.staticLoad
+
+/**
+ * Retained display list for a static part of the UI.
+ *
+ * Content is recorded once into a [Picture] and replayed natively while the layer is clean,
+ * so drawing commands of the subtree are not issued again every frame. Call [invalidate]
+ * when the content changes; the next [drawOrRecord] records it again.
+ *
+ * Pictures replayed more than [rasterAfterReplays] times at the same scale, or having at least
+ * [rasterAboveOpCount] ops, are rasterized into an image at the scale of the destination canvas,
+ * which is then drawn instead of the picture until the scale changes or the layer is re-recorded.
+ *
+ * Not thread safe.
+ *
+ * @param bounds  bounds of the content, drawing outside of them may be clipped
+ */
+class RetainedLayer internal constructor(ptr: NativePointer) : Managed(ptr, _FinalizerHolder.PTR) {
+    companion object {
+        init {
+            staticLoad()
+        }
+    }
+
+    constructor(bounds: Rect) : this(RetainedLayer_nMake(bounds.left, bounds.top, bounds.right, bounds.bottom)) {
+        Stats.onNativeCall()
+    }
+
+    private object _FinalizerHolder {
+        val PTR = RetainedLayer_nGetFinalizer()
+    }
+
+    /**
+     * Starts recording new content. Returned canvas is valid until [finishRecording].
+     */
+    fun beginRecording(): Canvas {
+        return try {
+            Stats.onNativeCall()
+            Canvas(_nBeginRecording(_ptr), false, this)
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    /**
+     * Replaces content with what was recorded since [beginRecording] and marks the layer clean.
+     *
+     * @return  false if recording was not started
+     */
+    fun finishRecording(): Boolean {
+        return try {
+            Stats.onNativeCall()
+            _nFinishRecording(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    /**
+     * Marks content as outdated. The layer refuses to draw until it's recorded again.
+     */
+    fun invalidate() {
+        try {
+            Stats.onNativeCall()
+            _nInvalidate(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    val isDirty: Boolean
+        get() = try {
+            Stats.onNativeCall()
+            _nIsDirty(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    /**
+     * Draws recorded content into canvas.
+     *
+     * @param canvas  destination
+     * @param paint   optional paint applied to the whole content, like in [Canvas.drawPicture]
+     * @return        false if the layer is dirty and nothing was drawn
+     */
+    fun draw(canvas: Canvas, paint: Paint? = null): Boolean {
+        return try {
+            Stats.onNativeCall()
+            _nDraw(_ptr, getPtr(canvas), getPtr(paint))
+        } finally {
+            reachabilityBarrier(this)
+            reachabilityBarrier(canvas)
+            reachabilityBarrier(paint)
+        }
+    }
+
+    /**
+     * Draws recorded content into canvas, recording it with block first if the layer is dirty.
+     * If block throws, recording is closed and the layer stays dirty.
+     */
+    fun drawOrRecord(canvas: Canvas, paint: Paint? = null, block: (Canvas) -> Unit) {
+        if (draw(canvas, paint))
+            return
+        var recorded = false
+        try {
+            block(beginRecording())
+            recorded = true
+        } finally {
+            // Partial content is discarded and recorded again on the next call
+            finishRecording()
+            if (!recorded)
+                invalidate()
+        }
+        draw(canvas, paint)
+    }
+
+    /**
+     * Rasterize the picture after it's replayed this many times at the same scale, 0 disables.
+     */
+    var rasterAfterReplays: Int
+        get() = try {
+            Stats.onNativeCall()
+            _nGetRasterAfterReplays(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+        set(value) = try {
+            Stats.onNativeCall()
+            _nSetRasterAfterReplays(_ptr, value)
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    /**
+     * Rasterize pictures with at least this many ops on the first draw, 0 disables.
+     */
+    var rasterAboveOpCount: Int
+        get() = try {
+            Stats.onNativeCall()
+            _nGetRasterAboveOpCount(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+        set(value) = try {
+            Stats.onNativeCall()
+            _nSetRasterAboveOpCount(_ptr, value)
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    val stats: RetainedLayerStats
+        get() = try {
+            Stats.onNativeCall()
+            val result = withResult(IntArray(8)) {
+                _nGetStats(_ptr, it)
+            }
+            RetainedLayerStats(
+                draws = result[0],
+                misses = result[1],
+                recordings = result[2],
+                recordMicros = result[3],
+                rasterizations = result[4],
+                rasterDraws = result[5],
+                pictureBytes = result[6],
+                imageBytes = result[7]
+            )
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    fun resetStats() {
+        try {
+            Stats.onNativeCall()
+            _nResetStats(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+}
+
+@ExternalSymbolName("org_jetbrains_skia_RetainedLayer__1nGetFinalizer")
+private external fun RetainedLayer_nGetFinalizer(): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_RetainedLayer__1nMake")
+private external fun RetainedLayer_nMake(left: Float, top: Float, right: Float, bottom: Float): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_RetainedLayer__1nBeginRecording")
+private external fun _nBeginRecording(ptr: NativePointer): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_RetainedLayer__1nFinishRecording")
+private external fun _nFinishRecording(ptr: NativePointer): Boolean
+
+@ExternalSymbolName("org_jetbrains_skia_RetainedLayer__1nInvalidate")
+private external fun _nInvalidate(ptr: NativePointer)
+
+@ExternalSymbolName("org_jetbrains_skia_RetainedLayer__1nIsDirty")
+private external fun _nIsDirty(ptr: NativePointer): Boolean
+
+@ExternalSymbolName("org_jetbrains_skia_RetainedLayer__1nDraw")
+private external fun _nDraw(ptr: NativePointer, canvasPtr: NativePointer, paintPtr: NativePointer): Boolean
+
+@ExternalSymbolName("org_jetbrains_skia_RetainedLayer__1nGetRasterAfterReplays")
+private external fun _nGetRasterAfterReplays(ptr: NativePointer): Int
+
+@ExternalSymbolName("org_jetbrains_skia_RetainedLayer__1nSetRasterAfterReplays")
+private external fun _nSetRasterAfterReplays(ptr: NativePointer, replays: Int)
+
+@ExternalSymbolName("org_jetbrains_skia_RetainedLayer__1nGetRasterAboveOpCount")
+private external fun _nGetRasterAboveOpCount(ptr: NativePointer): Int
+
+@ExternalSymbolName("org_jetbrains_skia_RetainedLayer__1nSetRasterAboveOpCount")
+private external fun _nSetRasterAboveOpCount(ptr: NativePointer, opCount: Int)
+
+@ExternalSymbolName("org_jetbrains_skia_RetainedLayer__1nGetStats")
+private external fun _nGetStats(ptr: NativePointer, result: InteropPointer)
+
+@ExternalSymbolName("org_jetbrains_skia_RetainedLayer__1nResetStats")
+private external fun _nResetStats(ptr: NativePointer)
@@ -0,0 +1,31 @@
+package org.jetbrains.skia
+
+/**
+ * Snapshot of [RetainedLayer] counters.
+ *
+ * @property draws           draw calls served from recorded content
+ * @property misses          draw calls that found the layer dirty
+ * @property recordings      number of finished recordings
+ * @property recordMicros    total time spent recording, in microseconds
+ * @property rasterizations  number of times the picture was rasterized
+ * @property rasterDraws     draw calls served by the rasterized image
+ * @property pictureBytes    approximate size of the recorded picture
+ * @property imageBytes      size of the rasterized image, 0 if there's none
+ */
+data class RetainedLayerStats(
+    val draws: Int,
+    val misses: Int,
+    val recordings: Int,
+    val recordMicros: Int,
+    val rasterizations: Int,
+    val rasterDraws: Int,
+    val pictureBytes: Int,
+    val imageBytes: Int
+) {
+    /** Fraction of draw calls that didn't require recording, 0 if there were no draw calls. */
+    val hitRatio: Float
+        get() = if (draws + misses == 0) 0f else draws.toFloat() / (draws + misses)
+
+    val bytesUsed: Int
+        get() = pictureBytes + imageBytes
+}
@@ -653,6 +653,28 @@ class Surface : RefCnt {
             reachabilityBarrier(this)
         }
 
+    /**
+     * Draws a frame into this Surface with [draw] while capturing it.
+     *
+     * @return  serialized capture, see [FrameCapture.serialize]
+     */
+    fun captureFrame(draw: (Canvas) -> Unit): Data {
+        val capture = FrameCapture()
+        val picture = try {
+            draw(capture.beginCapture(canvas, Rect.makeWH(width.toFloat(), height.toFloat())))
+            capture.finishCapture()!!
+        } finally {
+            if (capture.isCapturing)
+                capture.finishCapture()?.close()
+            capture.close()
+        }
+        return try {
+            FrameCapture.serialize(picture)
+        } finally {
+            picture.close()
+        }
+    }
+
     /**
      *
      * Returns a compatible Surface, or null.
@@ -97,6 +97,42 @@ class TextBlob internal constructor(ptr: NativePointer) : Managed(ptr, _Finalize
             }
         }
 
+        /**
+         * Counters of the process-wide cache behind [blockBounds], [tightBounds], [firstBaseline],
+         * [lastBaseline] and [clusters]. They are computed in one pass on first access and
+         * served from the cache until the blob is closed or evicted.
+         */
+        val metricsCacheStats: TextBlobMetricsCacheStats
+            get() {
+                Stats.onNativeCall()
+                val result = withResult(IntArray(6)) {
+                    _nGetMetricsCacheStats(it)
+                }
+                return TextBlobMetricsCacheStats(
+                    hits = result[0],
+                    misses = result[1],
+                    evictions = result[2],
+                    count = result[3],
+                    bytesUsed = result[4],
+                    byteBudget = result[5]
+                )
+            }
+
+        /**
+         * Sets maximum number of bytes occupied by cached metrics, evicting least recently used
+         * entries if needed.
+         */
+        fun setMetricsCacheByteBudget(byteBudget: Int) {
+            require(byteBudget >= 0) { "Expected non-negative byteBudget, got: $byteBudget" }
+            Stats.onNativeCall()
+            _nSetMetricsCacheByteBudget(byteBudget)
+        }
+
+        fun purgeMetricsCache() {
+            Stats.onNativeCall()
+            _nPurgeMetricsCache()
+        }
+
         init {
             staticLoad()
         }
@@ -380,3 +416,12 @@ private external fun _nGetFirstBaseline(ptr: NativePointer, resultArray: Interop
 
 @ExternalSymbolName("org_jetbrains_skia_TextBlob__1nGetLastBaseline")
 private external fun _nGetLastBaseline(ptr: NativePointer, resultArray: InteropPointer): Boolean
+
+@ExternalSymbolName("org_jetbrains_skia_TextBlob__1nGetMetricsCacheStats")
+private external fun _nGetMetricsCacheStats(result: InteropPointer)
+
+@ExternalSymbolName("org_jetbrains_skia_TextBlob__1nSetMetricsCacheByteBudget")
+private external fun _nSetMetricsCacheByteBudget(byteBudget: Int)
+
+@ExternalSymbolName("org_jetbrains_skia_TextBlob__1nPurgeMetricsCache")
+private external fun _nPurgeMetricsCache()
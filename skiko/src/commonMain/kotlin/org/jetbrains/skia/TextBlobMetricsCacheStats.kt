@@ -0,0 +1,20 @@
+package org.jetbrains.skia
+
+/**
+ * Snapshot of the [TextBlob] metrics cache counters.
+ *
+ * @property hits        number of metric queries served from the cache
+ * @property misses      number of metric queries that required iterating blob runs
+ * @property evictions   number of entries dropped to stay within the budget
+ * @property count       number of blobs currently cached
+ * @property bytesUsed   bytes occupied by cached metrics
+ * @property byteBudget  maximum number of bytes the cache may occupy
+ */
+data class TextBlobMetricsCacheStats(
+    val hits: Int,
+    val misses: Int,
+    val evictions: Int,
+    val count: Int,
+    val bytesUsed: Int,
+    val byteBudget: Int
+)
@@ -51,6 +51,53 @@ class Typeface internal constructor(ptr: NativePointer) : RefCnt(ptr) {
             }
         }
 
+        /**
+         * Counters of the process-wide cache of instances made by [makeClone].
+         */
+        val variationCacheStats: VariationCacheStats
+            get() {
+                Stats.onNativeCall()
+                val result = withResult(IntArray(5)) {
+                    _nGetVariationCacheStats(it)
+                }
+                return VariationCacheStats(
+                    hits = result[0],
+                    misses = result[1],
+                    evictions = result[2],
+                    count = result[3],
+                    capacity = result[4]
+                )
+            }
+
+        /**
+         * Sets maximum number of variable font instances kept by [makeClone], evicting least
+         * recently used instances if needed. 0 disables the cache.
+         */
+        fun setVariationCacheCapacity(capacity: Int) {
+            require(capacity >= 0) { "Expected non-negative capacity, got: $capacity" }
+            Stats.onNativeCall()
+            _nSetVariationCacheCapacity(capacity)
+        }
+
+        /**
+         * Rounds values of axis passed to [makeClone] to multiples of step, so that animating
+         * the axis reuses instances and their glyph caches between frames. 0, the default for
+         * every axis, keeps values exact. A step larger than the axis range of a typeface is
+         * ignored for that typeface, so e.g. `ital` is never rounded away.
+         *
+         * @param axis  four letter axis tag, e.g. "wght"
+         */
+        fun setVariationQuantization(axis: String, step: Float) {
+            require(step >= 0f) { "Expected non-negative step, got: $step" }
+            Stats.onNativeCall()
+            _nSetVariationQuantization(FourByteTag.fromString(axis), step)
+        }
+
+        fun purgeVariationCache() {
+            Stats.onNativeCall()
+            _nPurgeVariationCache()
+        }
+
         init {
             staticLoad()
         }
@@ -178,13 +225,9 @@ class Typeface internal constructor(ptr: NativePointer) : RefCnt(ptr) {
      * Return a new typeface based on this typeface but parameterized as specified in the
      * variations. If the variations does not supply an argument for a parameter
      * in the font then the value from this typeface will be used as the value for that argument.
-     * @return  same typeface if all variation already match, new typeface otherwise
-     * @throws IllegalArgumentException  on failure
-     */
-    /**
-     * Return a new typeface based on this typeface but parameterized as specified in the
-     * variations. If the variations does not supply an argument for a parameter
-     * in the font then the value from this typeface will be used as the value for that argument.
+     *
+     * Instances are cached by this typeface, collection index and axis values, see
+     * [setVariationQuantization] and [setVariationCacheCapacity].
      * @return  same typeface if all variation already match, new typeface otherwise
      * @throws IllegalArgumentException  on failure
      */
@@ -246,6 +289,48 @@ class Typeface internal constructor(ptr: NativePointer) : RefCnt(ptr) {
         }
     }
 
+    /**
+     * Whether typeface has a glyph for unichar. Coverage is read from the cmap table once
+     * and shared between calls, so this is cheaper than [getUTF32Glyph] for repeated checks,
+     * e.g. when filtering fonts in a picker.
+     */
+    fun covers(unichar: Int): Boolean {
+        return try {
+            Stats.onNativeCall()
+            _nCovers(_ptr, unichar)
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    /**
+     * Whether typeface has glyphs for all unichars, see [covers].
+     */
+    fun coversAll(unichars: IntArray): Boolean {
+        return try {
+            Stats.onNativeCall()
+            interopScope { _nCoversAll(_ptr, toInterop(unichars), unichars.size) }
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    /**
+     * Whether typeface has glyphs for all characters of text, see [covers].
+     */
+    fun coversAll(text: String): Boolean = coversAll(text.intCodePoints())
+
+    /**
+     * Number of characters typeface has glyphs for, or -1 if it has no Unicode cmap table
+     */
+    val coveredCount: Int
+        get() = try {
+            Stats.onNativeCall()
+            _nGetCoveredCount(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+
     /**
      * @return  the number of glyphs in the typeface
      */
@@ -423,6 +508,27 @@ private external fun Typeface_nGetUTF32Glyphs(
 @ExternalSymbolName("org_jetbrains_skia_Typeface__1nGetUTF32Glyph")
 private external fun Typeface_nGetUTF32Glyph(ptr: NativePointer, unichar: Int): Short
 
+@ExternalSymbolName("org_jetbrains_skia_Typeface__1nGetVariationCacheStats")
+private external fun _nGetVariationCacheStats(result: InteropPointer)
+
+@ExternalSymbolName("org_jetbrains_skia_Typeface__1nSetVariationCacheCapacity")
+private external fun _nSetVariationCacheCapacity(capacity: Int)
+
+@ExternalSymbolName("org_jetbrains_skia_Typeface__1nSetVariationQuantization")
+private external fun _nSetVariationQuantization(axis: Int, step: Float)
+
+@ExternalSymbolName("org_jetbrains_skia_Typeface__1nPurgeVariationCache")
+private external fun _nPurgeVariationCache()
+
+@ExternalSymbolName("org_jetbrains_skia_Typeface__1nCovers")
+private external fun _nCovers(ptr: NativePointer, unichar: Int): Boolean
+
+@ExternalSymbolName("org_jetbrains_skia_Typeface__1nCoversAll")
+private external fun _nCoversAll(ptr: NativePointer, unichars: InteropPointer, count: Int): Boolean
+
+@ExternalSymbolName("org_jetbrains_skia_Typeface__1nGetCoveredCount")
+private external fun _nGetCoveredCount(ptr: NativePointer): Int
+
 @ExternalSymbolName("org_jetbrains_skia_Typeface__1nGetBounds")
 private external fun Typeface_nGetBounds(ptr: NativePointer, bounds: InteropPointer)
 
@@ -0,0 +1,18 @@
+package org.jetbrains.skia
+
+/**
+ * Snapshot of the variable font instance cache counters, see [Typeface.variationCacheStats].
+ *
+ * @property hits       number of [Typeface.makeClone] calls answered with a cached instance
+ * @property misses     number of instances created
+ * @property evictions  number of instances dropped to stay within the capacity
+ * @property count      number of instances currently cached
+ * @property capacity   maximum number of cached instances
+ */
+data class VariationCacheStats(
+    val hits: Int,
+    val misses: Int,
+    val evictions: Int,
+    val count: Int,
+    val capacity: Int
+)
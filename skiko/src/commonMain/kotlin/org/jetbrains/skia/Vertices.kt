@@ -0,0 +1,202 @@
+package org.jetbrains.skia
+
+import org.jetbrains.skia.impl.*
+import org.jetbrains.skia.impl.Library.Companion.staticLoad
+
+/**
+ * Triangle mesh that lives in native memory and can be drawn many times with
+ * [Canvas.drawVertices] without copying vertex data on every draw.
+ *
+ * Vertex attributes are updated in place with [setPositions], [setTexCoords], [setColors] and
+ * [setIndices], which also accept ranges for animating part of a mesh. Data is kept in storage
+ * owned by the mesh, and the first draw or [bounds] call after an edit copies it into a new
+ * snapshot, so pictures that recorded the mesh earlier are not affected.
+ *
+ * Not thread safe.
+ */
+class Vertices internal constructor(
+    ptr: NativePointer,
+    val mode: VertexMode,
+    val vertexCount: Int,
+    val indexCount: Int,
+    val hasTexCoords: Boolean,
+    val hasColors: Boolean
+) : Managed(ptr, _FinalizerHolder.PTR) {
+    companion object {
+        init {
+            staticLoad()
+        }
+
+        /**
+         * Allocates a mesh with all attributes set to zero.
+         *
+         * @param mode          how vertices are assembled into triangles
+         * @param vertexCount   number of vertices
+         * @param indexCount    number of indices, 0 to draw vertices in order
+         * @param hasTexCoords  whether mesh has per-vertex texture coordinates
+         * @param hasColors     whether mesh has per-vertex colors
+         */
+        fun make(
+            mode: VertexMode,
+            vertexCount: Int,
+            indexCount: Int = 0,
+            hasTexCoords: Boolean = false,
+            hasColors: Boolean = false
+        ): Vertices {
+            require(vertexCount >= 0 && indexCount >= 0) { "Expected non-negative counts, got: $vertexCount, $indexCount" }
+            Stats.onNativeCall()
+            val ptr = Vertices_nMake(mode.ordinal, vertexCount, indexCount, hasTexCoords, hasColors)
+            require(ptr != NullPointer) { "Failed Vertices.make($mode, $vertexCount, $indexCount)" }
+            return Vertices(ptr, mode, vertexCount, indexCount, hasTexCoords, hasColors)
+        }
+
+        /**
+         * Makes a mesh from the same arrays [Canvas.drawVertices] accepts.
+         */
+        fun makeCopy(
+            mode: VertexMode,
+            positions: FloatArray,
+            colors: IntArray? = null,
+            texCoords: FloatArray? = null,
+            indices: ShortArray? = null
+        ): Vertices {
+            require(positions.size % 2 == 0) { "Expected even number of positions: ${positions.size}" }
+            val vertices = make(mode, positions.size / 2, indices?.size ?: 0, texCoords != null, colors != null)
+            vertices.setPositions(positions)
+            colors?.let { vertices.setColors(it) }
+            texCoords?.let { vertices.setTexCoords(it) }
+            indices?.let { vertices.setIndices(it) }
+            return vertices
+        }
+    }
+
+    private object _FinalizerHolder {
+        val PTR = Vertices_nGetFinalizer()
+    }
+
+    /**
+     * Copies (x, y) pairs into positions starting at vertex offset.
+     */
+    fun setPositions(positions: FloatArray, offset: Int = 0): Vertices {
+        require(positions.size % 2 == 0) { "Expected even number of positions: ${positions.size}" }
+        checkRange(offset, positions.size / 2, vertexCount)
+        return try {
+            Stats.onNativeCall()
+            interopScope {
+                _nSetPositions(_ptr, toInterop(positions), offset, positions.size / 2)
+            }
+            this
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    /**
+     * Copies (u, v) pairs into texture coordinates starting at vertex offset.
+     */
+    fun setTexCoords(texCoords: FloatArray, offset: Int = 0): Vertices {
+        require(hasTexCoords) { "Vertices were made without texCoords" }
+        require(texCoords.size % 2 == 0) { "Expected even number of texCoords: ${texCoords.size}" }
+        checkRange(offset, texCoords.size / 2, vertexCount)
+        return try {
+            Stats.onNativeCall()
+            interopScope {
+                _nSetTexCoords(_ptr, toInterop(texCoords), offset, texCoords.size / 2)
+            }
+            this
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    /**
+     * Copies colors starting at vertex offset.
+     */
+    fun setColors(colors: IntArray, offset: Int = 0): Vertices {
+        require(hasColors) { "Vertices were made without colors" }
+        checkRange(offset, colors.size, vertexCount)
+        return try {
+            Stats.onNativeCall()
+            interopScope {
+                _nSetColors(_ptr, toInterop(colors), offset, colors.size)
+            }
+            this
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    /**
+     * Copies indices starting at offset.
+     */
+    fun setIndices(indices: ShortArray, offset: Int = 0): Vertices {
+        checkRange(offset, indices.size, indexCount)
+        return try {
+            Stats.onNativeCall()
+            interopScope {
+                _nSetIndices(_ptr, toInterop(indices), offset, indices.size)
+            }
+            this
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    /**
+     * Bounds of all positions.
+     */
+    val bounds: Rect
+        get() = try {
+            Stats.onNativeCall()
+            Rect.fromInteropPointer { _nGetBounds(_ptr, it) }
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    // Writable native storage, valid until the mesh is closed. Writes are picked up after markEdited()
+    internal fun positionsStorage(): NativePointer = _nGetPositionsStorage(_ptr)
+    internal fun texCoordsStorage(): NativePointer = _nGetTexCoordsStorage(_ptr)
+    internal fun colorsStorage(): NativePointer = _nGetColorsStorage(_ptr)
+    internal fun indicesStorage(): NativePointer = _nGetIndicesStorage(_ptr)
+    internal fun markEdited() = _nMarkEdited(_ptr)
+
+    private fun checkRange(offset: Int, count: Int, size: Int) {
+        require(offset >= 0 && offset + count <= size) { "Range [$offset, ${offset + count}) is out of [0, $size)" }
+    }
+}
+
+@ExternalSymbolName("org_jetbrains_skia_Vertices__1nGetFinalizer")
+private external fun Vertices_nGetFinalizer(): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_Vertices__1nMake")
+private external fun Vertices_nMake(mode: Int, vertexCount: Int, indexCount: Int, hasTexCoords: Boolean, hasColors: Boolean): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_Vertices__1nSetPositions")
+private external fun _nSetPositions(ptr: NativePointer, positions: InteropPointer, offset: Int, count: Int)
+
+@ExternalSymbolName("org_jetbrains_skia_Vertices__1nSetTexCoords")
+private external fun _nSetTexCoords(ptr: NativePointer, texCoords: InteropPointer, offset: Int, count: Int)
+
+@ExternalSymbolName("org_jetbrains_skia_Vertices__1nSetColors")
+private external fun _nSetColors(ptr: NativePointer, colors: InteropPointer, offset: Int, count: Int)
+
+@ExternalSymbolName("org_jetbrains_skia_Vertices__1nSetIndices")
+private external fun _nSetIndices(ptr: NativePointer, indices: InteropPointer, offset: Int, count: Int)
+
+@ExternalSymbolName("org_jetbrains_skia_Vertices__1nGetPositionsStorage")
+private external fun _nGetPositionsStorage(ptr: NativePointer): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_Vertices__1nGetTexCoordsStorage")
+private external fun _nGetTexCoordsStorage(ptr: NativePointer): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_Vertices__1nGetColorsStorage")
+private external fun _nGetColorsStorage(ptr: NativePointer): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_Vertices__1nGetIndicesStorage")
+private external fun _nGetIndicesStorage(ptr: NativePointer): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_Vertices__1nMarkEdited")
+private external fun _nMarkEdited(ptr: NativePointer)
+
+@ExternalSymbolName("org_jetbrains_skia_Vertices__1nGetBounds")
+private external fun _nGetBounds(ptr: NativePointer, result: InteropPointer)
@@ -0,0 +1,224 @@
+package org.jetbrains.skia.paragraph
+
+import org.jetbrains.skia.*
+import org.jetbrains.skia.impl.*
+import org.jetbrains.skia.impl.Library.Companion.staticLoad
+
+/**
+ * Paragraph for very long plain texts, e.g. logs, that only shapes and lays out
+ * as much text as has been asked for.
+ *
+ * Text is split at hard line breaks into chunks of at least 16 KB, and each chunk is
+ * shaped and laid out the first time painting or a query reaches it. Until then
+ * [height] is estimated from the lines laid out so far. Text without hard line breaks
+ * is laid out at once, same as [Paragraph]. [replaceText] only reshapes the chunks
+ * an edit touches.
+ *
+ * ```
+ * val log = LazyParagraph(text, style, fontCollection).layout(width)
+ * scrollbar.contentHeight = log.height
+ * log.paint(canvas, 0f, -scrollY, scrollY, scrollY + viewportHeight)
+ * ```
+ *
+ * All indices are in UTF-16 code units. Not thread safe.
+ */
+class LazyParagraph internal constructor(ptr: NativePointer) : Managed(ptr, _FinalizerHolder.PTR) {
+    companion object {
+        init {
+            staticLoad()
+        }
+    }
+
+    constructor(text: String, style: ParagraphStyle, fontCollection: FontCollection) : this(
+        try {
+            Stats.onNativeCall()
+            interopScope {
+                LazyParagraph_nMake(toInterop(text), getPtr(style), getPtr(fontCollection))
+            }
+        } finally {
+            reachabilityBarrier(style)
+            reachabilityBarrier(fontCollection)
+        }
+    )
+
+    /**
+     * Sets width to lay out lines to. Lines laid out before are dropped,
+     * shaping results are kept.
+     */
+    fun layout(width: Float): LazyParagraph {
+        Stats.onNativeCall()
+        _nLayout(_ptr, width)
+        return this
+    }
+
+    /**
+     * Replaces characters in range [from, to) with text. Chunks touching the range are
+     * shaped again, other chunks keep their shaping and line breaks. Lines from the first
+     * changed chunk on are laid out again when painting or a query reaches them.
+     *
+     * @param from  start of the replaced range, in UTF-16 code units
+     * @param to    end of the replaced range, in UTF-16 code units, equal to from for insertion
+     */
+    fun replaceText(from: Int, to: Int, text: String): LazyParagraph {
+        require(from in 0..to) { "Expected 0 <= from <= to, got: $from, $to" }
+        return try {
+            Stats.onNativeCall()
+            interopScope {
+                _nReplaceText(_ptr, from, to, toInterop(text))
+            }
+            this
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    /**
+     * Extends laid out region until it reaches y, or until the end of text.
+     */
+    fun layoutUntil(y: Float): LazyParagraph {
+        Stats.onNativeCall()
+        _nLayoutUntil(_ptr, y)
+        return this
+    }
+
+    /**
+     * Extends laid out region until it contains the line, or until the end of text.
+     */
+    fun layoutUntilLine(line: Int): LazyParagraph {
+        Stats.onNativeCall()
+        _nLayoutUntilLine(_ptr, line)
+        return this
+    }
+
+    fun layoutAll(): LazyParagraph {
+        Stats.onNativeCall()
+        _nLayoutAll(_ptr)
+        return this
+    }
+
+    val isLaidOutCompletely: Boolean
+        get() = try {
+            Stats.onNativeCall()
+            _nIsLaidOutCompletely(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    val laidOutHeight: Float
+        get() = try {
+            Stats.onNativeCall()
+            _nGetLaidOutHeight(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    val laidOutLineCount: Int
+        get() = try {
+            Stats.onNativeCall()
+            _nGetLaidOutLineCount(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    /**
+     * Total height, exact if [isLaidOutCompletely] and estimated otherwise.
+     */
+    val height: Float
+        get() = try {
+            Stats.onNativeCall()
+            _nGetHeight(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    /**
+     * Paints lines visible between top and bottom, in paragraph coordinates,
+     * laying out until bottom first.
+     */
+    fun paint(canvas: Canvas, x: Float, y: Float, top: Float, bottom: Float): LazyParagraph {
+        return try {
+            Stats.onNativeCall()
+            _nPaint(_ptr, getPtr(canvas), x, y, top, bottom)
+            this
+        } finally {
+            reachabilityBarrier(this)
+            reachabilityBarrier(canvas)
+        }
+    }
+
+    /**
+     * Metrics of lines laid out so far.
+     */
+    val lineMetrics: Array<LineMetrics>
+        get() = lineMetricsArray.toTypedArray()
+
+    val lineMetricsArray: LineMetricsArray
+        get() = try {
+            Stats.onNativeCall()
+            LineMetrics.decodeArray(_nGetLineMetrics(_ptr))
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    /**
+     * Same as [Paragraph.getGlyphPositionAtCoordinate], laying out until dy first.
+     */
+    fun getGlyphPositionAtCoordinate(dx: Float, dy: Float): PositionWithAffinity {
+        return try {
+            Stats.onNativeCall()
+            val res = _nGetGlyphPositionAtCoordinate(_ptr, dx, dy)
+            if (res >= 0) PositionWithAffinity(res, Affinity.DOWNSTREAM) else PositionWithAffinity(
+                -res - 1,
+                Affinity.UPSTREAM
+            )
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    private object _FinalizerHolder {
+        val PTR = LazyParagraph_nGetFinalizer()
+    }
+}
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_LazyParagraph__1nGetFinalizer")
+private external fun LazyParagraph_nGetFinalizer(): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_LazyParagraph__1nMake")
+private external fun LazyParagraph_nMake(text: InteropPointer, paragraphStylePtr: NativePointer, fontCollectionPtr: NativePointer): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_LazyParagraph__1nLayout")
+private external fun _nLayout(ptr: NativePointer, width: Float)
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_LazyParagraph__1nReplaceText")
+private external fun _nReplaceText(ptr: NativePointer, from: Int, to: Int, text: InteropPointer)
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_LazyParagraph__1nLayoutUntil")
+private external fun _nLayoutUntil(ptr: NativePointer, y: Float)
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_LazyParagraph__1nLayoutUntilLine")
+private external fun _nLayoutUntilLine(ptr: NativePointer, line: Int)
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_LazyParagraph__1nLayoutAll")
+private external fun _nLayoutAll(ptr: NativePointer)
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_LazyParagraph__1nIsLaidOutCompletely")
+private external fun _nIsLaidOutCompletely(ptr: NativePointer): Boolean
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_LazyParagraph__1nGetLaidOutHeight")
+private external fun _nGetLaidOutHeight(ptr: NativePointer): Float
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_LazyParagraph__1nGetLaidOutLineCount")
+private external fun _nGetLaidOutLineCount(ptr: NativePointer): Int
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_LazyParagraph__1nGetHeight")
+private external fun _nGetHeight(ptr: NativePointer): Float
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_LazyParagraph__1nPaint")
+private external fun _nPaint(ptr: NativePointer, canvasPtr: NativePointer, x: Float, y: Float, top: Float, bottom: Float)
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_LazyParagraph__1nGetLineMetrics")
+private external fun _nGetLineMetrics(ptr: NativePointer): NativePointer
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_LazyParagraph__1nGetGlyphPositionAtCoordinate")
+private external fun _nGetGlyphPositionAtCoordinate(ptr: NativePointer, dx: Float, dy: Float): Int
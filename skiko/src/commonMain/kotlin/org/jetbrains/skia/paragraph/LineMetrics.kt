@@ -134,30 +134,23 @@ class LineMetrics(
         return result
     }
 
-    companion object : ArrayInteropDecoder<LineMetrics> {
-        override fun getArraySize(array: InteropPointer) = LineMetrics_nGetArraySize(array)
-        override fun disposeArray(array: InteropPointer) = LineMetrics_nDisposeArray(array)
-        override fun getArrayElement(array: InteropPointer, index: Int): LineMetrics {
-            val intArray = IntArray(6)
-            val doubleArray = DoubleArray(7)
-            interopScope {
-                LineMetrics_nGetArrayElement(array, index, toInterop(intArray), toInterop(doubleArray))
+    companion object {
+        internal fun decodeArray(array: NativePointer): LineMetricsArray {
+            return try {
+                val size = LineMetrics_nGetArraySize(array)
+                val indices = IntArray(size * LineMetricsArray.INDICES_STRIDE)
+                val metrics = DoubleArray(size * LineMetricsArray.METRICS_STRIDE)
+                interopScope {
+                    val indicesHandle = toInterop(indices)
+                    val metricsHandle = toInterop(metrics)
+                    LineMetrics_nGetArray(array, indicesHandle, metricsHandle)
+                    indicesHandle.fromInterop(indices)
+                    metricsHandle.fromInterop(metrics)
+                }
+                LineMetricsArray(indices, metrics)
+            } finally {
+                LineMetrics_nDisposeArray(array)
             }
-            return LineMetrics(
-                intArray[0],
-                intArray[1],
-                intArray[2],
-                intArray[3],
-                intArray[4] != 0,
-                doubleArray[0],
-                doubleArray[1],
-                doubleArray[2],
-                doubleArray[3],
-                doubleArray[4],
-                doubleArray[5],
-                doubleArray[6],
-                intArray[5]
-            )
         }
     }
 
@@ -167,8 +160,8 @@ class LineMetrics(
 }
 
 @ExternalSymbolName("org_jetbrains_skia_paragraph_LineMetrics__1nGetArraySize")
-private external fun LineMetrics_nGetArraySize(array: InteropPointer): Int
+private external fun LineMetrics_nGetArraySize(array: NativePointer): Int
 @ExternalSymbolName("org_jetbrains_skia_paragraph_LineMetrics__1nDisposeArray")
-private external fun LineMetrics_nDisposeArray(array: InteropPointer)
-@ExternalSymbolName("org_jetbrains_skia_paragraph_LineMetrics__1nGetArrayElement")
-private external fun LineMetrics_nGetArrayElement(array: InteropPointer, index: Int, longArgs: InteropPointer, doubleArgs: InteropPointer)
+private external fun LineMetrics_nDisposeArray(array: NativePointer)
+@ExternalSymbolName("org_jetbrains_skia_paragraph_LineMetrics__1nGetArray")
+private external fun LineMetrics_nGetArray(array: NativePointer, indices: InteropPointer, metrics: InteropPointer)
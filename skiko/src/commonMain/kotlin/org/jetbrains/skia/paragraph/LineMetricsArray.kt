@@ -0,0 +1,41 @@
+package org.jetbrains.skia.paragraph
+
+/**
+ * Line metrics packed into primitive arrays, as returned by [Paragraph.lineMetricsArray].
+ *
+ * Line i occupies `indices[6 * i until 6 * i + 6]` as startIndex, endIndex,
+ * endExcludingWhitespaces, endIncludingNewline, isHardBreak (0 or 1) and lineNumber,
+ * and `metrics[7 * i until 7 * i + 7]` as ascent, descent, unscaledAscent, height, width,
+ * left and baseline. Indices are in UTF-16 code units, same as in [LineMetrics].
+ */
+class LineMetricsArray internal constructor(val indices: IntArray, val metrics: DoubleArray) {
+    companion object {
+        const val INDICES_STRIDE = 6
+        const val METRICS_STRIDE = 7
+    }
+
+    val size: Int
+        get() = indices.size / INDICES_STRIDE
+
+    operator fun get(line: Int): LineMetrics {
+        val i = line * INDICES_STRIDE
+        val m = line * METRICS_STRIDE
+        return LineMetrics(
+            indices[i],
+            indices[i + 1],
+            indices[i + 2],
+            indices[i + 3],
+            indices[i + 4] != 0,
+            metrics[m],
+            metrics[m + 1],
+            metrics[m + 2],
+            metrics[m + 3],
+            metrics[m + 4],
+            metrics[m + 5],
+            metrics[m + 6],
+            indices[i + 5]
+        )
+    }
+
+    fun toTypedArray(): Array<LineMetrics> = Array(size) { get(it) }
+}
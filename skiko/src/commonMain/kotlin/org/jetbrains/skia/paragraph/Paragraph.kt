@@ -9,6 +9,30 @@ class Paragraph internal constructor(ptr: NativePointer, text: ManagedString?) :
         init {
             staticLoad()
         }
+
+        /**
+         * Lays out independent paragraphs concurrently on the shared native worker pool,
+         * same as calling `paragraphs[i].layout(widths[i])` for each of them.
+         *
+         * Paragraphs may share a [FontCollection], but must be distinct and must not be
+         * used from other threads until this returns.
+         */
+        fun layoutAll(paragraphs: Array<Paragraph>, widths: FloatArray) {
+            require(paragraphs.size == widths.size) {
+                "Expected widths.size == ${paragraphs.size}, got: ${widths.size}"
+            }
+            require(paragraphs.toSet().size == paragraphs.size) { "Paragraphs must be distinct" }
+            val ptrs = NativePointerArray(paragraphs.size)
+            for (i in paragraphs.indices) ptrs[i] = getPtr(paragraphs[i])
+            try {
+                Stats.onNativeCall()
+                interopScope {
+                    _nLayoutAll(toInterop(ptrs), toInterop(widths), paragraphs.size)
+                }
+            } finally {
+                reachabilityBarrier(paragraphs)
+            }
+        }
     }
 
     private var _text: ManagedString?
@@ -104,23 +128,33 @@ class Paragraph internal constructor(ptr: NativePointer, text: ManagedString?) :
         end: Int,
         rectHeightMode: RectHeightMode,
         rectWidthMode: RectWidthMode
-    ): Array<TextBox> {
+    ): Array<TextBox> = getRectsForRangeArray(start, end, rectHeightMode, rectWidthMode).toTypedArray()
+
+    /**
+     * Same as [getRectsForRange], but returns boxes packed into primitive arrays
+     * without allocating an object per box, e.g. for selection highlighting in long documents.
+     */
+    fun getRectsForRangeArray(
+        start: Int,
+        end: Int,
+        rectHeightMode: RectHeightMode,
+        rectWidthMode: RectWidthMode
+    ): TextBoxArray {
         return try {
             Stats.onNativeCall()
-            interopScope {
-                _nGetRectsForRange(_ptr, start, end, rectHeightMode.ordinal, rectWidthMode.ordinal).fromInterop(TextBox)
-            }
+            TextBox.decodeArray(_nGetRectsForRange(_ptr, start, end, rectHeightMode.ordinal, rectWidthMode.ordinal))
         } finally {
             reachabilityBarrier(this)
         }
     }
 
     val rectsForPlaceholders: Array<TextBox>
+        get() = rectsForPlaceholdersArray.toTypedArray()
+
+    val rectsForPlaceholdersArray: TextBoxArray
         get() = try {
             Stats.onNativeCall()
-            interopScope {
-                _nGetRectsForPlaceholders(_ptr).fromInterop(TextBox)
-            }
+            TextBox.decodeArray(_nGetRectsForPlaceholders(_ptr))
         } finally {
             reachabilityBarrier(this)
         }
@@ -152,18 +186,21 @@ class Paragraph internal constructor(ptr: NativePointer, text: ManagedString?) :
     private fun toIRange(p: Long) = IRange((p ushr 32).toInt(), (p and -1).toInt())
 
     val lineMetrics: Array<LineMetrics>
+        get() = lineMetricsArray.toTypedArray()
+
+    /**
+     * Same as [lineMetrics], but packed into primitive arrays without allocating an object per line.
+     */
+    val lineMetricsArray: LineMetricsArray
         get() = try {
             if (_text == null) {
-                arrayOf<LineMetrics>()
+                LineMetricsArray(IntArray(0), DoubleArray(0))
             } else {
                 Stats.onNativeCall()
-                interopScope {
-                    _nGetLineMetrics(_ptr, getPtr(_text)).fromInterop(LineMetrics)
-                }
+                LineMetrics.decodeArray(_nGetLineMetrics(_ptr))
             }
         } finally {
             reachabilityBarrier(this)
-            reachabilityBarrier(_text)
         }
     val lineNumber: Int
         get() = try {
@@ -193,12 +230,33 @@ class Paragraph internal constructor(ptr: NativePointer, text: ManagedString?) :
         return this
     }
 
-    // public Paragraph updateText(int from, String text) {
-    //     Stats.onNativeCall();
-    //     _nUpdateText(_ptr, from, text);
-    //     // TODO: update _text
-    //     return this;
-    // }
+    /**
+     * Builds a new paragraph with characters in range [from, to) replaced by text, keeping
+     * the paragraph style, text styles and placeholders. Inserted text gets the style of the
+     * character before it, placeholders inside the replaced range are dropped.
+     *
+     * This is a full rebuild: the new paragraph is shaped from scratch, only replaying the
+     * builder from Kotlin is saved. This paragraph is left unchanged. The result must be laid
+     * out before use. For plain text that is edited often, [LazyParagraph.replaceText] only
+     * reshapes the lines around the edit.
+     *
+     * @param from  start of the replaced range, in UTF-16 code units
+     * @param to    end of the replaced range, in UTF-16 code units, equal to from for insertion
+     */
+    fun rebuildWithText(from: Int, to: Int, text: String): Paragraph {
+        require(from in 0..to) { "Expected 0 <= from <= to, got: $from, $to" }
+        val newText = ManagedString("")
+        return try {
+            Stats.onNativeCall()
+            val ptr = interopScope {
+                _nRebuildWithText(_ptr, from, to, toInterop(text), getPtr(newText))
+            }
+            Paragraph(ptr, newText)
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
     fun updateFontSize(from: Int, to: Int, size: Float): Paragraph {
         return try {
             if (_text != null) {
@@ -296,6 +354,9 @@ private external fun _nDidExceedMaxLines(ptr: NativePointer): Boolean
 @ExternalSymbolName("org_jetbrains_skia_paragraph_Paragraph__1nLayout")
 private external fun _nLayout(ptr: NativePointer, width: Float)
 
+@ExternalSymbolName("org_jetbrains_skia_paragraph_Paragraph__1nLayoutAll")
+private external fun _nLayoutAll(ptrs: InteropPointer, widths: InteropPointer, count: Int)
+
 @ExternalSymbolName("org_jetbrains_skia_paragraph_Paragraph__1nPaint")
 private external fun _nPaint(ptr: NativePointer, canvasPtr: NativePointer, x: Float, y: Float): NativePointer
 
@@ -306,11 +367,11 @@ private external fun _nGetRectsForRange(
     end: Int,
     rectHeightMode: Int,
     rectWidthMode: Int
-): InteropPointer
+): NativePointer
 
 
 @ExternalSymbolName("org_jetbrains_skia_paragraph_Paragraph__1nGetRectsForPlaceholders")
-private external fun _nGetRectsForPlaceholders(ptr: NativePointer): InteropPointer
+private external fun _nGetRectsForPlaceholders(ptr: NativePointer): NativePointer
 
 @ExternalSymbolName("org_jetbrains_skia_paragraph_Paragraph__1nGetGlyphPositionAtCoordinate")
 private external fun _nGetGlyphPositionAtCoordinate(ptr: NativePointer, dx: Float, dy: Float): Int
@@ -319,7 +380,7 @@ private external fun _nGetGlyphPositionAtCoordinate(ptr: NativePointer, dx: Floa
 private external fun _nGetWordBoundary(ptr: NativePointer, offset: Int, result: InteropPointer)
 
 @ExternalSymbolName("org_jetbrains_skia_paragraph_Paragraph__1nGetLineMetrics")
-private external fun _nGetLineMetrics(ptr: NativePointer, textPtr: NativePointer): InteropPointer
+private external fun _nGetLineMetrics(ptr: NativePointer): NativePointer
 
 @ExternalSymbolName("org_jetbrains_skia_paragraph_Paragraph__1nGetLineNumber")
 private external fun _nGetLineNumber(ptr: NativePointer): Int
@@ -333,6 +394,9 @@ private external fun _nGetUnresolvedGlyphsCount(ptr: NativePointer): Int
 @ExternalSymbolName("org_jetbrains_skia_paragraph_Paragraph__1nUpdateAlignment")
 private external fun _nUpdateAlignment(ptr: NativePointer, Align: Int)
 
+@ExternalSymbolName("org_jetbrains_skia_paragraph_Paragraph__1nRebuildWithText")
+private external fun _nRebuildWithText(ptr: NativePointer, from: Int, to: Int, text: InteropPointer, newTextPtr: NativePointer): NativePointer
+
 @ExternalSymbolName("org_jetbrains_skia_paragraph_Paragraph__1nUpdateFontSize")
 private external fun _nUpdateFontSize(ptr: NativePointer, from: Int, to: Int, size: Float, textPtr: NativePointer)
 
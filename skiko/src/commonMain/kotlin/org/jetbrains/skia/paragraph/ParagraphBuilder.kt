@@ -39,6 +39,47 @@ class ParagraphBuilder(style: ParagraphStyle?, fc: FontCollection?) :
         return this
     }
 
+    /**
+     * Adds text with style spans applied in one native call, instead of a
+     * [pushStyle]/[addText]/[popStyle] sequence per span.
+     *
+     * Span i covers `[spanStarts[i], spanEnds[i])` of text and is styled with `styles[i]`.
+     * Spans may nest or overlap, where they do the span with the greater index wins.
+     * Text outside of spans gets the current style.
+     */
+    fun addStyledText(text: String, spanStarts: IntArray, spanEnds: IntArray, styles: Array<TextStyle>): ParagraphBuilder {
+        val count = styles.size
+        require(spanStarts.size == count && spanEnds.size == count) {
+            "Expected $count span starts and ends, got: ${spanStarts.size}, ${spanEnds.size}"
+        }
+        for (i in 0 until count) {
+            require(spanStarts[i] in 0..spanEnds[i] && spanEnds[i] <= text.length) {
+                "Span [${spanStarts[i]}, ${spanEnds[i]}) is out of [0, ${text.length})"
+            }
+        }
+        return try {
+            Stats.onNativeCall()
+            if (_text == null) _text = ManagedString("")
+            val stylePtrs = NativePointerArray(count)
+            for (i in 0 until count) stylePtrs[i] = getPtr(styles[i])
+            interopScope {
+                _nAddStyledText(
+                    _ptr,
+                    toInterop(text),
+                    toInterop(spanStarts),
+                    toInterop(spanEnds),
+                    toInterop(stylePtrs),
+                    count,
+                    getPtr(_text)
+                )
+            }
+            this
+        } finally {
+            reachabilityBarrier(styles)
+            reachabilityBarrier(_text)
+        }
+    }
+
     fun addPlaceholder(style: PlaceholderStyle): ParagraphBuilder {
         Stats.onNativeCall()
         _nAddPlaceholder(
@@ -99,6 +140,17 @@ private external fun _nPopStyle(ptr: NativePointer)
 @ExternalSymbolName("org_jetbrains_skia_paragraph_ParagraphBuilder__1nAddText")
 private external fun _nAddText(ptr: NativePointer, text: InteropPointer)
 
+@ExternalSymbolName("org_jetbrains_skia_paragraph_ParagraphBuilder__1nAddStyledText")
+private external fun _nAddStyledText(
+    ptr: NativePointer,
+    text: InteropPointer,
+    spanStarts: InteropPointer,
+    spanEnds: InteropPointer,
+    stylePtrs: InteropPointer,
+    count: Int,
+    managedTextPtr: NativePointer
+)
+
 @ExternalSymbolName("org_jetbrains_skia_paragraph_ParagraphBuilder__1nAddPlaceholder")
 private external fun _nAddPlaceholder(
     ptr: NativePointer,
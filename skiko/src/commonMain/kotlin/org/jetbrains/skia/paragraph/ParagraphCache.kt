@@ -6,8 +6,17 @@ import org.jetbrains.skia.impl.Stats
 import org.jetbrains.skia.impl.reachabilityBarrier
 import org.jetbrains.skia.ExternalSymbolName
 import org.jetbrains.skia.impl.NativePointer
+import org.jetbrains.skia.impl.InteropPointer
 import org.jetbrains.skia.impl.getPtr
-
+import org.jetbrains.skia.impl.withResult
+
+/**
+ * Cache of shaping results, owned by [FontCollection].
+ *
+ * Every FontCollection has its own cache with its own [stats] and byte budget, so paragraphs
+ * of a large document can be given a separate FontCollection to keep them from evicting
+ * entries of the rest of UI.
+ */
 class ParagraphCache internal constructor(owner: FontCollection, ptr: NativePointer) : Native(ptr) {
     companion object {
         init {
@@ -86,6 +95,60 @@ class ParagraphCache internal constructor(owner: FontCollection, ptr: NativePoin
             reachabilityBarrier(this)
         }
 
+    /**
+     * Counters since the FontCollection was made or since [resetStats].
+     */
+    val stats: ParagraphCacheStats
+        get() = try {
+            _validate()
+            Stats.onNativeCall()
+            // 64-bit counters come as high and low halves
+            val result = withResult(IntArray(12)) {
+                _nGetStats(_ptr, it)
+            }
+            fun long(i: Int) = (result[i].toLong() shl 32) or (result[i + 1].toLong() and 0xFFFFFFFFL)
+            ParagraphCacheStats(
+                hits = long(0),
+                misses = long(2),
+                evictions = long(4),
+                count = result[6],
+                bytesUsed = long(7),
+                byteBudget = result[9],
+                timeSavedNanos = long(10)
+            )
+        } finally {
+            reachabilityBarrier(this)
+        }
+
+    fun resetStats() {
+        try {
+            _validate()
+            Stats.onNativeCall()
+            _nResetStats(_ptr)
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
+    /**
+     * Limits approximate size of cached entries, 0 removes the limit.
+     *
+     * The budget is a full flush, not an LRU limit: skparagraph can't drop cache entries one
+     * by one, so a layout that takes the cache over budget clears all of it, and so does
+     * setting a budget below [ParagraphCacheStats.bytesUsed]. Independently of the budget,
+     * the cache keeps at most 128 entries, dropping least recently used ones.
+     */
+    fun setByteBudget(bytes: Int) {
+        require(bytes >= 0) { "Expected non-negative budget, got: $bytes" }
+        try {
+            _validate()
+            Stats.onNativeCall()
+            _nSetByteBudget(_ptr, bytes)
+        } finally {
+            reachabilityBarrier(this)
+        }
+    }
+
     internal val _owner: FontCollection
     internal fun _validate() {
         try {
@@ -120,3 +183,12 @@ private external fun _nSetEnabled(ptr: NativePointer, value: Boolean)
 
 @ExternalSymbolName("org_jetbrains_skia_paragraph_ParagraphCache__1nGetCount")
 private external fun _nGetCount(ptr: NativePointer): Int
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_ParagraphCache__1nGetStats")
+private external fun _nGetStats(ptr: NativePointer, result: InteropPointer)
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_ParagraphCache__1nResetStats")
+private external fun _nResetStats(ptr: NativePointer)
+
+@ExternalSymbolName("org_jetbrains_skia_paragraph_ParagraphCache__1nSetByteBudget")
+private external fun _nSetByteBudget(ptr: NativePointer, bytes: Int)
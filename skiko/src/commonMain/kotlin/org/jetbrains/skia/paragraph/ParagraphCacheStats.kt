@@ -0,0 +1,25 @@
+package org.jetbrains.skia.paragraph
+
+/**
+ * Snapshot of [ParagraphCache] counters, see [ParagraphCache.stats].
+ *
+ * @property hits            number of layouts that reused shaping results from the cache
+ * @property misses          number of layouts that had to shape text
+ * @property evictions       number of entries dropped by the entry limit, the byte budget or [ParagraphCache.reset]
+ * @property count           number of entries currently cached
+ * @property bytesUsed       approximate bytes occupied by cached entries
+ * @property byteBudget      maximum number of bytes the cache may occupy, 0 if unlimited
+ * @property timeSavedNanos  shaping time hits saved, measured when the entries were added
+ */
+data class ParagraphCacheStats(
+    val hits: Long,
+    val misses: Long,
+    val evictions: Long,
+    val count: Int,
+    val bytesUsed: Long,
+    val byteBudget: Int,
+    val timeSavedNanos: Long
+) {
+    val averageEntryBytes: Long
+        get() = if (count == 0) 0 else bytesUsed / count
+}
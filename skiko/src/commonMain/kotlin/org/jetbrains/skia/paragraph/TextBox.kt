@@ -2,8 +2,8 @@ package org.jetbrains.skia.paragraph
 
 import org.jetbrains.skia.ExternalSymbolName
 import org.jetbrains.skia.Rect
-import org.jetbrains.skia.impl.ArrayInteropDecoder
 import org.jetbrains.skia.impl.InteropPointer
+import org.jetbrains.skia.impl.NativePointer
 import org.jetbrains.skia.impl.interopScope
 
 class TextBox(val rect: Rect, direction: Direction) {
@@ -40,27 +40,30 @@ class TextBox(val rect: Rect, direction: Direction) {
         _direction = direction
     }
 
-    companion object : ArrayInteropDecoder<TextBox> {
-        override fun getArrayElement(array: InteropPointer, index: Int): TextBox {
-            val rect = FloatArray(4)
-            val direction = IntArray(1)
-            interopScope {
-                val rectPtr = toInterop(rect)
-                val directionPtr = toInterop(direction)
-                TextBox_nGetArrayElement(array, index, rectPtr, directionPtr)
-                rectPtr.fromInterop(rect)
-                directionPtr.fromInterop(direction)
+    companion object {
+        internal fun decodeArray(array: NativePointer): TextBoxArray {
+            return try {
+                val size = TextBox_nGetArraySize(array)
+                val ltrb = FloatArray(size * 4)
+                val directions = IntArray(size)
+                interopScope {
+                    val ltrbHandle = toInterop(ltrb)
+                    val directionsHandle = toInterop(directions)
+                    TextBox_nGetArray(array, ltrbHandle, directionsHandle)
+                    ltrbHandle.fromInterop(ltrb)
+                    directionsHandle.fromInterop(directions)
+                }
+                TextBoxArray(ltrb, directions)
+            } finally {
+                TextBox_nDisposeArray(array)
             }
-            return TextBox(rect[0], rect[1], rect[2], rect[3], direction[0])
         }
-        override fun getArraySize(array: InteropPointer) = TextBox_nGetArraySize(array)
-        override fun disposeArray(array: InteropPointer) = TextBox_nDisposeArray(array)
     }
 }
 
 @ExternalSymbolName("org_jetbrains_skia_paragraph_TextBox__1nGetArraySize")
-private external fun TextBox_nGetArraySize(array: InteropPointer): Int
+private external fun TextBox_nGetArraySize(array: NativePointer): Int
 @ExternalSymbolName("org_jetbrains_skia_paragraph_TextBox__1nDisposeArray")
-private external fun TextBox_nDisposeArray(array: InteropPointer)
-@ExternalSymbolName("org_jetbrains_skia_paragraph_TextBox__1nGetArrayElement")
-private external fun TextBox_nGetArrayElement(array: InteropPointer, index: Int, rectArray: InteropPointer, directionArray: InteropPointer)
+private external fun TextBox_nDisposeArray(array: NativePointer)
+@ExternalSymbolName("org_jetbrains_skia_paragraph_TextBox__1nGetArray")
+private external fun TextBox_nGetArray(array: NativePointer, ltrb: InteropPointer, directions: InteropPointer)
@@ -0,0 +1,24 @@
+package org.jetbrains.skia.paragraph
+
+import org.jetbrains.skia.Rect
+
+/**
+ * Text boxes packed into primitive arrays, as returned by [Paragraph.getRectsForRangeArray].
+ *
+ * Box i occupies `ltrb[4 * i until 4 * i + 4]` as left, top, right, bottom and `directions[i]`
+ * as [Direction.ordinal]. Unlike an `Array<TextBox>` it takes two allocations regardless of
+ * the number of boxes, which matters for ranges spanning thousands of lines.
+ */
+class TextBoxArray internal constructor(val ltrb: FloatArray, val directions: IntArray) {
+    val size: Int
+        get() = directions.size
+
+    fun getRect(index: Int): Rect =
+        Rect.makeLTRB(ltrb[index * 4], ltrb[index * 4 + 1], ltrb[index * 4 + 2], ltrb[index * 4 + 3])
+
+    fun getDirection(index: Int): Direction = Direction.values()[directions[index]]
+
+    operator fun get(index: Int): TextBox = TextBox(getRect(index), getDirection(index))
+
+    fun toTypedArray(): Array<TextBox> = Array(size) { get(it) }
+}
@@ -85,6 +85,63 @@ class Shaper internal constructor(ptr: NativePointer) : Managed(ptr, _FinalizerH
             }
         }
 
+        /**
+         * Counters of the shaping cache, see [setCacheEnabled].
+         */
+        val cacheStats: ShapingCacheStats
+            get() {
+                Stats.onNativeCall()
+                val result = withResult(IntArray(4)) {
+                    _nGetCacheStats(it)
+                }
+                return ShapingCacheStats(
+                    hits = result[0],
+                    misses = result[1],
+                    rejected = result[2],
+                    count = result[3]
+                )
+            }
+
+        /**
+         * Enables process-wide cache of [shape] and [shapeLine] results, disabled by default.
+         * Results are reused for the same text, typeface, font parameters, options and width,
+         * and only for shapers made by this class.
+         *
+         * Cache can be saved with [saveCache] on exit and loaded with [loadCache] on the next
+         * start to skip shaping of UI strings before the first frame. Typefaces are matched
+         * by family, style, font file checksum and variation axis values, so cached results
+         * for changed or missing fonts are dropped and text is shaped again.
+         */
+        fun setCacheEnabled(value: Boolean) {
+            Stats.onNativeCall()
+            _nSetCacheEnabled(value)
+        }
+
+        /**
+         * Memory-maps cache file written by [saveCache] and adds its entries to the cache.
+         * Entries are decoded on first use.
+         *
+         * @return  false if file is missing or was written by an incompatible version of the
+         *          format, Skia or HarfBuzz
+         */
+        fun loadCache(path: String): Boolean {
+            Stats.onNativeCall()
+            return interopScope { _nLoadCache(toInterop(path)) }
+        }
+
+        /**
+         * Writes the cache to a temporary file next to path and renames it over path.
+         */
+        fun saveCache(path: String): Boolean {
+            Stats.onNativeCall()
+            return interopScope { _nSaveCache(toInterop(path)) }
+        }
+
+        fun purgeCache() {
+            Stats.onNativeCall()
+            _nPurgeCache()
+        }
+
         init {
             staticLoad()
         }
@@ -251,6 +308,21 @@ private external fun _nMakeShapeDontWrapOrReorder(fontMgrPtr: NativePointer): Na
 @ExternalSymbolName("org_jetbrains_skia_shaper_Shaper__1nMakeCoreText")
 private external fun _nMakeCoreText(): NativePointer
 
+@ExternalSymbolName("org_jetbrains_skia_shaper_Shaper__1nGetCacheStats")
+private external fun _nGetCacheStats(result: InteropPointer)
+
+@ExternalSymbolName("org_jetbrains_skia_shaper_Shaper__1nSetCacheEnabled")
+private external fun _nSetCacheEnabled(value: Boolean)
+
+@ExternalSymbolName("org_jetbrains_skia_shaper_Shaper__1nLoadCache")
+private external fun _nLoadCache(path: InteropPointer): Boolean
+
+@ExternalSymbolName("org_jetbrains_skia_shaper_Shaper__1nSaveCache")
+private external fun _nSaveCache(path: InteropPointer): Boolean
+
+@ExternalSymbolName("org_jetbrains_skia_shaper_Shaper__1nPurgeCache")
+private external fun _nPurgeCache()
+
 @ExternalSymbolName("org_jetbrains_skia_shaper_Shaper__1nShapeBlob")
 private external fun _nShapeBlob(
     ptr: NativePointer,
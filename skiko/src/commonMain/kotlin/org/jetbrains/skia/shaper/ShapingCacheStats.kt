@@ -0,0 +1,16 @@
+package org.jetbrains.skia.shaper
+
+/**
+ * Snapshot of the shaping cache counters, see [Shaper.cacheStats].
+ *
+ * @property hits      number of shapings replayed from the cache
+ * @property misses    number of shapings done live while the cache was enabled
+ * @property rejected  number of entries dropped because their typefaces changed or they were corrupted
+ * @property count     number of entries currently cached, including ones not decoded yet
+ */
+data class ShapingCacheStats(
+    val hits: Int,
+    val misses: Int,
+    val rejected: Int,
+    val count: Int
+)
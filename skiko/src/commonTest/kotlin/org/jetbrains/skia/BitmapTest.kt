@@ -130,4 +130,54 @@ class BitmapTest {
             assertEquals(value, dataBytes[ix])
         }
     }
+
+    @Test
+    fun canReadPixelsIntoArray() = runTest {
+        val bitmap = Bitmap()
+        bitmap.allocPixels(ImageInfo.makeS32(2, 2, ColorAlphaType.OPAQUE))
+        val setArray = byteArrayOf(1, 2, 3, -1, 5, 6, 7, -1, 9, 10, 11, -1, 13, 14, 15, -1)
+        assertTrue(bitmap.installPixels(setArray))
+
+        val dst = ByteArray(setArray.size)
+        assertTrue(bitmap.readPixels(dst))
+        assertContentEquals(setArray, dst)
+
+        assertFailsWith<IllegalArgumentException> {
+            bitmap.readPixels(ByteArray(setArray.size - 1))
+        }
+    }
+
+    @Test
+    fun canReadAndWritePixelsWithPixmap() = runTest {
+        val imageInfo = ImageInfo.makeN32Premul(2, 2)
+        val bitmap = Bitmap()
+        bitmap.allocPixels(imageInfo)
+        bitmap.erase(Color.RED)
+
+        val data = Data.makeUninitialized(imageInfo.computeMinByteSize())
+        val pixmap = Pixmap.make(imageInfo, data, imageInfo.minRowBytes)
+        assertTrue(bitmap.readPixels(pixmap))
+        assertEquals(Color.RED, pixmap.getColor(1, 1))
+
+        pixmap.erase(Color.BLUE)
+        assertTrue(bitmap.writePixels(pixmap, 1, 1))
+        assertEquals(Color.RED, bitmap.getColor(0, 0))
+        assertEquals(Color.BLUE, bitmap.getColor(1, 1))
+    }
+
+    @Test
+    fun canInstallPixelsFromPixmap() = runTest {
+        val imageInfo = ImageInfo.makeN32Premul(2, 2)
+        val data = Data.makeUninitialized(imageInfo.computeMinByteSize())
+        val pixmap = Pixmap.make(imageInfo, data, imageInfo.minRowBytes)
+        pixmap.erase(Color.GREEN)
+
+        val bitmap = Bitmap()
+        assertTrue(bitmap.installPixels(pixmap))
+        assertEquals(Color.GREEN, bitmap.getColor(1, 0))
+
+        // Bitmap shares memory with pixmap
+        pixmap.erase(Color.BLUE)
+        assertEquals(Color.BLUE, bitmap.getColor(1, 0))
+    }
 }
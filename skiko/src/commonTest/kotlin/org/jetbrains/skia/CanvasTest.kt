@@ -8,6 +8,8 @@ import org.jetbrains.skiko.tests.SkipNativeTarget
 import org.jetbrains.skiko.tests.runTest
 import kotlin.test.Test
 import kotlin.test.assertContentEquals
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
 import kotlin.test.assertTrue
 
 class CanvasTest {
@@ -190,4 +192,152 @@ class CanvasTest {
 
         assertContentSame(expected = expected, got = surface.makeImageSnapshot(), sensitivity = 0.25)
     }
+
+    @Test
+    fun readAndWritePixelsWithPixmap() = runTest {
+        val surface = Surface.makeRasterN32Premul(4, 4)
+        surface.canvas.clear(Color.RED)
+
+        val imageInfo = ImageInfo.makeN32Premul(2, 2)
+        val data = Data.makeUninitialized(imageInfo.computeMinByteSize())
+        val pixmap = Pixmap.make(imageInfo, data, imageInfo.minRowBytes)
+        assertTrue(surface.canvas.readPixels(pixmap, 1, 1))
+        assertEquals(Color.RED, pixmap.getColor(0, 0))
+
+        pixmap.erase(Color.BLUE)
+        assertTrue(surface.canvas.writePixels(pixmap, 2, 2))
+
+        val snapshot = Bitmap.makeFromImage(surface.makeImageSnapshot())
+        assertEquals(Color.RED, snapshot.getColor(1, 1))
+        assertEquals(Color.BLUE, snapshot.getColor(3, 3))
+    }
+
+    @Test
+    fun batchedDrawsMatchIndividualDraws() {
+        val rects = floatArrayOf(0f, 0f, 4f, 4f, 10f, 2f, 14f, 12f, 3f, 9f, 8f, 15f)
+        val rrects = floatArrayOf(1f, 1f, 7f, 7f, 2f, 2f, 9f, 9f, 15f, 14f, 1f, 3f)
+        val circles = floatArrayOf(4f, 12f, 3f, 12f, 4f, 2.5f)
+        val colors = intArrayOf(Color.RED, Color.GREEN, Color.BLUE)
+        val paint = Paint()
+
+        val batched = Surface.makeRasterN32Premul(16, 16)
+        batched.canvas
+            .drawRects(rects, paint, colors)
+            .drawRRects(rrects, paint)
+            .drawCircles(circles, paint, intArrayOf(Color.CYAN, Color.MAGENTA))
+
+        val individual = Surface.makeRasterN32Premul(16, 16)
+        for (i in 0 until 3) {
+            paint.color = colors[i]
+            individual.canvas.drawRect(Rect(rects[i * 4], rects[i * 4 + 1], rects[i * 4 + 2], rects[i * 4 + 3]), paint)
+        }
+        paint.color = Color.BLACK
+        for (i in 0 until 2) {
+            val o = i * 6
+            individual.canvas.drawRRect(RRect.makeLTRB(rrects[o], rrects[o + 1], rrects[o + 2], rrects[o + 3], rrects[o + 4], rrects[o + 5]), paint)
+        }
+        paint.color = Color.CYAN
+        individual.canvas.drawCircle(circles[0], circles[1], circles[2], paint)
+        paint.color = Color.MAGENTA
+        individual.canvas.drawCircle(circles[3], circles[4], circles[5], paint)
+
+        assertContentSame(expected = individual.makeImageSnapshot(), got = batched.makeImageSnapshot(), sensitivity = 0.0)
+        assertFailsWith<IllegalArgumentException> { batched.canvas.drawRects(floatArrayOf(0f, 0f, 1f), paint) }
+        assertFailsWith<IllegalArgumentException> { batched.canvas.drawCircles(circles, paint, intArrayOf(Color.RED)) }
+    }
+
+    @Test
+    fun tessellatedRectsMatchIndividualDraws() {
+        val count = 80
+        val rects = FloatArray(count * 4)
+        val colors = IntArray(count)
+        for (i in 0 until count) {
+            val x = (i % 10) * 6f
+            val y = (i / 10) * 6f
+            rects[i * 4] = x
+            rects[i * 4 + 1] = y
+            rects[i * 4 + 2] = x + 5f
+            rects[i * 4 + 3] = y + 5f
+            colors[i] = Color.makeRGB(i * 3, 255 - i * 3, (i * 37) % 256)
+        }
+
+        fun individual(paint: Paint): Image {
+            val surface = Surface.makeRasterN32Premul(60, 48)
+            for (i in 0 until count) {
+                paint.color = colors[i]
+                surface.canvas.drawRect(Rect(rects[i * 4], rects[i * 4 + 1], rects[i * 4 + 2], rects[i * 4 + 3]), paint)
+            }
+            return surface.makeImageSnapshot()
+        }
+
+        fun recorded(paint: Paint, expectTessellated: Boolean): Image {
+            val recorder = PictureRecorder()
+            recorder.beginRecording(Rect(0f, 0f, 60f, 48f)).drawRects(rects, paint, colors)
+            val picture = recorder.finishRecordingAsPicture()
+            assertEquals(expectTessellated, picture.approximateOpCount < count)
+            val surface = Surface.makeRasterN32Premul(60, 48)
+            picture.playback(surface.canvas)
+            return surface.makeImageSnapshot()
+        }
+
+        val paint = Paint().apply { isAntiAlias = false }
+        assertContentSame(expected = individual(paint), got = recorded(paint, expectTessellated = true), sensitivity = 0.0)
+
+        // Shaders ignore per-item colors, so they are drawn rect by rect
+        paint.shader = Shader.makeLinearGradient(Point(0f, 0f), Point(60f, 48f), intArrayOf(Color.RED, Color.BLUE))
+        assertContentSame(expected = individual(paint), got = recorded(paint, expectTessellated = false), sensitivity = 0.0)
+    }
+
+    @Test
+    fun drawAtlas() {
+        val atlas = Surface.makeRasterN32Premul(2, 1)
+        atlas.canvas.drawRect(Rect(0f, 0f, 1f, 1f), Paint().apply { color = Color.RED })
+        atlas.canvas.drawRect(Rect(1f, 0f, 2f, 1f), Paint().apply { color = Color.BLUE })
+        val image = atlas.makeImageSnapshot()
+
+        val surface = Surface.makeRasterN32Premul(4, 4)
+        surface.canvas.drawAtlas(
+            image,
+            xforms = floatArrayOf(2f, 0f, 0f, 0f, 2f, 0f, 2f, 2f),
+            texRects = floatArrayOf(0f, 0f, 1f, 1f, 1f, 0f, 2f, 1f),
+            samplingMode = FilterMipmap(FilterMode.NEAREST)
+        )
+
+        val snapshot = Bitmap.makeFromImage(surface.makeImageSnapshot())
+        assertEquals(Color.RED, snapshot.getColor(1, 1))
+        assertEquals(Color.BLUE, snapshot.getColor(3, 3))
+        assertEquals(Color.TRANSPARENT, snapshot.getColor(3, 0))
+        assertFailsWith<IllegalArgumentException> {
+            surface.canvas.drawAtlas(image, floatArrayOf(1f, 0f, 0f, 0f), floatArrayOf(0f, 0f, 1f, 1f), intArrayOf())
+        }
+    }
+
+    @Test @SkipNativeTarget @SkipJsTarget
+    fun drawGlyphRuns() = runTest {
+        val font = Font(Typeface.makeFromResource("./fonts/Inter-Hinted-Regular.ttf"), 12f)
+        val labels = listOf("0", "25", "50", "75", "100")
+        val glyphs = labels.map { font.getStringGlyphs(it) }
+        val positions = glyphs.map { font.getXPositions(it) }
+
+        val expected = Surface.makeRasterN32Premul(120, 20)
+        labels.indices.forEach { i ->
+            val blob = TextBlob.makeFromPosH(glyphs[i], positions[i], 0f, font)!!
+            expected.canvas.drawTextBlob(blob, i * 24f, 14f, Paint())
+        }
+
+        val packedPositions = FloatArray(glyphs.sumOf { it.size } * 2)
+        var offset = 0
+        val runOffsets = IntArray(labels.size)
+        glyphs.forEachIndexed { i, run ->
+            runOffsets[i] = offset
+            positions[i].forEachIndexed { j, x -> packedPositions[(offset + j) * 2] = x }
+            offset += run.size
+        }
+        val origins = FloatArray(labels.size * 2) { if (it % 2 == 0) it / 2 * 24f else 14f }
+
+        val got = Surface.makeRasterN32Premul(120, 20)
+        got.canvas.drawGlyphRuns(font, glyphs.reduce { a, b -> a + b }, packedPositions, runOffsets, origins, Paint())
+
+        assertContentSame(expected.makeImageSnapshot(), got.makeImageSnapshot(), 0.0)
+    }
 }
@@ -9,6 +9,7 @@ import org.jetbrains.skiko.tests.makeFromFileName
 import org.jetbrains.skiko.tests.runTest
 import kotlin.test.Test
 import kotlin.test.assertEquals
+import kotlin.test.assertNotEquals
 import kotlin.test.assertNull
 
 class FontMgrTest {
@@ -92,6 +93,42 @@ class FontMgrTest {
         }
     }
 
+    @Test
+    fun defaultIndexIsConsistent() = runTest {
+        val fontManager = FontMgr.default
+        for (index in 0 until minOf(fontManager.familiesCount, 5)) {
+            val familyName = fontManager.getFamilyName(index)
+            val count = fontManager.makeStyleSet(index)!!.use { it.count() }
+            fontManager.matchFamily(familyName).use { styleSet ->
+                assertEquals(count, styleSet.count())
+            }
+
+            val first = fontManager.matchFamilyStyle(familyName, FontStyle.NORMAL)
+            val second = fontManager.matchFamilyStyle(familyName, FontStyle.NORMAL)
+            assertEquals(first, second)
+            first?.close()
+            second?.close()
+        }
+    }
+
+    @Test
+    fun defaultIndexStyleSetKeepsFaces() = runTest {
+        val fontManager = FontMgr.default
+        for (index in 0 until minOf(fontManager.familiesCount, 5)) {
+            fontManager.makeStyleSet(index)!!.use { styleSet ->
+                val typefaces = (0 until styleSet.count()).map { styleSet.getTypeface(it) }
+                // Faces sharing a style used to collapse into the first one of them
+                for (i in typefaces.indices) {
+                    for (j in i + 1 until typefaces.size) {
+                        if (typefaces[i] != null && styleSet.getStyle(i) == styleSet.getStyle(j))
+                            assertNotEquals(typefaces[i], typefaces[j])
+                    }
+                }
+                typefaces.forEach { it?.close() }
+            }
+        }
+    }
+
 
     @Test
     @SkipJsTarget
@@ -12,6 +12,8 @@ import org.jetbrains.skiko.tests.runTest
 import kotlin.test.Test
 import kotlin.test.assertContentEquals
 import kotlin.test.assertEquals
+import kotlin.test.assertFalse
+import kotlin.test.assertTrue
 
 private fun isLinuxOrJs() = (hostOs == OS.Linux) || (hostOs == OS.JS)
 private fun isWin() = (hostOs == OS.Windows)
@@ -137,4 +139,47 @@ class FontTests {
 
         }
     }
-}
\ No newline at end of file
+
+    @Test
+    fun pathsCombinedMatchIndividualPaths() = runTest {
+        val jbMono = Typeface.makeFromResource("./fonts/JetBrainsMono-Regular.ttf")
+        Font(jbMono, 17f).use { font ->
+            val glyphs = font.getStringGlyphs("Paths, Paths")
+            val positions = FloatArray(glyphs.size * 2) { i -> if (i % 2 == 0) i * 5f else 20f }
+
+            val combined = font.getPathsCombined(glyphs, positions, parallel = true)
+            assertEquals(glyphs.size + 1, combined.verbOffsets.size)
+            assertEquals(0, combined.verbOffsets[0])
+            assertEquals(combined.path.verbsCount, combined.verbOffsets[glyphs.size])
+            for (i in glyphs.indices) {
+                val glyphVerbs = font.getPath(glyphs[i])?.verbsCount ?: 0
+                assertEquals(glyphVerbs, combined.verbOffsets[i + 1] - combined.verbOffsets[i])
+            }
+
+            val expected = Path()
+            for (i in glyphs.indices) {
+                font.getPath(glyphs[i])?.let { expected.addPath(it, positions[i * 2], positions[i * 2 + 1]) }
+            }
+            assertContentEquals(expected.points, combined.path.points)
+
+            val hitsBefore = Font.pathCacheStats.hits
+            font.getPaths(glyphs)
+            assertTrue(Font.pathCacheStats.hits >= hitsBefore + glyphs.size)
+        }
+    }
+
+    @Test
+    fun typefaceCoverageMatchesCmap() = runTest {
+        val jbMono = Typeface.makeFromResource("./fonts/JetBrainsMono-Regular.ttf")
+        for (unichar in 0 until 0x3000) {
+            assertEquals(jbMono.getUTF32Glyph(unichar) != 0.toShort(), jbMono.covers(unichar), "U+${unichar.toString(16)}")
+        }
+        assertFalse(jbMono.covers(-1))
+        assertFalse(jbMono.covers(0x110000))
+
+        assertTrue(jbMono.coversAll("ABCDE"))
+        assertFalse(jbMono.coversAll("EЙ無"))
+        assertTrue(jbMono.coversAll(IntArray(0)))
+        assertTrue(jbMono.coveredCount > 0)
+    }
+}
@@ -0,0 +1,57 @@
+package org.jetbrains.skia
+
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFalse
+import kotlin.test.assertNotNull
+import kotlin.test.assertNull
+import kotlin.test.assertTrue
+
+class FrameCaptureTest {
+    private fun drawFrame(canvas: Canvas) {
+        canvas.clear(Color.WHITE)
+        canvas.translate(4f, 4f)
+        canvas.drawRect(Rect(6f, 6f, 16f, 16f), Paint().apply { color = Color.RED })
+    }
+
+    @Test
+    fun drawsIntoTargetWhileCapturing() {
+        val surface = Surface.makeRasterN32Premul(32, 32)
+        val saveCount = surface.canvas.saveCount
+        val capture = FrameCapture()
+        assertFalse(capture.isCapturing)
+
+        drawFrame(capture.beginCapture(surface.canvas, Rect(0f, 0f, 32f, 32f)))
+        assertTrue(capture.isCapturing)
+        val picture = assertNotNull(capture.finishCapture())
+        assertFalse(capture.isCapturing)
+
+        val drawn = Bitmap.makeFromImage(surface.makeImageSnapshot())
+        assertEquals(Color.RED, drawn.getColor(15, 15))
+        assertEquals(Color.WHITE, drawn.getColor(2, 2))
+        // Translation is not left on the target
+        assertEquals(Matrix33.IDENTITY, surface.canvas.localToDeviceAsMatrix33)
+        assertEquals(saveCount, surface.canvas.saveCount)
+
+        val replay = Surface.makeRasterN32Premul(32, 32)
+        picture.playback(replay.canvas)
+        assertEquals(Color.RED, Bitmap.makeFromImage(replay.makeImageSnapshot()).getColor(15, 15))
+    }
+
+    @Test
+    fun finishWithoutBeginReturnsNull() {
+        assertNull(FrameCapture().finishCapture())
+    }
+
+    @Test
+    fun captureCanBeReplayedFromData() {
+        val surface = Surface.makeRasterN32Premul(32, 32)
+        val data = surface.captureFrame { drawFrame(it) }
+        val picture = assertNotNull(Picture.makeFromData(data))
+        assertEquals(Rect(0f, 0f, 32f, 32f), picture.cullRect)
+
+        val replay = Surface.makeRasterN32Premul(32, 32)
+        picture.playback(replay.canvas)
+        assertEquals(Color.RED, Bitmap.makeFromImage(replay.makeImageSnapshot()).getColor(15, 15))
+    }
+}
@@ -0,0 +1,114 @@
+package org.jetbrains.skia
+
+import org.jetbrains.skia.impl.use
+import org.jetbrains.skiko.tests.runTest
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertNotNull
+import kotlin.test.assertNull
+import kotlin.test.assertTrue
+
+class ImageCacheTest {
+    private fun encodedImage(size: Int, color: Int): ByteArray {
+        return Surface.makeRasterN32Premul(size, size).use { surface ->
+            surface.canvas.clear(color)
+            surface.makeImageSnapshot().use { image ->
+                image.encodeToData()!!.bytes
+            }
+        }
+    }
+
+    @Test
+    fun canCacheDecodedImages() = runTest {
+        val cache = ImageCache()
+        val bytes = encodedImage(16, Color.RED)
+
+        val first = cache.findOrDecode(bytes)
+        val second = cache.findOrDecode(bytes.copyOf())
+        assertNotNull(first)
+        assertEquals(first, second)
+        assertEquals(16, first.width)
+        assertEquals(Color.RED, Bitmap.makeFromImage(first).getColor(8, 8))
+
+        val stats = cache.stats
+        assertEquals(1, stats.hits)
+        assertEquals(1, stats.misses)
+        assertEquals(1, stats.count)
+        assertTrue(stats.bytesUsed >= 16 * 16 * 4)
+    }
+
+    @Test
+    fun keyIncludesRequestedSize() = runTest {
+        val cache = ImageCache()
+        val bytes = encodedImage(16, Color.GREEN)
+
+        val scaled = cache.findOrDecode(bytes, 8, 8)
+        assertNotNull(scaled)
+        assertEquals(8, scaled.width)
+        assertEquals(8, scaled.height)
+        assertEquals(16, cache.findOrDecode(bytes)!!.width)
+        assertEquals(2, cache.stats.count)
+        assertEquals(2, cache.stats.misses)
+    }
+
+    @Test
+    fun evictsLeastRecentlyUsed() = runTest {
+        val red = encodedImage(32, Color.RED)
+        val green = encodedImage(32, Color.GREEN)
+        val blue = encodedImage(32, Color.BLUE)
+        val cache = ImageCache(2 * 32 * 32 * 4 + red.size + green.size + blue.size)
+
+        cache.findOrDecode(red)
+        cache.findOrDecode(green)
+        cache.findOrDecode(red)
+        cache.findOrDecode(blue)
+
+        val stats = cache.stats
+        assertEquals(1, stats.evictions)
+        assertEquals(2, stats.count)
+        assertTrue(stats.bytesUsed <= stats.byteBudget)
+
+        cache.resetStats()
+        cache.findOrDecode(red)
+        assertEquals(1, cache.stats.hits)
+        cache.findOrDecode(green)
+        assertEquals(1, cache.stats.misses)
+    }
+
+    @Test
+    fun canPurge() = runTest {
+        val cache = ImageCache()
+        cache.findOrDecode(encodedImage(16, Color.RED))
+        cache.findOrDecode(encodedImage(16, Color.GREEN))
+        val generation = cache.stats.generationId
+        val bytesUsed = cache.stats.bytesUsed
+
+        cache.onMemoryPressure(false)
+        assertTrue(cache.stats.bytesUsed <= bytesUsed / 2)
+
+        cache.purgeAll()
+        assertEquals(0, cache.stats.count)
+        assertEquals(0, cache.stats.bytesUsed)
+        assertEquals(generation + 1, cache.stats.generationId)
+
+        cache.findOrDecode(encodedImage(16, Color.RED))
+        cache.byteBudget = 0
+        assertEquals(0, cache.stats.count)
+    }
+
+    @Test
+    fun returnsNullForInvalidData() = runTest {
+        val cache = ImageCache()
+        assertNull(cache.findOrDecode(byteArrayOf(1, 2, 3)))
+        assertEquals(0, cache.stats.count)
+    }
+
+    @Test
+    fun rejectsNegativeBudgets() {
+        assertFailsWith<IllegalArgumentException> { ImageCache(-1) }
+        val cache = ImageCache()
+        assertFailsWith<IllegalArgumentException> { cache.byteBudget = -1 }
+        assertEquals(ImageCache.DEFAULT_BYTE_BUDGET, cache.byteBudget)
+    }
+}
@@ -105,6 +105,348 @@ class ParagraphTest {
         )
     }
 
+    @Test
+    fun flatArraysMatchObjects() = runTest {
+        val text = "Hello,\n Пользователь1!\nПока"
+        val paragraph = ParagraphBuilder(ParagraphStyle().apply { textStyle = style.textStyle }, fontCollection()).use {
+            it.addText(text)
+            it.build()
+        }.layout(100.0f)
+
+        val lines = paragraph.lineMetricsArray
+        assertEquals(paragraph.lineNumber, lines.size)
+        assertContentEquals(paragraph.lineMetrics, lines.toTypedArray())
+        // Indices are in UTF-16 code units, as Kotlin strings
+        assertEquals(text.length, lines[lines.size - 1].endIncludingNewline)
+
+        val boxes = paragraph.getRectsForRangeArray(0, text.length, RectHeightMode.MAX, RectWidthMode.TIGHT)
+        assertEquals(boxes.size * 4, boxes.ltrb.size)
+        assertContentEquals(
+            paragraph.getRectsForRange(0, text.length, RectHeightMode.MAX, RectWidthMode.TIGHT),
+            boxes.toTypedArray()
+        )
+        assertEquals(0, paragraph.rectsForPlaceholdersArray.size)
+    }
+
+    @Test
+    fun layoutAllMatchesSequentialLayout() = runTest {
+        val collection = fontCollection()
+        val paragraphStyle = ParagraphStyle().apply { textStyle = style.textStyle }
+        val texts = List(64) { i -> "Paragraph $i: " + "Съешь же ещё этих мягких французских булок. ".repeat(i % 7 + 1) }
+        fun build() = texts.map { text ->
+            ParagraphBuilder(paragraphStyle, collection).use {
+                it.addText(text)
+                it.build()
+            }
+        }
+        val widths = FloatArray(texts.size) { i -> 100f + i * 10f }
+
+        val sequential = build()
+        sequential.forEachIndexed { i, paragraph -> paragraph.layout(widths[i]) }
+        val parallel = build()
+        Paragraph.layoutAll(parallel.toTypedArray(), widths)
+
+        for (i in texts.indices) {
+            assertEquals(sequential[i].height, parallel[i].height)
+            assertEquals(sequential[i].lineNumber, parallel[i].lineNumber)
+            assertContentEquals(sequential[i].lineMetrics, parallel[i].lineMetrics)
+        }
+    }
+
+    @Test
+    fun lazyParagraphLaysOutOnDemand() = runTest {
+        val collection = fontCollection()
+        val paragraphStyle = ParagraphStyle().apply { textStyle = style.textStyle }
+        val text = (0 until 2000).joinToString("\n") { "Строка $it: the quick brown fox jumps over the lazy dog" }
+        val full = ParagraphBuilder(paragraphStyle, collection).use {
+            it.addText(text)
+            it.build()
+        }.layout(300f)
+
+        val lazy = LazyParagraph(text, paragraphStyle, collection).layout(300f)
+        lazy.layoutUntil(100f)
+        assertTrue(lazy.laidOutHeight >= 100f)
+        assertTrue(!lazy.isLaidOutCompletely)
+        assertTrue(lazy.laidOutLineCount < full.lineNumber)
+        assertCloseEnough(full.height, lazy.height, full.height * 0.1f)
+
+        val fullMetrics = full.lineMetrics
+        val lazyMetrics = lazy.lineMetrics
+        assertEquals(lazy.laidOutLineCount, lazyMetrics.size)
+        for (i in lazyMetrics.indices) {
+            assertEquals(fullMetrics[i].startIndex, lazyMetrics[i].startIndex)
+            assertEquals(fullMetrics[i].endIncludingNewline, lazyMetrics[i].endIncludingNewline)
+        }
+
+        val y = full.height * 0.75f
+        assertEquals(full.getGlyphPositionAtCoordinate(20f, y), lazy.getGlyphPositionAtCoordinate(20f, y))
+
+        lazy.layoutAll()
+        assertTrue(lazy.isLaidOutCompletely)
+        assertEquals(full.lineNumber, lazy.laidOutLineCount)
+        assertCloseEnough(full.height, lazy.height, 1f)
+        assertEquals(text.length, lazy.lineMetrics.last().endIncludingNewline)
+    }
+
+    @Test
+    fun lazyParagraphKeepsTrailingEmptyLine() = runTest {
+        val collection = fontCollection()
+        val paragraphStyle = ParagraphStyle().apply { textStyle = style.textStyle }
+        // Last line break is the first one past 16K, where the text is split into chunks
+        val body = buildString {
+            var i = 0
+            while (length < 16 * 1024) {
+                if (i > 0) append('\n')
+                append("Line $i: the quick brown fox jumps over the lazy dog")
+                i++
+            }
+        }
+        val text = body + "\n"
+        val full = ParagraphBuilder(paragraphStyle, collection).use {
+            it.addText(text)
+            it.build()
+        }.layout(300f)
+
+        val lazy = LazyParagraph(text, paragraphStyle, collection).layout(300f)
+        lazy.layoutAll()
+        assertEquals(full.lineNumber, lazy.laidOutLineCount)
+        assertCloseEnough(full.height, lazy.height, 1f)
+        assertEquals(full.lineMetrics.last().startIndex, lazy.lineMetrics.last().startIndex)
+    }
+
+    @Test
+    fun addStyledTextMatchesPushPop() = runTest {
+        val collection = fontCollection()
+        val paragraphStyle = ParagraphStyle().apply { textStyle = style.textStyle }
+        val big = TextStyle().apply {
+            fontFamilies = arrayOf("Inter")
+            fontSize = 24f
+        }
+        val small = TextStyle().apply {
+            fontFamilies = arrayOf("Inter")
+            fontSize = 10f
+        }
+        val parts = listOf("Привет, " to null, "big" to big, " normal " to null, "small" to small, " конец" to null)
+        val text = parts.joinToString("") { it.first }
+
+        val expected = ParagraphBuilder(paragraphStyle, collection).use { builder ->
+            for ((part, partStyle) in parts) {
+                if (partStyle != null) builder.pushStyle(partStyle)
+                builder.addText(part)
+                if (partStyle != null) builder.popStyle()
+            }
+            builder.build()
+        }.layout(120f)
+
+        val starts = intArrayOf(text.indexOf("big"), text.indexOf("small"))
+        val ends = intArrayOf(starts[0] + 3, starts[1] + 5)
+        val actual = ParagraphBuilder(paragraphStyle, collection).use {
+            it.addStyledText(text, starts, ends, arrayOf(big, small))
+            it.build()
+        }.layout(120f)
+
+        assertEquals(expected.height, actual.height)
+        assertContentEquals(expected.lineMetrics, actual.lineMetrics)
+        assertContentEquals(
+            expected.getRectsForRange(0, text.length, RectHeightMode.TIGHT, RectWidthMode.TIGHT),
+            actual.getRectsForRange(0, text.length, RectHeightMode.TIGHT, RectWidthMode.TIGHT)
+        )
+        // Font size updates need the text the builder collected
+        actual.updateFontSize(0, 3, 30f)
+    }
+
+    @Test
+    fun rebuildWithTextMatchesFreshBuild() = runTest {
+        val collection = fontCollection()
+        val paragraphStyle = ParagraphStyle().apply { textStyle = style.textStyle }
+        val big = TextStyle().apply {
+            fontFamilies = arrayOf("Inter")
+            fontSize = 24f
+        }
+        fun build(head: String, styled: String, tail: String) = ParagraphBuilder(paragraphStyle, collection).use {
+            it.addText(head)
+            it.pushStyle(big)
+            it.addText(styled)
+            it.popStyle()
+            it.addText(tail)
+            it.build()
+        }.layout(120f)
+
+        val original = build("Привет, ", "big", " конец")
+        // Replaced text continues the style of the preceding character
+        val edited = original.rebuildWithText(9, 11, "IGGER").layout(120f)
+        val expected = build("Привет, ", "bIGGER", " конец")
+        assertEquals(expected.height, edited.height)
+        assertContentEquals(expected.lineMetrics, edited.lineMetrics)
+        assertContentEquals(
+            expected.getRectsForRange(0, 20, RectHeightMode.TIGHT, RectWidthMode.TIGHT),
+            edited.getRectsForRange(0, 20, RectHeightMode.TIGHT, RectWidthMode.TIGHT)
+        )
+
+        val prepended = edited.rebuildWithText(0, 0, ">> ").layout(120f)
+        assertContentEquals(build(">> Привет, ", "bIGGER", " конец").lineMetrics, prepended.lineMetrics)
+        // Edited paragraph carries its text for style updates
+        prepended.updateFontSize(0, 3, 30f)
+        // Source paragraph is left untouched
+        assertContentEquals(build("Привет, ", "big", " конец").lineMetrics, original.lineMetrics)
+    }
+
+    @Test
+    fun rebuildWithTextKeepsPlaceholders() = runTest {
+        val collection = fontCollection()
+        val placeholder = PlaceholderStyle(10f, 10f, PlaceholderAlignment.BASELINE, BaselineMode.ALPHABETIC, 0f)
+        fun build(vararg parts: String) = ParagraphBuilder(style, collection).use {
+            parts.forEachIndexed { i, part ->
+                if (i > 0) it.addPlaceholder(placeholder)
+                it.addText(part)
+            }
+            it.build()
+        }.layout(200f)
+
+        // Each placeholder takes one UTF-16 code unit of text
+        val original = build("one ", " two ", " three")
+        val edited = original.rebuildWithText(6, 9, "2").layout(200f)
+        val expected = build("one ", " 2 ", " three")
+        assertEquals(2, edited.rectsForPlaceholders.size)
+        assertContentEquals(expected.rectsForPlaceholders, edited.rectsForPlaceholders)
+        assertContentEquals(expected.lineMetrics, edited.lineMetrics)
+
+        // Placeholder inside the replaced range is dropped
+        val merged = original.rebuildWithText(4, 6, "").layout(200f)
+        assertContentEquals(build("one two ", " three").rectsForPlaceholders, merged.rectsForPlaceholders)
+    }
+
+    @Test
+    fun rebuildWithTextKeepsPlaceholdersSharingStyle() = runTest {
+        val collection = fontCollection()
+        val placeholder = PlaceholderStyle(10f, 10f, PlaceholderAlignment.BASELINE, BaselineMode.ALPHABETIC, 0f)
+        val big = TextStyle().apply {
+            fontFamilies = arrayOf("Inter")
+            fontSize = 24f
+        }
+        // Placeholder is pushed with the style of the text around it
+        fun build(before: String, after: String) = ParagraphBuilder(style, collection).use {
+            it.addText("start ")
+            it.pushStyle(big)
+            it.addText(before)
+            it.addPlaceholder(placeholder)
+            it.addText(after)
+            it.popStyle()
+            it.build()
+        }.layout(300f)
+
+        val original = build("big", "text")
+        val afterPlaceholder = original.rebuildWithText(10, 10, "er").layout(300f)
+        val expected = build("big", "ertext")
+        assertEquals(1, afterPlaceholder.rectsForPlaceholders.size)
+        assertContentEquals(expected.rectsForPlaceholders, afterPlaceholder.rectsForPlaceholders)
+        assertContentEquals(expected.lineMetrics, afterPlaceholder.lineMetrics)
+
+        val beforePlaceholder = original.rebuildWithText(7, 9, "").layout(300f)
+        assertContentEquals(build("b", "text").rectsForPlaceholders, beforePlaceholder.rectsForPlaceholders)
+    }
+
+    @Test
+    fun lazyParagraphReplaceTextMatchesFreshBuild() = runTest {
+        val collection = fontCollection()
+        val paragraphStyle = ParagraphStyle().apply { textStyle = style.textStyle }
+        var text = (0 until 2000).joinToString("\n") { "Строка $it: the quick brown fox jumps over the lazy dog" }
+        val lazy = LazyParagraph(text, paragraphStyle, collection).layout(300f)
+        lazy.layoutAll()
+
+        fun replace(from: Int, to: Int, replacement: String) {
+            lazy.replaceText(from, to, replacement)
+            text = text.substring(0, from) + replacement + text.substring(to)
+        }
+        fun assertMatchesFreshBuild() {
+            val full = ParagraphBuilder(paragraphStyle, collection).use {
+                it.addText(text)
+                it.build()
+            }.layout(300f)
+            lazy.layoutAll()
+            assertEquals(full.lineNumber, lazy.laidOutLineCount)
+            assertCloseEnough(full.height, lazy.height, 1f)
+            val fullMetrics = full.lineMetrics
+            val lazyMetrics = lazy.lineMetrics
+            assertEquals(fullMetrics.size, lazyMetrics.size)
+            for (i in lazyMetrics.indices) {
+                assertEquals(fullMetrics[i].startIndex, lazyMetrics[i].startIndex)
+                assertEquals(fullMetrics[i].endIncludingNewline, lazyMetrics[i].endIncludingNewline)
+            }
+        }
+
+        // Lines before the edited chunk stay laid out
+        val line1990 = text.indexOf("Строка 1990")
+        replace(line1990, line1990 + 6, "Line\nsplit")
+        assertTrue(!lazy.isLaidOutCompletely)
+        assertTrue(lazy.laidOutLineCount > 0)
+        assertMatchesFreshBuild()
+
+        // Edits across chunks, at the start and at the end
+        replace(100, text.length - 100, "joined")
+        assertMatchesFreshBuild()
+        replace(0, 0, "Первая\n")
+        assertMatchesFreshBuild()
+        replace(text.length, text.length, "\n")
+        assertMatchesFreshBuild()
+    }
+
+    @Test
+    fun paragraphCacheStatsAndBudget() = runTest {
+        val collection = fontCollection()
+        val cache = collection.paragraphCache
+        fun layout(text: String) = ParagraphBuilder(style, collection).use {
+            it.addText(text)
+            it.build()
+        }.layout(100f)
+
+        layout("Cached text")
+        layout("Cached text")
+        val stats = cache.stats
+        assertEquals(1L, stats.misses)
+        assertEquals(1L, stats.hits)
+        assertEquals(1, stats.count)
+        assertTrue(stats.bytesUsed > 0)
+        assertEquals(stats.bytesUsed, stats.averageEntryBytes)
+
+        // Other collections have separate caches
+        assertEquals(0, fontCollection().paragraphCache.stats.count)
+
+        cache.setByteBudget(1)
+        assertEquals(0, cache.stats.count)
+        layout("Over budget")
+        assertEquals(0, cache.stats.count)
+        assertEquals(2L, cache.stats.evictions)
+
+        cache.resetStats()
+        assertEquals(0L, cache.stats.hits)
+    }
+
+    @Test
+    fun paragraphCacheStatsTellStylesApart() = runTest {
+        val collection = fontCollection()
+        val cache = collection.paragraphCache
+        fun layout(letterSpacing: Float) = ParagraphBuilder(style, collection).use {
+            it.pushStyle(TextStyle().apply {
+                fontFamilies = arrayOf("Inter")
+                this.letterSpacing = letterSpacing
+            })
+            it.addText("Same text")
+            it.popStyle()
+            it.build()
+        }.layout(100f)
+
+        layout(0f)
+        val oneEntryBytes = cache.stats.bytesUsed
+        // Differs from the first paragraph only in letter spacing, which is part of the cache key
+        layout(2f)
+        val stats = cache.stats
+        assertEquals(2L, stats.misses)
+        assertEquals(2, stats.count)
+        assertEquals(0L, stats.evictions)
+        assertTrue(stats.bytesUsed > oneEntryBytes)
+    }
+
     @Test
     fun getRectsForRange() {
         val fontCollection = FontCollection().setDefaultFontManager(FontMgr.default)
@@ -0,0 +1,89 @@
+package org.jetbrains.skia
+
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFalse
+import kotlin.test.assertTrue
+
+class PictureProfileTest {
+    private fun makePicture(): Picture {
+        val nestedRecorder = PictureRecorder()
+        val nestedCanvas = nestedRecorder.beginRecording(Rect(0f, 0f, 32f, 32f))
+        nestedCanvas.drawRect(Rect(24f, 24f, 28f, 28f), Paint().apply { color = Color.GREEN })
+        nestedCanvas.drawRect(Rect(24f, 28f, 28f, 32f), Paint().apply { color = Color.BLUE })
+        val nested = nestedRecorder.finishRecordingAsPicture()
+
+        val recorder = PictureRecorder()
+        val canvas = recorder.beginRecording(Rect(0f, 0f, 32f, 32f))
+        canvas.drawRect(Rect(0f, 0f, 32f, 32f), Paint().apply { color = Color.WHITE })
+        canvas.save()
+        canvas.clipRect(Rect(0f, 0f, 16f, 32f))
+        canvas.drawRect(Rect(10f, 10f, 20f, 20f), Paint().apply { color = Color.RED })
+        canvas.restore()
+        canvas.drawPicture(nested)
+        return recorder.finishRecordingAsPicture()
+    }
+
+    @Test
+    fun reportsOpsInPlaybackOrder() {
+        val profile = PictureProfile(makePicture())
+        val ops = profile.ops
+        val types = ops.map { it.type }.filter { it != PictureOpType.SAVE && it != PictureOpType.RESTORE }
+
+        assertEquals(
+            listOf(
+                PictureOpType.DRAW_RECT,
+                PictureOpType.CLIP_RECT,
+                PictureOpType.DRAW_RECT,
+                PictureOpType.DRAW_PICTURE,
+                PictureOpType.DRAW_RECT,
+                PictureOpType.DRAW_RECT
+            ),
+            types
+        )
+        assertTrue(ops.any { it.type == PictureOpType.SAVE })
+
+        val rects = ops.filter { it.type == PictureOpType.DRAW_RECT }
+        assertEquals(IRect.makeLTRB(0, 0, 32, 32), rects[0].bounds)
+        // Clipped to the left half
+        assertEquals(IRect.makeLTRB(10, 10, 16, 20), rects[1].bounds)
+        assertEquals(IRect.makeLTRB(24, 24, 28, 28), rects[2].bounds)
+        assertEquals(0f, ops.first { it.type == PictureOpType.DRAW_PICTURE }.micros)
+    }
+
+    @Test
+    fun aggregatesHistogram() {
+        val profile = PictureProfile(makePicture())
+        val histogram = profile.histogram
+        assertEquals(4, histogram.first { it.type == PictureOpType.DRAW_RECT }.count)
+        assertEquals(1, histogram.first { it.type == PictureOpType.CLIP_RECT }.count)
+        assertFalse(histogram.any { it.type == PictureOpType.DRAW_PATH })
+        assertTrue(histogram.zipWithNext().all { (a, b) -> a.micros >= b.micros })
+    }
+
+    @Test
+    fun computesOverdraw() {
+        val profile = PictureProfile(makePicture())
+        val overdraw = profile.overdraw
+        assertEquals(ColorType.ALPHA_8, overdraw.colorType)
+        assertEquals(32, overdraw.width)
+        assertEquals(32, overdraw.height)
+        assertEquals(1, Color.getA(overdraw.getColor(1, 1)))
+        assertEquals(2, Color.getA(overdraw.getColor(12, 12)))
+        // Red rect is clipped out here
+        assertEquals(1, Color.getA(overdraw.getColor(18, 12)))
+        assertEquals(2, Color.getA(overdraw.getColor(25, 25)))
+        assertEquals(2, profile.maxOverdraw)
+        assertTrue(profile.averageOverdraw > 1f && profile.averageOverdraw < 2f)
+    }
+
+    @Test
+    fun exportsJson() {
+        val profile = PictureProfile(makePicture())
+        val json = profile.toJson()
+        assertTrue(json.contains("\"histogram\""))
+        assertTrue(json.contains("\"drawRect\""))
+        assertTrue(json.contains("\"ops\""))
+        assertFalse(profile.toJson(includeOps = false).contains("\"ops\""))
+    }
+}
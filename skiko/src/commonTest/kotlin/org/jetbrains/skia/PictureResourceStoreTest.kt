@@ -0,0 +1,92 @@
+package org.jetbrains.skia
+
+import org.jetbrains.skia.tests.makeFromResource
+import org.jetbrains.skiko.tests.runTest
+import kotlin.test.Test
+import kotlin.test.assertContentEquals
+import kotlin.test.assertEquals
+import kotlin.test.assertNotNull
+import kotlin.test.assertNull
+import kotlin.test.assertTrue
+
+class PictureResourceStoreTest {
+    private fun makeImage(): Image {
+        val surface = Surface.makeRasterN32Premul(16, 16)
+        surface.canvas.clear(Color.BLUE)
+        surface.canvas.drawCircle(8f, 8f, 4f, Paint().apply { color = Color.YELLOW })
+        return surface.makeImageSnapshot()
+    }
+
+    private fun recordFrame(font: Font, image: Image, index: Int): Picture {
+        val recorder = PictureRecorder()
+        val canvas = recorder.beginRecording(Rect(0f, 0f, 64f, 64f))
+        canvas.clear(Color.WHITE)
+        canvas.drawImage(image, index.toFloat(), 0f)
+        canvas.drawString("Frame $index", 0f, 40f, font, Paint().apply { color = Color.BLACK })
+        return recorder.finishRecordingAsPicture()
+    }
+
+    private fun render(picture: Picture): ByteArray {
+        val surface = Surface.makeRasterN32Premul(64, 64)
+        picture.playback(surface.canvas)
+        return Bitmap.makeFromImage(surface.makeImageSnapshot()).readPixels()!!
+    }
+
+    @Test
+    fun deduplicatesResources() = runTest {
+        val font = Font(Typeface.makeFromResource("./fonts/Inter-Hinted-Regular.ttf"), 16f)
+        val image = makeImage()
+        val frames = (0 until 4).map { recordFrame(font, image, it) }
+        val store = PictureResourceStore()
+
+        val standalone = frames.sumOf { it.serializeToData().size }
+        val referencing = frames.map { it.serializeToData(store) }
+
+        val stats = store.stats
+        assertEquals(1, stats.typefaces)
+        assertEquals(1, stats.images)
+        assertEquals(8, stats.references)
+        assertEquals(stats.storedBytes * 4, stats.referencedBytes)
+        assertTrue(referencing.sumOf { it.size } + stats.storedBytes < standalone)
+
+        frames.zip(referencing).forEach { (frame, data) ->
+            val restored = assertNotNull(Picture.makeFromData(data, store))
+            assertContentEquals(render(frame), render(restored))
+        }
+    }
+
+    @Test
+    fun storeCanBeShippedWithPictures() = runTest {
+        val font = Font(Typeface.makeFromResource("./fonts/Inter-Hinted-Regular.ttf"), 16f)
+        val frame = recordFrame(font, makeImage(), 1)
+        val store = PictureResourceStore()
+        val data = frame.serializeToData(store)
+
+        val shipped = assertNotNull(PictureResourceStore.makeFromData(store.serializeToData()))
+        assertEquals(store.stats.storedBytes, shipped.stats.storedBytes)
+        val restored = assertNotNull(Picture.makeFromData(data, shipped))
+        assertContentEquals(render(frame), render(restored))
+    }
+
+    @Test
+    fun readsPicturesSerializedWithoutStore() = runTest {
+        val inter = Font(Typeface.makeFromResource("./fonts/Inter-Hinted-Regular.ttf"), 16f)
+        val mono = Font(Typeface.makeFromResource("./fonts/JetBrainsMono-Regular.ttf"), 16f)
+        val recorder = PictureRecorder()
+        val canvas = recorder.beginRecording(Rect(0f, 0f, 64f, 64f))
+        canvas.clear(Color.WHITE)
+        canvas.drawImage(makeImage(), 0f, 0f)
+        // Second typeface checks that the typeface table stays in sync after the first one
+        canvas.drawString("Inter", 0f, 30f, inter, Paint().apply { color = Color.BLACK })
+        canvas.drawString("Mono", 0f, 50f, mono, Paint().apply { color = Color.BLACK })
+        val frame = recorder.finishRecordingAsPicture()
+
+        val restored = assertNotNull(Picture.makeFromData(frame.serializeToData(), PictureResourceStore()))
+        assertContentEquals(render(frame), render(restored))
+    }
+
+    @Test
+    fun rejectsMalformedStore() {
+        assertNull(PictureResourceStore.makeFromData(Data.makeFromBytes(byteArrayOf(1, 2, 3, 4, 5, 6, 7, 8))))
+    }
+}
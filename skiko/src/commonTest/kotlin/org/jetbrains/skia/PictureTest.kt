@@ -2,7 +2,9 @@ package org.jetbrains.skia
 
 import org.jetbrains.skia.tests.assertCloseEnough
 import kotlin.test.Test
+import kotlin.test.assertContentEquals
 import kotlin.test.assertEquals
+import kotlin.test.assertTrue
 
 class PictureTest {
     @Test
@@ -53,4 +55,39 @@ class PictureTest {
         assertEquals(2, drawCount)
         assertEquals(Color.RED, Bitmap.makeFromImage(surface.makeImageSnapshot()).getColor(15, 15))
     }
+
+    @Test
+    fun playbackTiledMatchesPlayback() {
+        val recorder = PictureRecorder()
+        val canvas = recorder.beginRecording(Rect(0f, 0f, 200f, 150f))
+        canvas.drawPaint(Paint().apply {
+            shader = Shader.makeLinearGradient(Point(0f, 0f), Point(200f, 150f), intArrayOf(Color.WHITE, Color.BLUE))
+        })
+        for (i in 0 until 20) {
+            canvas.drawCircle(i * 11f, i * 7f, 9.5f, Paint().apply { color = Color.makeARGB(160, 255, i * 12, 0) })
+        }
+        canvas.drawRRect(
+            RRect.makeXYWH(40f, 30f, 120f, 80f, 12f),
+            Paint().apply {
+                mode = PaintMode.STROKE
+                strokeWidth = 3.5f
+                maskFilter = MaskFilter.makeBlur(FilterBlurMode.NORMAL, 2f)
+            }
+        )
+        val pic = recorder.finishRecordingAsPicture()
+
+        val info = ImageInfo.makeN32Premul(300, 225)
+        val matrix = Matrix33.makeScale(1.5f)
+        val expected = Pixmap.make(info, Data.makeUninitialized(info.computeMinByteSize()), info.minRowBytes)
+        Surface.makeRasterDirect(expected).canvas.apply {
+            clear(Color.TRANSPARENT)
+            concat(matrix)
+            drawPicture(pic)
+        }
+
+        val actual = Pixmap.make(info, Data.makeUninitialized(info.computeMinByteSize()), info.minRowBytes)
+        actual.erase(Color.TRANSPARENT)
+        assertTrue(pic.playbackTiled(actual, matrix, tileSize = 32))
+        assertContentEquals(expected.buffer.bytes, actual.buffer.bytes)
+    }
 }
@@ -2,9 +2,11 @@ package org.jetbrains.skia
 
 import org.jetbrains.skia.tests.makeFromResource
 import org.jetbrains.skiko.tests.runTest
+import kotlin.math.abs
 import kotlin.test.Test
 import kotlin.test.assertEquals
 import kotlin.test.assertFalse
+import kotlin.test.assertTrue
 
 class PixmapTest {
     @Test
@@ -20,4 +22,71 @@ class PixmapTest {
         assertFalse(pixmap.computeIsOpaque())
     }
 
-}
\ No newline at end of file
+    private fun makePixmap(info: ImageInfo): Pixmap =
+        Pixmap.make(info, Data.makeUninitialized(info.computeMinByteSize()), info.minRowBytes)
+
+    // Raster surfaces don't accept every alpha type, so gradient is drawn premultiplied
+    // and then read into info
+    private fun makeGradientPixmap(info: ImageInfo): Pixmap {
+        val premul = makePixmap(info.withColorAlphaType(ColorAlphaType.PREMUL))
+        val surface = Surface.makeRasterDirect(premul)
+        surface.canvas.drawPaint(Paint().apply {
+            shader = Shader.makeLinearGradient(
+                Point(0f, 0f), Point(info.width.toFloat(), info.height.toFloat()),
+                intArrayOf(0x80FF0000.toInt(), 0x2000FF80, 0xFF0040FF.toInt(), 0x00000000)
+            )
+        })
+        if (info.colorAlphaType == ColorAlphaType.PREMUL)
+            return premul
+        val pixmap = makePixmap(info)
+        assertTrue(premul.readPixels(pixmap))
+        return pixmap
+    }
+
+    private fun assertConvertsLikeReadPixels(src: Pixmap, dstInfo: ImageInfo, tolerance: Int = 0) {
+        val expected = makePixmap(dstInfo)
+        val actual = makePixmap(dstInfo)
+        assertTrue(src.readPixels(expected))
+        assertTrue(src.convertPixels(actual))
+
+        val expectedBytes = expected.buffer.bytes
+        val actualBytes = actual.buffer.bytes
+        assertEquals(expectedBytes.size, actualBytes.size)
+        for (i in expectedBytes.indices) {
+            val diff = abs((expectedBytes[i].toInt() and 0xFF) - (actualBytes[i].toInt() and 0xFF))
+            assertTrue(diff <= tolerance, "${dstInfo.colorInfo.colorType} byte $i differs by $diff")
+        }
+    }
+
+    @Test
+    fun convertPixels8888() = runTest {
+        // Tall enough to be split into several bands
+        val premul = makeGradientPixmap(ImageInfo(256, 600, ColorType.RGBA_8888, ColorAlphaType.PREMUL))
+        assertConvertsLikeReadPixels(premul, ImageInfo(256, 600, ColorType.BGRA_8888, ColorAlphaType.PREMUL))
+        assertConvertsLikeReadPixels(premul, ImageInfo(256, 600, ColorType.RGBA_8888, ColorAlphaType.UNPREMUL), tolerance = 1)
+        assertConvertsLikeReadPixels(premul, ImageInfo(256, 600, ColorType.BGRA_8888, ColorAlphaType.UNPREMUL), tolerance = 1)
+
+        val unpremul = makeGradientPixmap(ImageInfo(256, 600, ColorType.RGBA_8888, ColorAlphaType.UNPREMUL))
+        assertConvertsLikeReadPixels(unpremul, ImageInfo(256, 600, ColorType.RGBA_8888, ColorAlphaType.PREMUL))
+        assertConvertsLikeReadPixels(unpremul, ImageInfo(256, 600, ColorType.BGRA_8888, ColorAlphaType.PREMUL))
+    }
+
+    @Test
+    fun convertPixelsOtherFormats() = runTest {
+        val src = makeGradientPixmap(ImageInfo(64, 64, ColorType.RGBA_8888, ColorAlphaType.PREMUL))
+        assertConvertsLikeReadPixels(src, ImageInfo(64, 64, ColorType.RGB_565, ColorAlphaType.OPAQUE))
+        assertConvertsLikeReadPixels(src, ImageInfo.makeA8(64, 64))
+
+        val f16 = makeGradientPixmap(ImageInfo(64, 64, ColorType.RGBA_F16, ColorAlphaType.PREMUL))
+        assertConvertsLikeReadPixels(f16, ImageInfo(64, 64, ColorType.RGBA_8888, ColorAlphaType.PREMUL))
+        assertConvertsLikeReadPixels(f16, ImageInfo(64, 64, ColorType.BGRA_8888, ColorAlphaType.UNPREMUL))
+    }
+
+    @Test
+    fun convertPixelsRequiresSameSize() = runTest {
+        val src = makeGradientPixmap(ImageInfo.makeN32Premul(8, 8))
+        val dstInfo = ImageInfo.makeN32Premul(4, 8)
+        val dst = makePixmap(dstInfo)
+        assertFalse(src.convertPixels(dst))
+    }
+}
@@ -0,0 +1,121 @@
+package org.jetbrains.skia
+
+import org.jetbrains.skiko.tests.runTest
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertFalse
+import kotlin.test.assertTrue
+
+class RetainedLayerTest {
+    private fun colorAt(surface: Surface, x: Int, y: Int) =
+        Bitmap.makeFromImage(surface.makeImageSnapshot()).getColor(x, y)
+
+    @Test
+    fun recordsOnlyWhenDirty() = runTest {
+        val layer = RetainedLayer(Rect(0f, 0f, 16f, 16f))
+        val surface = Surface.makeRasterN32Premul(16, 16)
+        var recordings = 0
+        var color = Color.RED
+
+        assertTrue(layer.isDirty)
+        repeat(3) {
+            layer.drawOrRecord(surface.canvas) {
+                recordings++
+                it.drawRect(Rect(0f, 0f, 16f, 16f), Paint().apply { this.color = color })
+            }
+        }
+        assertFalse(layer.isDirty)
+        assertEquals(1, recordings)
+        assertEquals(Color.RED, colorAt(surface, 8, 8))
+
+        color = Color.BLUE
+        layer.invalidate()
+        assertFalse(layer.draw(surface.canvas))
+        layer.drawOrRecord(surface.canvas) {
+            recordings++
+            it.drawRect(Rect(0f, 0f, 16f, 16f), Paint().apply { this.color = color })
+        }
+        assertEquals(2, recordings)
+        assertEquals(Color.BLUE, colorAt(surface, 8, 8))
+
+        val stats = layer.stats
+        assertEquals(2, stats.recordings)
+        assertEquals(4, stats.draws)
+        assertEquals(3, stats.misses)
+        assertTrue(stats.pictureBytes > 0)
+        assertEquals(0, stats.imageBytes)
+    }
+
+    @Test
+    fun rasterizesAfterReplays() = runTest {
+        val layer = RetainedLayer(Rect(0f, 0f, 16f, 16f))
+        layer.rasterAfterReplays = 2
+        val canvas = layer.beginRecording()
+        canvas.drawRect(Rect(4f, 4f, 12f, 12f), Paint().apply { color = Color.GREEN })
+        assertTrue(layer.finishRecording())
+
+        val surface = Surface.makeRasterN32Premul(32, 32)
+        surface.canvas.scale(2f, 2f)
+        repeat(4) { assertTrue(layer.draw(surface.canvas)) }
+
+        val stats = layer.stats
+        assertEquals(1, stats.rasterizations)
+        assertEquals(2, stats.rasterDraws)
+        assertEquals(32 * 32 * 4, stats.imageBytes)
+        assertEquals(Color.GREEN, colorAt(surface, 16, 16))
+        assertEquals(0, colorAt(surface, 2, 2))
+
+        // Rasterized image is dropped when scale changes
+        surface.canvas.scale(0.5f, 0.5f)
+        assertTrue(layer.draw(surface.canvas))
+        assertEquals(0, layer.stats.imageBytes)
+    }
+
+    @Test
+    fun rasterizesComplexPictures() = runTest {
+        val layer = RetainedLayer(Rect(0f, 0f, 16f, 16f))
+        layer.rasterAboveOpCount = 10
+        val canvas = layer.beginRecording()
+        repeat(20) { canvas.drawCircle(8f, 8f, it.toFloat(), Paint()) }
+        layer.finishRecording()
+
+        val surface = Surface.makeRasterN32Premul(16, 16)
+        assertTrue(layer.draw(surface.canvas))
+        assertEquals(1, layer.stats.rasterizations)
+    }
+
+    @Test
+    fun rasterIsNotResampledAtFractionalOffsets() = runTest {
+        val layer = RetainedLayer(Rect(0f, 0f, 16f, 16f))
+        layer.rasterAboveOpCount = 1
+        val canvas = layer.beginRecording()
+        canvas.drawRect(Rect(4f, 4f, 12f, 12f), Paint().apply { color = Color.GREEN })
+        layer.finishRecording()
+
+        val surface = Surface.makeRasterN32Premul(16, 16)
+        surface.canvas.translate(0.4f, 0.4f)
+        assertTrue(layer.draw(surface.canvas))
+        assertEquals(1, layer.stats.rasterDraws)
+        assertEquals(Color.GREEN, colorAt(surface, 4, 4))
+        assertEquals(Color.GREEN, colorAt(surface, 11, 11))
+        assertEquals(0, colorAt(surface, 3, 3))
+        assertEquals(0, colorAt(surface, 12, 12))
+    }
+
+    @Test
+    fun failedRecordingIsClosed() = runTest {
+        val layer = RetainedLayer(Rect(0f, 0f, 16f, 16f))
+        val surface = Surface.makeRasterN32Premul(16, 16)
+        assertFailsWith<IllegalStateException> {
+            layer.drawOrRecord(surface.canvas) { error("failed") }
+        }
+        assertTrue(layer.isDirty)
+
+        layer.drawOrRecord(surface.canvas) {
+            it.drawRect(Rect(0f, 0f, 16f, 16f), Paint().apply { color = Color.RED })
+        }
+        assertFalse(layer.isDirty)
+        assertEquals(Color.RED, colorAt(surface, 8, 8))
+    }
+}
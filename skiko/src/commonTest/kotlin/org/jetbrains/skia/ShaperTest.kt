@@ -4,6 +4,7 @@ import org.jetbrains.skia.shaper.RunHandler
 import org.jetbrains.skia.shaper.RunInfo
 import org.jetbrains.skia.shaper.Shaper
 import org.jetbrains.skia.shaper.ShapingOptions
+import org.jetbrains.skia.tests.assertCloseEnough
 import org.jetbrains.skia.tests.assertContentCloseEnough
 import org.jetbrains.skia.tests.makeFromResource
 import org.jetbrains.skiko.tests.runTest
@@ -130,4 +131,34 @@ class ShaperTest {
             Point(65.28407f, 0.0f)
         ), commitRuns[2].positions!!.sliceArray(0..4) as Array<Point>, 0.01f)
     }
+
+    @Test
+    fun shapingCacheReplaysSameResult() = runTest {
+        val shaper = Shaper.make()
+        val font = fontInter36()
+        Shaper.setCacheEnabled(true)
+        try {
+            Shaper.purgeCache()
+            val hitsBefore = Shaper.cacheStats.hits
+
+            val liveLine = shaper.shapeLine("Abc 123 -> xyz", font)
+            val cachedLine = shaper.shapeLine("Abc 123 -> xyz", font)
+            assertEquals(hitsBefore + 1, Shaper.cacheStats.hits)
+            assertContentEquals(liveLine.glyphs, cachedLine.glyphs)
+            assertContentEquals(liveLine.positions, cachedLine.positions)
+            assertContentEquals(liveLine.breakOffsets, cachedLine.breakOffsets)
+            assertEquals(liveLine.width, cachedLine.width)
+
+            // Offset isn't part of the key, cached positions are moved to it
+            val liveBlob = shaper.shape("wrapped text", font, 100f)!!
+            val cachedBlob = shaper.shape("wrapped text", font, 100f, Point(10f, 20f))!!
+            assertEquals(hitsBefore + 2, Shaper.cacheStats.hits)
+            assertContentEquals(liveBlob.glyphs, cachedBlob.glyphs)
+            assertCloseEnough(liveBlob.bounds.offset(10f, 20f), cachedBlob.bounds)
+            assertEquals(2, Shaper.cacheStats.count)
+        } finally {
+            Shaper.setCacheEnabled(false)
+            Shaper.purgeCache()
+        }
+    }
 }
@@ -231,4 +231,30 @@ class TextBlobTest {
         val blobFromData = TextBlob.makeFromData(data)!!
         assertContentEquals(expected = glyphs, actual = blobFromData.glyphs)
     }
+
+    @Test
+    fun metricsAreCachedPerBlob() = runTest {
+        val glyphs = shortArrayOf(1983, 830, 1213)
+        val positions = arrayOf(Point(0f, 10f), Point(26f, 10f), Point(48f, 10f))
+        val textBlob = TextBlob.makeFromPos(glyphs, positions, inter36())!!
+
+        val blockBounds = textBlob.blockBounds
+        val before = TextBlob.metricsCacheStats
+        assertEquals(blockBounds, textBlob.blockBounds)
+        assertEquals(10f, textBlob.firstBaseline)
+        assertEquals(10f, textBlob.lastBaseline)
+        val after = TextBlob.metricsCacheStats
+        // Other tests may query blobs concurrently, so only lower bounds are checked
+        assertTrue(after.hits - before.hits >= 3)
+        assertTrue(after.bytesUsed > 0)
+        assertTrue(after.bytesUsed <= after.byteBudget)
+
+        // Without full positioning there are no bounds, and that is cached as well
+        val horizontal = TextBlob.makeFromPosH(glyphs, floatArrayOf(0f, 26f, 48f), 10f, inter36())!!
+        assertFailsWith<IllegalArgumentException> { horizontal.blockBounds }
+        assertFailsWith<IllegalArgumentException> { horizontal.lastBaseline }
+
+        textBlob.close()
+        horizontal.close()
+    }
 }
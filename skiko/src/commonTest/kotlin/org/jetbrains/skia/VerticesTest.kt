@@ -0,0 +1,58 @@
+package org.jetbrains.skia
+
+import org.jetbrains.skia.util.assertContentSame
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+
+class VerticesTest {
+    private val positions = floatArrayOf(0f, 0f, 8f, 0f, 0f, 8f, 8f, 8f)
+    private val colors = intArrayOf(Color.RED, Color.GREEN, Color.BLUE, Color.YELLOW)
+    private val indices = shortArrayOf(0, 1, 2, 1, 3, 2)
+
+    @Test
+    fun drawsSameAsArrays() {
+        val expected = Surface.makeRasterN32Premul(8, 8)
+        expected.canvas.drawVertices(VertexMode.TRIANGLES, positions, colors, null, indices, BlendMode.MODULATE, Paint())
+
+        val vertices = Vertices.makeCopy(VertexMode.TRIANGLES, positions, colors, indices = indices)
+        assertEquals(4, vertices.vertexCount)
+        assertEquals(6, vertices.indexCount)
+        assertEquals(Rect(0f, 0f, 8f, 8f), vertices.bounds)
+
+        val got = Surface.makeRasterN32Premul(8, 8)
+        got.canvas.drawVertices(vertices, BlendMode.MODULATE, Paint())
+        assertContentSame(expected.makeImageSnapshot(), got.makeImageSnapshot(), 0.0)
+    }
+
+    @Test
+    fun partialUpdate() {
+        val vertices = Vertices.makeCopy(VertexMode.TRIANGLES, positions, colors, indices = indices)
+        val recorder = PictureRecorder()
+        recorder.beginRecording(Rect(0f, 0f, 8f, 8f)).drawVertices(vertices, BlendMode.MODULATE, Paint())
+        val picture = recorder.finishRecordingAsPicture()
+
+        // Move the last vertex, the second triangle collapses onto the diagonal
+        vertices.setPositions(floatArrayOf(0f, 8f), offset = 3)
+        vertices.setColors(intArrayOf(Color.RED), offset = 2)
+        assertEquals(Rect(0f, 0f, 8f, 8f), vertices.bounds)
+
+        val surface = Surface.makeRasterN32Premul(8, 8)
+        surface.canvas.drawVertices(vertices, BlendMode.MODULATE, Paint())
+        val bitmap = Bitmap.makeFromImage(surface.makeImageSnapshot())
+        assertEquals(Color.TRANSPARENT, bitmap.getColor(7, 7))
+
+        // Recorded picture still has the original mesh
+        val replay = Surface.makeRasterN32Premul(8, 8)
+        replay.canvas.drawPicture(picture)
+        assertEquals(0xFF, Color.getA(Bitmap.makeFromImage(replay.makeImageSnapshot()).getColor(7, 7)))
+    }
+
+    @Test
+    fun rangeChecks() {
+        val vertices = Vertices.make(VertexMode.TRIANGLES, 3)
+        assertFailsWith<IllegalArgumentException> { vertices.setPositions(floatArrayOf(0f, 0f), offset = 3) }
+        assertFailsWith<IllegalArgumentException> { vertices.setColors(intArrayOf(Color.RED)) }
+        assertFailsWith<IllegalArgumentException> { vertices.setIndices(shortArrayOf(0)) }
+    }
+}
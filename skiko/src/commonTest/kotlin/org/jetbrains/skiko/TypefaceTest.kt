@@ -93,4 +93,41 @@ class TypefaceTest {
         assertEquals("Inter", interV.familyName)
     }
 
-}
\ No newline at end of file
+    @Test
+    fun variationInstancesAreShared() = runTest {
+        val interV = Typeface.makeFromResource("./fonts/Inter-V.ttf")
+        Typeface.setVariationQuantization("wght", 10f)
+        try {
+            val hitsBefore = Typeface.variationCacheStats.hits
+            val inter500 = interV.makeClone(FontVariation("wght", 500f))
+            val inter503 = interV.makeClone(FontVariation("wght", 503f))
+            assertEquals(inter500.uniqueId, inter503.uniqueId)
+            assertContentEquals(FontVariation.parse("wght=500 slnt=0"), inter503.variations)
+            assertTrue(Typeface.variationCacheStats.hits > hitsBefore)
+
+            val inter600 = interV.makeClone(FontVariation("wght", 600f))
+            assertNotEquals(inter500.uniqueId, inter600.uniqueId)
+        } finally {
+            Typeface.setVariationQuantization("wght", 0f)
+        }
+    }
+
+    @Test
+    fun variationQuantizationIsPerAxis() = runTest {
+        // Inter-V has wght in 100..900 and slnt in -10..0
+        val interV = Typeface.makeFromResource("./fonts/Inter-V.ttf")
+        Typeface.setVariationQuantization("wght", 10f)
+        Typeface.setVariationQuantization("slnt", 20f)
+        try {
+            val unlisted = interV.makeClone(arrayOf(FontVariation("wght", 503f), FontVariation("slnt", -4f)))
+            assertContentEquals(FontVariation.parse("wght=500 slnt=-4"), unlisted.variations)
+
+            Typeface.setVariationQuantization("slnt", 5f)
+            val quantized = interV.makeClone(arrayOf(FontVariation("wght", 497f), FontVariation("slnt", -4f)))
+            assertContentEquals(FontVariation.parse("wght=500 slnt=-5"), quantized.variations)
+        } finally {
+            Typeface.setVariationQuantization("wght", 0f)
+            Typeface.setVariationQuantization("slnt", 0f)
+        }
+    }
+}
@@ -3,6 +3,7 @@
 #include "SkPixelRef.h"
 #include "SkSamplingOptions.h"
 #include "SkShader.h"
+#include "PixelConverter.hh"
 #include "interop.hh"
 
 static void deleteBitmap(SkBitmap* instance) {
@@ -147,6 +148,13 @@ extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_BitmapKt__1nInstal
     return instance->installPixels(imageInfo, pixels, rowBytes, deleteJBytes, nullptr);
 }
 
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_BitmapKt__1nInstallPixelsFromPixmap
+  (JNIEnv* env, jclass jclass, jlong ptr, jlong pixmapPtr) {
+    SkBitmap* instance = reinterpret_cast<SkBitmap*>(static_cast<uintptr_t>(ptr));
+    SkPixmap* pixmap = reinterpret_cast<SkPixmap*>(static_cast<uintptr_t>(pixmapPtr));
+    return instance->installPixels(*pixmap);
+}
+
 extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_BitmapKt__1nAllocPixels
   (JNIEnv* env, jclass jclass, jlong ptr) {
     SkBitmap* instance = reinterpret_cast<SkBitmap*>(static_cast<uintptr_t>(ptr));
@@ -227,8 +235,6 @@ extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_BitmapKt__1nExtrac
 // returns true if readBytes array contains successfully read bytes. returns false otherwise
 extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_BitmapKt__1nReadPixels
   (JNIEnv* env, jclass jclass, jlong ptr, jint width, jint height, jint colorType, jint alphaType, jlong colorSpacePtr, jint rowBytes, jint srcX, jint srcY, jbyteArray readBytes) {
-    jbyte *result_bytes = env->GetByteArrayElements(readBytes, NULL);
-
     SkBitmap* instance = reinterpret_cast<SkBitmap*>(static_cast<uintptr_t>(ptr));
     SkColorSpace* colorSpace = reinterpret_cast<SkColorSpace*>(static_cast<uintptr_t>(colorSpacePtr));
     SkImageInfo imageInfo = SkImageInfo::Make(width,
@@ -236,11 +242,34 @@ extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_BitmapKt__1nReadPi
                                               static_cast<SkColorType>(colorType),
                                               static_cast<SkAlphaType>(alphaType),
                                               sk_ref_sp<SkColorSpace>(colorSpace));
-    jboolean result = instance->readPixels(imageInfo, result_bytes, rowBytes, srcX, srcY);
-    env->ReleaseByteArrayElements(readBytes, result_bytes, 0);
+    // Critical access pins the array instead of copying it in and out around readPixels
+    void* resultBytes = env->GetPrimitiveArrayCritical(readBytes, 0);
+    jboolean result = instance->readPixels(imageInfo, resultBytes, rowBytes, srcX, srcY);
+    env->ReleasePrimitiveArrayCritical(readBytes, resultBytes, result ? 0 : JNI_ABORT);
     return result;
 }
 
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_BitmapKt__1nReadPixelsToPixmap
+  (JNIEnv* env, jclass jclass, jlong ptr, jlong pixmapPtr, jint srcX, jint srcY) {
+    SkBitmap* instance = reinterpret_cast<SkBitmap*>(static_cast<uintptr_t>(ptr));
+    SkPixmap* pixmap = reinterpret_cast<SkPixmap*>(static_cast<uintptr_t>(pixmapPtr));
+    return instance->readPixels(*pixmap, srcX, srcY);
+}
+
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_BitmapKt__1nWritePixelsFromPixmap
+  (JNIEnv* env, jclass jclass, jlong ptr, jlong pixmapPtr, jint dstX, jint dstY) {
+    SkBitmap* instance = reinterpret_cast<SkBitmap*>(static_cast<uintptr_t>(ptr));
+    SkPixmap* pixmap = reinterpret_cast<SkPixmap*>(static_cast<uintptr_t>(pixmapPtr));
+    return instance->writePixels(*pixmap, dstX, dstY);
+}
+
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_BitmapKt__1nConvertPixels
+  (JNIEnv* env, jclass jclass, jlong ptr, jlong pixmapPtr) {
+    SkBitmap* instance = reinterpret_cast<SkBitmap*>(static_cast<uintptr_t>(ptr));
+    SkPixmap* pixmap = reinterpret_cast<SkPixmap*>(static_cast<uintptr_t>(pixmapPtr));
+    return skikoMpp::pixels::convert(instance->pixmap(), *pixmap);
+}
+
 extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_BitmapKt__1nExtractAlpha
   (JNIEnv* env, jclass jclass, jlong ptr, jlong dstPtr, jlong paintPtr, jintArray resultPoint) {
     SkBitmap* instance = reinterpret_cast<SkBitmap*>(static_cast<uintptr_t>(ptr));
@@ -1,9 +1,14 @@
 #include <iostream>
 #include <jni.h>
 #include "SkCanvas.h"
+#include "SkFont.h"
+#include "SkPixmap.h"
 #include "SkRRect.h"
+#include "SkRSXform.h"
 #include "SkTextBlob.h"
 #include "SkVertices.h"
+#include "BatchedDraws.hh"
+#include "VerticesBuffer.hh"
 #include "hb.h"
 #include "interop.hh"
 
@@ -87,6 +92,42 @@ extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_CanvasKt__1nDrawDRRect
         skija::RRect::toSkRRect(env, il, it, ir, ib, ijradii), *paint);
 }
 
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_CanvasKt__1nDrawRects
+  (JNIEnv* env, jclass jclass, jlong canvasPtr, jfloatArray rectsArr, jintArray colorsArr, jint count, jlong paintPtr) {
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(static_cast<uintptr_t>(canvasPtr));
+    SkPaint* paint = reinterpret_cast<SkPaint*>(static_cast<uintptr_t>(paintPtr));
+    jfloat* rects = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(rectsArr, 0));
+    jint* colors = colorsArr == nullptr ? nullptr : static_cast<jint*>(env->GetPrimitiveArrayCritical(colorsArr, 0));
+    skikoMpp::batch::drawRects(canvas, rects, reinterpret_cast<SkColor*>(colors), count, *paint);
+    if (colors != nullptr)
+        env->ReleasePrimitiveArrayCritical(colorsArr, colors, JNI_ABORT);
+    env->ReleasePrimitiveArrayCritical(rectsArr, rects, JNI_ABORT);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_CanvasKt__1nDrawRRects
+  (JNIEnv* env, jclass jclass, jlong canvasPtr, jfloatArray rrectsArr, jintArray colorsArr, jint count, jlong paintPtr) {
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(static_cast<uintptr_t>(canvasPtr));
+    SkPaint* paint = reinterpret_cast<SkPaint*>(static_cast<uintptr_t>(paintPtr));
+    jfloat* rrects = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(rrectsArr, 0));
+    jint* colors = colorsArr == nullptr ? nullptr : static_cast<jint*>(env->GetPrimitiveArrayCritical(colorsArr, 0));
+    skikoMpp::batch::drawRRects(canvas, rrects, reinterpret_cast<SkColor*>(colors), count, *paint);
+    if (colors != nullptr)
+        env->ReleasePrimitiveArrayCritical(colorsArr, colors, JNI_ABORT);
+    env->ReleasePrimitiveArrayCritical(rrectsArr, rrects, JNI_ABORT);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_CanvasKt__1nDrawCircles
+  (JNIEnv* env, jclass jclass, jlong canvasPtr, jfloatArray circlesArr, jintArray colorsArr, jint count, jlong paintPtr) {
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(static_cast<uintptr_t>(canvasPtr));
+    SkPaint* paint = reinterpret_cast<SkPaint*>(static_cast<uintptr_t>(paintPtr));
+    jfloat* circles = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(circlesArr, 0));
+    jint* colors = colorsArr == nullptr ? nullptr : static_cast<jint*>(env->GetPrimitiveArrayCritical(colorsArr, 0));
+    skikoMpp::batch::drawCircles(canvas, circles, reinterpret_cast<SkColor*>(colors), count, *paint);
+    if (colors != nullptr)
+        env->ReleasePrimitiveArrayCritical(colorsArr, colors, JNI_ABORT);
+    env->ReleasePrimitiveArrayCritical(circlesArr, circles, JNI_ABORT);
+}
+
 extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_CanvasKt__1nDrawPath
   (JNIEnv* env, jclass jclass, jlong canvasPtr, jlong pathPtr, jlong paintPtr) {
     SkCanvas* canvas = reinterpret_cast<SkCanvas*>(static_cast<uintptr_t>(canvasPtr));
@@ -106,6 +147,35 @@ extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_CanvasKt__1nDrawImageR
     canvas->drawImageRect(image, src, dst, skija::SamplingMode::unpackFrom2Ints(env, samplingModeVal1, samplingModeVal2), paint, constraint);
 }
 
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_CanvasKt__1nDrawAtlas
+  (JNIEnv* env, jclass jclass, jlong canvasPtr, jlong imagePtr, jfloatArray xformsArr, jfloatArray texRectsArr, jintArray colorsArr, jint count, jint blendMode, jint samplingModeVal1, jint samplingModeVal2, jfloatArray cullRectArr, jlong paintPtr) {
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(static_cast<uintptr_t>(canvasPtr));
+    SkImage* image = reinterpret_cast<SkImage*>(static_cast<uintptr_t>(imagePtr));
+    SkPaint* paint = reinterpret_cast<SkPaint*>(static_cast<uintptr_t>(paintPtr));
+    SkSamplingOptions sampling = skija::SamplingMode::unpackFrom2Ints(env, samplingModeVal1, samplingModeVal2);
+    SkRect cullRect;
+    if (cullRectArr != nullptr)
+        env->GetFloatArrayRegion(cullRectArr, 0, 4, reinterpret_cast<jfloat*>(&cullRect));
+
+    // SkRSXform and SkRect are both 4 packed floats, arrays are passed to Skia as is
+    jfloat* xforms = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(xformsArr, 0));
+    jfloat* texRects = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(texRectsArr, 0));
+    jint* colors = colorsArr == nullptr ? nullptr : static_cast<jint*>(env->GetPrimitiveArrayCritical(colorsArr, 0));
+    canvas->drawAtlas(image,
+                      reinterpret_cast<const SkRSXform*>(xforms),
+                      reinterpret_cast<const SkRect*>(texRects),
+                      reinterpret_cast<const SkColor*>(colors),
+                      count,
+                      static_cast<SkBlendMode>(blendMode),
+                      sampling,
+                      cullRectArr == nullptr ? nullptr : &cullRect,
+                      paint);
+    if (colors != nullptr)
+        env->ReleasePrimitiveArrayCritical(colorsArr, colors, JNI_ABORT);
+    env->ReleasePrimitiveArrayCritical(texRectsArr, texRects, JNI_ABORT);
+    env->ReleasePrimitiveArrayCritical(xformsArr, xforms, JNI_ABORT);
+}
+
 extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_CanvasKt__1nDrawImageNine
   (JNIEnv* env, jclass jclass, jlong canvasPtr, jlong imagePtr, jint cl, jint ct, jint cr, jint cb, jfloat dl, jfloat dt, jfloat dr, jfloat db, jint filterMode, jlong paintPtr) {
     SkCanvas* canvas = reinterpret_cast<SkCanvas*>(static_cast<uintptr_t>(canvasPtr));
@@ -144,6 +214,25 @@ extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_CanvasKt__1nDrawTextBl
     canvas->drawTextBlob(blob, x, y, *paint);
 }
 
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_CanvasKt__1nDrawGlyphRuns
+  (JNIEnv* env, jclass jclass, jlong canvasPtr, jlong fontPtr, jshortArray glyphsArr, jfloatArray positionsArr, jint glyphCount, jintArray runOffsetsArr, jfloatArray originsArr, jint runCount, jlong paintPtr) {
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(static_cast<uintptr_t>(canvasPtr));
+    SkFont* font = reinterpret_cast<SkFont*>(static_cast<uintptr_t>(fontPtr));
+    SkPaint* paint = reinterpret_cast<SkPaint*>(static_cast<uintptr_t>(paintPtr));
+    jshort* glyphs = static_cast<jshort*>(env->GetPrimitiveArrayCritical(glyphsArr, 0));
+    jfloat* positions = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(positionsArr, 0));
+    jint* runOffsets = static_cast<jint*>(env->GetPrimitiveArrayCritical(runOffsetsArr, 0));
+    jfloat* origins = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(originsArr, 0));
+    sk_sp<SkTextBlob> blob = skikoMpp::batch::makeGlyphRuns(*font, reinterpret_cast<SkGlyphID*>(glyphs), positions, glyphCount, runOffsets, origins, runCount);
+    env->ReleasePrimitiveArrayCritical(originsArr, origins, JNI_ABORT);
+    env->ReleasePrimitiveArrayCritical(runOffsetsArr, runOffsets, JNI_ABORT);
+    env->ReleasePrimitiveArrayCritical(positionsArr, positions, JNI_ABORT);
+    env->ReleasePrimitiveArrayCritical(glyphsArr, glyphs, JNI_ABORT);
+    // Drawing takes glyph cache locks, so it happens outside of the critical section
+    if (blob)
+        canvas->drawTextBlob(blob, 0, 0, *paint);
+}
+
 extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_CanvasKt__1nDrawPicture
   (JNIEnv* env, jclass jclass, jlong ptr, jlong picturePtr, jfloatArray matrixArr, jlong paintPtr) {
     SkCanvas* canvas   = reinterpret_cast<SkCanvas*>   (static_cast<uintptr_t>(ptr));
@@ -154,30 +243,40 @@ extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_CanvasKt__1nDrawPictur
 }
 
 extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_CanvasKt__1nDrawVertices
-  (JNIEnv* env, jclass jclass, jlong ptr, jint verticesMode, jint _vertexCount, jfloatArray positionsArr, jintArray colorsArr, jfloatArray texCoordsArr, jint _indexCount, jshortArray indexArr, jint blendMode, jlong paintPtr) {
+  (JNIEnv* env, jclass jclass, jlong ptr, jint verticesMode, jint vertexCount, jfloatArray positionsArr, jintArray colorsArr, jfloatArray texCoordsArr, jint indexCount, jshortArray indexArr, jint blendMode, jlong paintPtr) {
     SkCanvas* canvas = reinterpret_cast<SkCanvas*>   (static_cast<uintptr_t>(ptr));
-    int indexCount = indexArr == nullptr ? 0 : env->GetArrayLength(indexArr);
-    jfloat* positions = env->GetFloatArrayElements(positionsArr, 0);
-    jint*   colors    = colorsArr == nullptr ? nullptr : env->GetIntArrayElements(colorsArr, 0);
-    jfloat* texCoords = texCoordsArr == nullptr ? nullptr : env->GetFloatArrayElements(texCoordsArr, 0);
-    const jshort* indices = indexArr == nullptr ? nullptr : env->GetShortArrayElements(indexArr, 0);
+    SkPaint* paint = reinterpret_cast<SkPaint*>(static_cast<uintptr_t>(paintPtr));
+    // Arrays are pinned rather than copied, MakeCopy is the only copy of vertex data
+    jfloat* positions = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(positionsArr, 0));
+    jint*   colors    = colorsArr == nullptr ? nullptr : static_cast<jint*>(env->GetPrimitiveArrayCritical(colorsArr, 0));
+    jfloat* texCoords = texCoordsArr == nullptr ? nullptr : static_cast<jfloat*>(env->GetPrimitiveArrayCritical(texCoordsArr, 0));
+    jshort* indices   = indexArr == nullptr ? nullptr : static_cast<jshort*>(env->GetPrimitiveArrayCritical(indexArr, 0));
     sk_sp<SkVertices> vertices = SkVertices::MakeCopy(
         static_cast<SkVertices::VertexMode>(verticesMode),
-        env->GetArrayLength(positionsArr) / 2,
+        vertexCount,
         reinterpret_cast<SkPoint*>(positions),
         reinterpret_cast<SkPoint*>(texCoords),
         reinterpret_cast<SkColor*>(colors),
-        indexCount,
+        indices == nullptr ? 0 : indexCount,
         reinterpret_cast<const uint16_t *>(indices));
-    SkPaint* paint = reinterpret_cast<SkPaint*>(static_cast<uintptr_t>(paintPtr));
-
-    canvas->drawVertices(vertices, static_cast<SkBlendMode>(blendMode), *paint);
 
+    if (indices != nullptr)
+        env->ReleasePrimitiveArrayCritical(indexArr, indices, JNI_ABORT);
     if (texCoords != nullptr)
-        env->ReleaseFloatArrayElements(texCoordsArr, texCoords, 0);
+        env->ReleasePrimitiveArrayCritical(texCoordsArr, texCoords, JNI_ABORT);
     if (colors != nullptr)
-        env->ReleaseIntArrayElements(colorsArr, colors, 0);
-    env->ReleaseFloatArrayElements(positionsArr, positions, 0);
+        env->ReleasePrimitiveArrayCritical(colorsArr, colors, JNI_ABORT);
+    env->ReleasePrimitiveArrayCritical(positionsArr, positions, JNI_ABORT);
+
+    canvas->drawVertices(vertices, static_cast<SkBlendMode>(blendMode), *paint);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_CanvasKt__1nDrawVerticesObject
+  (JNIEnv* env, jclass jclass, jlong ptr, jlong verticesPtr, jint blendMode, jlong paintPtr) {
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(static_cast<uintptr_t>(ptr));
+    VerticesBuffer* vertices = reinterpret_cast<VerticesBuffer*>(static_cast<uintptr_t>(verticesPtr));
+    SkPaint* paint = reinterpret_cast<SkPaint*>(static_cast<uintptr_t>(paintPtr));
+    canvas->drawVertices(vertices->vertices(), static_cast<SkBlendMode>(blendMode), *paint);
 }
 
 extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_CanvasKt__1nDrawPatch
@@ -292,6 +391,20 @@ extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_CanvasKt__1nWritePixel
     return canvas->writePixels(*bitmap, x, y);
 }
 
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_CanvasKt__1nReadPixelsToPixmap
+  (JNIEnv* env, jclass jclass, jlong ptr, jlong pixmapPtr, jint srcX, jint srcY) {
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(static_cast<uintptr_t>(ptr));
+    SkPixmap* pixmap = reinterpret_cast<SkPixmap*>(static_cast<uintptr_t>(pixmapPtr));
+    return canvas->readPixels(*pixmap, srcX, srcY);
+}
+
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_CanvasKt__1nWritePixelsFromPixmap
+  (JNIEnv* env, jclass jclass, jlong ptr, jlong pixmapPtr, jint x, jint y) {
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(static_cast<uintptr_t>(ptr));
+    SkPixmap* pixmap = reinterpret_cast<SkPixmap*>(static_cast<uintptr_t>(pixmapPtr));
+    return canvas->writePixels(pixmap->info(), pixmap->addr(), pixmap->rowBytes(), x, y);
+}
+
 extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_CanvasKt__1nSave(JNIEnv* env, jclass jclass, jlong ptr) {
     return reinterpret_cast<SkCanvas*>(static_cast<uintptr_t>(ptr))->save();
 }
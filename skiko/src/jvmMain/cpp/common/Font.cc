@@ -1,8 +1,10 @@
 #include <iostream>
+#include <vector>
 #include <jni.h>
 #include "SkFont.h"
 #include "SkPath.h"
 #include "SkShaper.h"
+#include "GlyphPathCache.hh"
 #include "interop.hh"
 
 static void deleteFont(SkFont* font) {
@@ -305,32 +307,73 @@ extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_FontKt__1nGetXPosition
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_FontKt__1nGetPath
   (JNIEnv* env, jclass jclass, jlong ptr, jshort glyph) {
     SkFont* instance = reinterpret_cast<SkFont*>(static_cast<uintptr_t>(ptr));
-    SkPath* path = new SkPath();
-    instance->getPath(glyph, path);
-    return reinterpret_cast<jlong>(path);
+    SkGlyphID glyphID = static_cast<SkGlyphID>(glyph);
+    std::vector<SkPath> paths;
+    std::vector<bool> hasPath;
+    GlyphPathCache::Get().getPaths(*instance, &glyphID, 1, false, &paths, &hasPath);
+    return reinterpret_cast<jlong>(new SkPath(paths[0]));
 }
 
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_FontKt__1nGetPaths
-  (JNIEnv* env, jclass jclass, jlong ptr, jshortArray glyphsArr, jint count) {
+  (JNIEnv* env, jclass jclass, jlong ptr, jshortArray glyphsArr, jint count, jboolean parallel) {
     SkFont* instance = reinterpret_cast<SkFont*>(static_cast<uintptr_t>(ptr));
+    std::vector<SkGlyphID> glyphs(count);
+    env->GetShortArrayRegion(glyphsArr, 0, count, reinterpret_cast<jshort*>(glyphs.data()));
 
-    jshort* glyphs = env->GetShortArrayElements(glyphsArr, nullptr);
+    std::vector<SkPath> paths;
+    std::vector<bool> hasPath;
+    GlyphPathCache::Get().getPaths(*instance, glyphs.data(), count, parallel, &paths, &hasPath);
 
-    struct Ctx {
-        std::vector<jlong>* paths;
-    } ctx = { new std::vector<jlong>() };
+    std::vector<jlong>* result = new std::vector<jlong>();
+    for (int i = 0; i < count; ++i) {
+        // Copies share point data with the cache until either side is modified
+        if (hasPath[i])
+            result->push_back(reinterpret_cast<jlong>(new SkPath(paths[i])));
+    }
+    return reinterpret_cast<jlong>(result);
+}
 
-    instance->getPaths(reinterpret_cast<SkGlyphID*>(glyphs), count, [](const SkPath* orig, const SkMatrix& mx, void* voidCtx) {
-        Ctx* ctx = static_cast<Ctx*>(voidCtx);
-        if (orig) {
-            SkPath* path = new SkPath();
-            orig->transform(mx, path);
-            ctx->paths->push_back(reinterpret_cast<jlong>(path));
-        }
-    }, &ctx);
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_FontKt__1nGetPathsCombined
+  (JNIEnv* env, jclass jclass, jlong ptr, jshortArray glyphsArr, jint count, jfloatArray positionsArr, jboolean parallel, jintArray verbOffsetsArr) {
+    SkFont* instance = reinterpret_cast<SkFont*>(static_cast<uintptr_t>(ptr));
+    std::vector<SkGlyphID> glyphs(count);
+    env->GetShortArrayRegion(glyphsArr, 0, count, reinterpret_cast<jshort*>(glyphs.data()));
+    std::vector<float> positions;
+    if (positionsArr != nullptr) {
+        positions.resize(count * 2);
+        env->GetFloatArrayRegion(positionsArr, 0, count * 2, positions.data());
+    }
 
-    env->ReleaseShortArrayElements(glyphsArr, glyphs, 0);
-    return reinterpret_cast<jlong>(ctx.paths);
+    SkPath* path = new SkPath();
+    std::vector<jint> verbOffsets(count + 1);
+    GlyphPathCache::Get().getCombinedPath(*instance, glyphs.data(), count, positionsArr == nullptr ? nullptr : positions.data(),
+                                          parallel, path, verbOffsets.data());
+    env->SetIntArrayRegion(verbOffsetsArr, 0, count + 1, verbOffsets.data());
+    return reinterpret_cast<jlong>(path);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_FontKt__1nGetPathCacheStats
+  (JNIEnv* env, jclass jclass, jintArray resultArray) {
+    GlyphPathCache::Stats stats = GlyphPathCache::Get().getStats();
+    jint result[6] = {
+        stats.fHits,
+        stats.fMisses,
+        stats.fEvictions,
+        stats.fCount,
+        static_cast<jint>(stats.fBytesUsed),
+        static_cast<jint>(stats.fByteBudget)
+    };
+    env->SetIntArrayRegion(resultArray, 0, 6, result);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_FontKt__1nSetPathCacheByteBudget
+  (JNIEnv* env, jclass jclass, jint byteBudget) {
+    GlyphPathCache::Get().setByteBudget(byteBudget);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_FontKt__1nPurgePathCache
+  (JNIEnv* env, jclass jclass) {
+    GlyphPathCache::Get().purgeAll();
 }
 
 extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_FontKt__1nGetMetrics
@@ -4,6 +4,7 @@
 #include "SkData.h"
 #include "SkTypeface.h"
 #include "SkFontMgr.h"
+#include "FontIndex.hh"
 
 extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_FontMgrKt__1nGetFamiliesCount
   (JNIEnv* env, jclass jclass, jlong ptr) {
@@ -68,6 +69,16 @@ extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_FontMgrKt__1nMakeFrom
 
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_FontMgrKt__1nDefault
   (JNIEnv* env, jclass jclass) {
-    SkFontMgr* instance = SkFontMgr::RefDefault().release();
+    SkFontMgr* instance = FontIndex::Default().release();
     return reinterpret_cast<jlong>(instance);
+}
+
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_FontMgrKt__1nLoadIndex
+  (JNIEnv* env, jclass jclass, jstring pathStr) {
+    return FontIndex::Default()->load(skString(env, pathStr).c_str());
+}
+
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_FontMgrKt__1nSaveIndex
+  (JNIEnv* env, jclass jclass, jstring pathStr) {
+    return FontIndex::Default()->save(skString(env, pathStr).c_str());
 }
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include <jni.h>
+#include "SkCanvas.h"
+#include "SkPicture.h"
+#include "FrameCapture.hh"
+#include "interop.hh"
+
+static void deleteFrameCapture(FrameCapture* instance) {
+    delete instance;
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_FrameCaptureKt_FrameCapture_1nGetFinalizer
+  (JNIEnv* env, jclass jclass) {
+    return static_cast<jlong>(reinterpret_cast<uintptr_t>(&deleteFrameCapture));
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_FrameCaptureKt_FrameCapture_1nMake
+  (JNIEnv* env, jclass jclass) {
+    FrameCapture* instance = new FrameCapture();
+    return reinterpret_cast<jlong>(instance);
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_FrameCaptureKt__1nBeginCapture
+  (JNIEnv* env, jclass jclass, jlong ptr, jlong canvasPtr, jfloat left, jfloat top, jfloat right, jfloat bottom) {
+    FrameCapture* instance = reinterpret_cast<FrameCapture*>(static_cast<uintptr_t>(ptr));
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(static_cast<uintptr_t>(canvasPtr));
+    return reinterpret_cast<jlong>(instance->beginCapture(canvas, SkRect::MakeLTRB(left, top, right, bottom)));
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_FrameCaptureKt__1nFinishCapture
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    FrameCapture* instance = reinterpret_cast<FrameCapture*>(static_cast<uintptr_t>(ptr));
+    return reinterpret_cast<jlong>(instance->finishCapture().release());
+}
+
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_FrameCaptureKt__1nIsCapturing
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    FrameCapture* instance = reinterpret_cast<FrameCapture*>(static_cast<uintptr_t>(ptr));
+    return instance->isCapturing();
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_FrameCaptureKt__1nSerialize
+  (JNIEnv* env, jclass jclass, jlong picturePtr) {
+    SkPicture* picture = reinterpret_cast<SkPicture*>(static_cast<uintptr_t>(picturePtr));
+    return reinterpret_cast<jlong>(FrameCapture::Serialize(picture).release());
+}
@@ -2,6 +2,8 @@
 #include <jni.h>
 #include "SkData.h"
 #include "SkImage.h"
+#include "SkStream.h"
+#include "ImageEncoder.hh"
 #include "interop.hh"
 
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_ImageKt__1nMakeRaster
@@ -73,6 +75,13 @@ extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_ImageKt__1nEncodeToDa
     return reinterpret_cast<jlong>(data);
 }
 
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_ImageKt__1nEncodeToStream
+  (JNIEnv* env, jclass jclass, jlong ptr, jlong wstreamPtr, jint format, jint quality, jint preset) {
+    SkImage* instance = reinterpret_cast<SkImage*>(static_cast<uintptr_t>(ptr));
+    SkWStream* wstream = reinterpret_cast<SkWStream*>(static_cast<uintptr_t>(wstreamPtr));
+    return skikoMpp::encoder::encode(wstream, instance, static_cast<SkEncodedImageFormat>(format), quality, static_cast<skikoMpp::encoder::Preset>(preset));
+}
+
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_ImageKt_Image_1nMakeShader
   (JNIEnv* env, jclass jclass, jlong ptr, jint tmx, jint tmy, jint samplingVal1, jint samplingVal2, jfloatArray localMatrixArr) {
     SkImage* instance = reinterpret_cast<SkImage*>(static_cast<uintptr_t>(ptr));
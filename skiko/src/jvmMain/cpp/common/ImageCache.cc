@@ -0,0 +1,71 @@
+#include <jni.h>
+#include "SkData.h"
+#include "SkImage.h"
+#include "ImageCache.hh"
+#include "interop.hh"
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_ImageCacheKt_ImageCache_1nMake
+  (JNIEnv* env, jclass jclass, jint byteBudget) {
+    ImageCache* instance = new ImageCache(static_cast<size_t>(byteBudget));
+    return reinterpret_cast<jlong>(instance);
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_ImageCacheKt__1nFindOrDecode
+  (JNIEnv* env, jclass jclass, jlong ptr, jlong dataPtr, jint width, jint height, jint colorType) {
+    ImageCache* instance = reinterpret_cast<ImageCache*>(static_cast<uintptr_t>(ptr));
+    SkData* data = reinterpret_cast<SkData*>(static_cast<uintptr_t>(dataPtr));
+    sk_sp<SkImage> image = instance->findOrDecode(sk_ref_sp(data), width, height, static_cast<SkColorType>(colorType));
+    return reinterpret_cast<jlong>(image.release());
+}
+
+extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_ImageCacheKt__1nGetByteBudget
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    ImageCache* instance = reinterpret_cast<ImageCache*>(static_cast<uintptr_t>(ptr));
+    return static_cast<jint>(instance->getByteBudget());
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_ImageCacheKt__1nSetByteBudget
+  (JNIEnv* env, jclass jclass, jlong ptr, jint byteBudget) {
+    ImageCache* instance = reinterpret_cast<ImageCache*>(static_cast<uintptr_t>(ptr));
+    instance->setByteBudget(static_cast<size_t>(byteBudget));
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_ImageCacheKt__1nPurgeToBytes
+  (JNIEnv* env, jclass jclass, jlong ptr, jint targetBytes) {
+    ImageCache* instance = reinterpret_cast<ImageCache*>(static_cast<uintptr_t>(ptr));
+    instance->purgeToBytes(static_cast<size_t>(targetBytes));
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_ImageCacheKt__1nPurgeAll
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    ImageCache* instance = reinterpret_cast<ImageCache*>(static_cast<uintptr_t>(ptr));
+    instance->purgeAll();
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_ImageCacheKt__1nOnMemoryPressure
+  (JNIEnv* env, jclass jclass, jlong ptr, jboolean critical) {
+    ImageCache* instance = reinterpret_cast<ImageCache*>(static_cast<uintptr_t>(ptr));
+    instance->onMemoryPressure(critical);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_ImageCacheKt__1nGetStats
+  (JNIEnv* env, jclass jclass, jlong ptr, jintArray statsArr) {
+    ImageCache* instance = reinterpret_cast<ImageCache*>(static_cast<uintptr_t>(ptr));
+    ImageCache::Stats stats = instance->getStats();
+    jint result[7] = {
+        stats.fHits,
+        stats.fMisses,
+        stats.fEvictions,
+        stats.fCount,
+        static_cast<jint>(stats.fBytesUsed),
+        static_cast<jint>(stats.fByteBudget),
+        stats.fGenerationID
+    };
+    env->SetIntArrayRegion(statsArr, 0, 7, result);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_ImageCacheKt__1nResetStats
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    ImageCache* instance = reinterpret_cast<ImageCache*>(static_cast<uintptr_t>(ptr));
+    instance->resetStats();
+}
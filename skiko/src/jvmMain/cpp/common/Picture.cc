@@ -4,11 +4,17 @@
 #include "SkData.h"
 #include "SkPicture.h"
 #include "SkShader.h"
+#include "PictureRasterizer.hh"
+#include "PictureResourceStore.hh"
 
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_PictureKt_Picture_1nMakeFromData
-  (JNIEnv* env, jclass jclass, jlong dataPtr) {
+  (JNIEnv* env, jclass jclass, jlong dataPtr, jlong storePtr) {
     SkData* data = reinterpret_cast<SkData*>(static_cast<uintptr_t>(dataPtr));
-    SkPicture* instance = SkPicture::MakeFromData(data).release();
+    PictureResourceStore* store = reinterpret_cast<PictureResourceStore*>(static_cast<uintptr_t>(storePtr));
+    SkDeserialProcs procs;
+    if (store)
+        procs = store->deserialProcs();
+    SkPicture* instance = SkPicture::MakeFromData(data, &procs).release();
     return reinterpret_cast<jlong>(instance);
 }
 
@@ -38,6 +44,14 @@ extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_PictureKt__1nPlayback
     }
 }
 
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_PictureKt__1nPlaybackTiled
+  (JNIEnv* env, jclass jclass, jlong ptr, jlong pixmapPtr, jfloatArray matrixArr, jint tileSize, jint maxThreads) {
+    SkPicture* instance = reinterpret_cast<SkPicture*>(static_cast<uintptr_t>(ptr));
+    SkPixmap* pixmap = reinterpret_cast<SkPixmap*>(static_cast<uintptr_t>(pixmapPtr));
+    std::unique_ptr<SkMatrix> matrix = skMatrix(env, matrixArr);
+    return skikoMpp::picture::rasterizeTiled(instance, *pixmap, matrix.get(), tileSize, maxThreads);
+}
+
 extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_PictureKt__1nGetCullRect
   (JNIEnv* env, jclass jclass, jlong ptr, jfloatArray ltrbArray) {
     SkPicture* instance = reinterpret_cast<SkPicture*>(static_cast<uintptr_t>(ptr));
@@ -52,9 +66,13 @@ extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_PictureKt__1nGetUnique
 }
 
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_PictureKt__1nSerializeToData
-  (JNIEnv* env, jclass jclass, jlong ptr) {
+  (JNIEnv* env, jclass jclass, jlong ptr, jlong storePtr) {
     SkPicture* instance = reinterpret_cast<SkPicture*>(static_cast<uintptr_t>(ptr));
-    SkData* data = instance->serialize().release();
+    PictureResourceStore* store = reinterpret_cast<PictureResourceStore*>(static_cast<uintptr_t>(storePtr));
+    SkSerialProcs procs;
+    if (store)
+        procs = store->serialProcs();
+    SkData* data = instance->serialize(&procs).release();
     return reinterpret_cast<jlong>(data);
 }
 
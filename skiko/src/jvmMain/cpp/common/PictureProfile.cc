@@ -0,0 +1,84 @@
+#include <jni.h>
+#include "SkPicture.h"
+#include "PictureProfile.hh"
+#include "interop.hh"
+
+static void deletePictureProfile(PictureProfile* instance) {
+    delete instance;
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_PictureProfileKt_PictureProfile_1nGetFinalizer
+  (JNIEnv* env, jclass jclass) {
+    return static_cast<jlong>(reinterpret_cast<uintptr_t>(&deletePictureProfile));
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_PictureProfileKt_PictureProfile_1nMake
+  (JNIEnv* env, jclass jclass, jlong picturePtr, jint width, jint height) {
+    SkPicture* picture = reinterpret_cast<SkPicture*>(static_cast<uintptr_t>(picturePtr));
+    PictureProfile* instance = new PictureProfile(picture, width, height);
+    return reinterpret_cast<jlong>(instance);
+}
+
+extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_PictureProfileKt__1nGetOpCount
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    PictureProfile* instance = reinterpret_cast<PictureProfile*>(static_cast<uintptr_t>(ptr));
+    return static_cast<jint>(instance->ops().size());
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_PictureProfileKt__1nGetOps
+  (JNIEnv* env, jclass jclass, jlong ptr, jintArray typesArr, jintArray boundsArr, jfloatArray microsArr) {
+    PictureProfile* instance = reinterpret_cast<PictureProfile*>(static_cast<uintptr_t>(ptr));
+    const std::vector<PictureProfile::Op>& ops = instance->ops();
+    jint* types = static_cast<jint*>(env->GetPrimitiveArrayCritical(typesArr, 0));
+    jint* bounds = static_cast<jint*>(env->GetPrimitiveArrayCritical(boundsArr, 0));
+    jfloat* micros = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(microsArr, 0));
+    for (size_t i = 0; i < ops.size(); ++i) {
+        types[i] = ops[i].fType;
+        bounds[i * 4 + 0] = ops[i].fBounds.left();
+        bounds[i * 4 + 1] = ops[i].fBounds.top();
+        bounds[i * 4 + 2] = ops[i].fBounds.right();
+        bounds[i * 4 + 3] = ops[i].fBounds.bottom();
+        micros[i] = ops[i].fNanos / 1000.0f;
+    }
+    env->ReleasePrimitiveArrayCritical(microsArr, micros, 0);
+    env->ReleasePrimitiveArrayCritical(boundsArr, bounds, 0);
+    env->ReleasePrimitiveArrayCritical(typesArr, types, 0);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_PictureProfileKt__1nGetHistogram
+  (JNIEnv* env, jclass jclass, jlong ptr, jintArray countsArr, jfloatArray microsArr) {
+    PictureProfile* instance = reinterpret_cast<PictureProfile*>(static_cast<uintptr_t>(ptr));
+    jint counts[PictureProfile::kOpTypeCount];
+    jfloat micros[PictureProfile::kOpTypeCount];
+    for (int i = 0; i < PictureProfile::kOpTypeCount; ++i) {
+        PictureProfile::OpType type = static_cast<PictureProfile::OpType>(i);
+        counts[i] = instance->count(type);
+        micros[i] = instance->nanos(type) / 1000.0f;
+    }
+    env->SetIntArrayRegion(countsArr, 0, PictureProfile::kOpTypeCount, counts);
+    env->SetFloatArrayRegion(microsArr, 0, PictureProfile::kOpTypeCount, micros);
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_PictureProfileKt__1nGetOverdraw
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    PictureProfile* instance = reinterpret_cast<PictureProfile*>(static_cast<uintptr_t>(ptr));
+    return reinterpret_cast<jlong>(new SkBitmap(instance->overdraw()));
+}
+
+extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_PictureProfileKt__1nGetMaxOverdraw
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    PictureProfile* instance = reinterpret_cast<PictureProfile*>(static_cast<uintptr_t>(ptr));
+    return instance->maxOverdraw();
+}
+
+extern "C" JNIEXPORT jfloat JNICALL Java_org_jetbrains_skia_PictureProfileKt__1nGetAverageOverdraw
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    PictureProfile* instance = reinterpret_cast<PictureProfile*>(static_cast<uintptr_t>(ptr));
+    return static_cast<jfloat>(instance->averageOverdraw());
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_PictureProfileKt__1nToJson
+  (JNIEnv* env, jclass jclass, jlong ptr, jboolean includeOps) {
+    PictureProfile* instance = reinterpret_cast<PictureProfile*>(static_cast<uintptr_t>(ptr));
+    return reinterpret_cast<jlong>(new SkString(instance->toJson(includeOps)));
+}
@@ -0,0 +1,36 @@
+#include <jni.h>
+#include "SkData.h"
+#include "PictureResourceStore.hh"
+#include "interop.hh"
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_PictureResourceStoreKt_PictureResourceStore_1nMake
+  (JNIEnv* env, jclass jclass) {
+    PictureResourceStore* instance = new PictureResourceStore();
+    return reinterpret_cast<jlong>(instance);
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_PictureResourceStoreKt_PictureResourceStore_1nMakeFromData
+  (JNIEnv* env, jclass jclass, jlong dataPtr) {
+    SkData* data = reinterpret_cast<SkData*>(static_cast<uintptr_t>(dataPtr));
+    return reinterpret_cast<jlong>(PictureResourceStore::MakeFromData(data).release());
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_PictureResourceStoreKt__1nSerializeToData
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    PictureResourceStore* instance = reinterpret_cast<PictureResourceStore*>(static_cast<uintptr_t>(ptr));
+    return reinterpret_cast<jlong>(instance->serialize().release());
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_PictureResourceStoreKt__1nGetStats
+  (JNIEnv* env, jclass jclass, jlong ptr, jintArray statsArr) {
+    PictureResourceStore* instance = reinterpret_cast<PictureResourceStore*>(static_cast<uintptr_t>(ptr));
+    PictureResourceStore::Stats stats = instance->getStats();
+    jint result[5] = {
+        stats.fTypefaces,
+        stats.fImages,
+        stats.fReferences,
+        static_cast<jint>(stats.fStoredBytes),
+        static_cast<jint>(stats.fReferencedBytes)
+    };
+    env->SetIntArrayRegion(statsArr, 0, 5, result);
+}
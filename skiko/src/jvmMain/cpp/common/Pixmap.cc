@@ -1,6 +1,7 @@
 #include <jni.h>
 #include "interop.hh"
 #include "SkPixmap.h"
+#include "PixelConverter.hh"
 
 static void deletePixmap(SkPixmap *pixmap) {
     delete pixmap;
@@ -163,6 +164,13 @@ extern "C" {
         return static_cast<jboolean>(pixmap->readPixels(*dstPixmap, srcX, srcY));
     }
 
+    JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_PixmapKt__1nConvertPixels
+      (JNIEnv *env, jclass klass, jlong ptr, jlong dstPixmapPtr) {
+        SkPixmap* pixmap = jlongToPtr<SkPixmap*>(ptr);
+        SkPixmap* dstPixmap = jlongToPtr<SkPixmap*>(dstPixmapPtr);
+        return static_cast<jboolean>(skikoMpp::pixels::convert(*pixmap, *dstPixmap));
+    }
+
     JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_PixmapKt__1nScalePixels
       (JNIEnv *env, jclass klass, jlong ptr, jlong dstPixmapPtr, jint samplingOptionsVal1, jint samplingOptionsVal2) {
         SkPixmap* pixmap = jlongToPtr<SkPixmap*>(ptr);
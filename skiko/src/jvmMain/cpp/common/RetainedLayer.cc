@@ -0,0 +1,99 @@
+#include <jni.h>
+#include "SkCanvas.h"
+#include "SkPaint.h"
+#include "RetainedLayer.hh"
+#include "interop.hh"
+
+static void deleteRetainedLayer(RetainedLayer* instance) {
+    delete instance;
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_RetainedLayerKt_RetainedLayer_1nGetFinalizer
+  (JNIEnv* env, jclass jclass) {
+    return static_cast<jlong>(reinterpret_cast<uintptr_t>(&deleteRetainedLayer));
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_RetainedLayerKt_RetainedLayer_1nMake
+  (JNIEnv* env, jclass jclass, jfloat left, jfloat top, jfloat right, jfloat bottom) {
+    RetainedLayer* instance = new RetainedLayer(SkRect::MakeLTRB(left, top, right, bottom));
+    return reinterpret_cast<jlong>(instance);
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_RetainedLayerKt__1nBeginRecording
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(static_cast<uintptr_t>(ptr));
+    return reinterpret_cast<jlong>(instance->beginRecording());
+}
+
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_RetainedLayerKt__1nFinishRecording
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(static_cast<uintptr_t>(ptr));
+    return instance->finishRecording();
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_RetainedLayerKt__1nInvalidate
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(static_cast<uintptr_t>(ptr));
+    instance->invalidate();
+}
+
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_RetainedLayerKt__1nIsDirty
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(static_cast<uintptr_t>(ptr));
+    return instance->isDirty();
+}
+
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_RetainedLayerKt__1nDraw
+  (JNIEnv* env, jclass jclass, jlong ptr, jlong canvasPtr, jlong paintPtr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(static_cast<uintptr_t>(ptr));
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(static_cast<uintptr_t>(canvasPtr));
+    SkPaint* paint = reinterpret_cast<SkPaint*>(static_cast<uintptr_t>(paintPtr));
+    return instance->draw(canvas, paint);
+}
+
+extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_RetainedLayerKt__1nGetRasterAfterReplays
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(static_cast<uintptr_t>(ptr));
+    return instance->getRasterAfterReplays();
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_RetainedLayerKt__1nSetRasterAfterReplays
+  (JNIEnv* env, jclass jclass, jlong ptr, jint replays) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(static_cast<uintptr_t>(ptr));
+    instance->setRasterAfterReplays(replays);
+}
+
+extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_RetainedLayerKt__1nGetRasterAboveOpCount
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(static_cast<uintptr_t>(ptr));
+    return instance->getRasterAboveOpCount();
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_RetainedLayerKt__1nSetRasterAboveOpCount
+  (JNIEnv* env, jclass jclass, jlong ptr, jint opCount) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(static_cast<uintptr_t>(ptr));
+    instance->setRasterAboveOpCount(opCount);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_RetainedLayerKt__1nGetStats
+  (JNIEnv* env, jclass jclass, jlong ptr, jintArray statsArr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(static_cast<uintptr_t>(ptr));
+    RetainedLayer::Stats stats = instance->getStats();
+    jint result[8] = {
+        stats.fDraws,
+        stats.fMisses,
+        stats.fRecordings,
+        stats.fRecordMicros,
+        stats.fRasterizations,
+        stats.fRasterDraws,
+        static_cast<jint>(stats.fPictureBytes),
+        static_cast<jint>(stats.fImageBytes)
+    };
+    env->SetIntArrayRegion(statsArr, 0, 8, result);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_RetainedLayerKt__1nResetStats
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(static_cast<uintptr_t>(ptr));
+    instance->resetStats();
+}
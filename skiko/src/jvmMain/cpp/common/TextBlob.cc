@@ -6,9 +6,13 @@
 #include "SkTextBlob.h"
 #include "interop.hh"
 #include "mppinterop.h"
+#include "TextBlobMetricsCache.hh"
 #include "RunRecordClone.hh"
 
 static void unrefTextBlob(SkTextBlob* ptr) {
+    // Blob dies with this reference, so its cached metrics can't be requested anymore
+    if (ptr->unique())
+        TextBlobMetricsCache::Get().remove(ptr->uniqueID());
     ptr->unref();
 }
 
@@ -203,3 +207,27 @@ extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_TextBlobKt__1nGetL
     env->ReleaseFloatArrayElements(resultArray, floats, 0);
     return hasValue;
 }
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_TextBlobKt__1nGetMetricsCacheStats
+  (JNIEnv* env, jclass jclass, jintArray resultArray) {
+    TextBlobMetricsCache::Stats stats = TextBlobMetricsCache::Get().getStats();
+    jint result[6] = {
+        stats.fHits,
+        stats.fMisses,
+        stats.fEvictions,
+        stats.fCount,
+        static_cast<jint>(stats.fBytesUsed),
+        static_cast<jint>(stats.fByteBudget)
+    };
+    env->SetIntArrayRegion(resultArray, 0, 6, result);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_TextBlobKt__1nSetMetricsCacheByteBudget
+  (JNIEnv* env, jclass jclass, jint byteBudget) {
+    TextBlobMetricsCache::Get().setByteBudget(byteBudget);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_TextBlobKt__1nPurgeMetricsCache
+  (JNIEnv* env, jclass jclass) {
+    TextBlobMetricsCache::Get().purgeAll();
+}
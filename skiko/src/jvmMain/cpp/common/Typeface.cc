@@ -2,6 +2,8 @@
 #include <jni.h>
 #include "SkData.h"
 #include "SkTypeface.h"
+#include "TypefaceCoverage.hh"
+#include "VariationCache.hh"
 #include "interop.hh"
 
 extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_TypefaceKt__1nGetFontStyle
@@ -100,22 +102,47 @@ extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_TypefaceKt__1nMakeFro
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_TypefaceKt__1nMakeClone
   (JNIEnv* env, jclass jclass, jlong typefacePtr, jintArray variationsArr, jint variationsCount, jint collectionIndex) {
     SkTypeface* typeface = reinterpret_cast<SkTypeface*>(static_cast<uintptr_t>(typefacePtr));
-    std::vector<SkFontArguments::VariationPosition::Coordinate> coordinates(variationsCount);
+    std::vector<SkFontArguments::VariationPosition::Coordinate> coordinates(variationsCount / 2);
     jint* variations = env->GetIntArrayElements(variationsArr, 0);
     for (int i=0; i < variationsCount; i+=2) {
-        coordinates[i] = {
+        coordinates[i / 2] = {
             static_cast<SkFourByteTag>(variations[i]),
             fromBits(variations[i+1])
         };
     }
-    env->ReleaseIntArrayElements(variationsArr, variations, 0);
-    SkFontArguments arg = SkFontArguments()
-                            .setCollectionIndex(collectionIndex)
-                            .setVariationDesignPosition({coordinates.data(), variationsCount});
-    SkTypeface* clone = typeface->makeClone(arg).release();
+    env->ReleaseIntArrayElements(variationsArr, variations, JNI_ABORT);
+    SkTypeface* clone = VariationCache::Get().makeClone(typeface, coordinates.data(), static_cast<int>(coordinates.size()), collectionIndex).release();
     return reinterpret_cast<jlong>(clone);
 }
 
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_TypefaceKt__1nGetVariationCacheStats
+  (JNIEnv* env, jclass jclass, jintArray resultArray) {
+    VariationCache::Stats stats = VariationCache::Get().getStats();
+    jint result[5] = {
+        stats.fHits,
+        stats.fMisses,
+        stats.fEvictions,
+        stats.fCount,
+        stats.fCapacity
+    };
+    env->SetIntArrayRegion(resultArray, 0, 5, result);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_TypefaceKt__1nSetVariationCacheCapacity
+  (JNIEnv* env, jclass jclass, jint capacity) {
+    VariationCache::Get().setCapacity(capacity);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_TypefaceKt__1nSetVariationQuantization
+  (JNIEnv* env, jclass jclass, jint axis, jfloat step) {
+    VariationCache::Get().setQuantization(static_cast<SkFourByteTag>(axis), step);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_TypefaceKt__1nPurgeVariationCache
+  (JNIEnv* env, jclass jclass) {
+    VariationCache::Get().purgeAll();
+}
+
 extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_TypefaceKt_Typeface_1nGetUTF32Glyphs
   (JNIEnv* env, jclass jclass, jlong ptr, jintArray uniArr, jint count, jshortArray res) {
     SkTypeface* instance = reinterpret_cast<SkTypeface*>(static_cast<uintptr_t>(ptr));
@@ -132,6 +159,27 @@ extern "C" JNIEXPORT jshort JNICALL Java_org_jetbrains_skia_TypefaceKt_Typeface_
     return instance->unicharToGlyph(uni);
 }
 
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_TypefaceKt__1nCovers
+  (JNIEnv* env, jclass jclass, jlong ptr, jint unichar) {
+    SkTypeface* instance = reinterpret_cast<SkTypeface*>(static_cast<uintptr_t>(ptr));
+    return TypefaceCoverage::Get(instance)->covers(unichar);
+}
+
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_TypefaceKt__1nCoversAll
+  (JNIEnv* env, jclass jclass, jlong ptr, jintArray uniArr, jint count) {
+    SkTypeface* instance = reinterpret_cast<SkTypeface*>(static_cast<uintptr_t>(ptr));
+    jint* uni = env->GetIntArrayElements(uniArr, nullptr);
+    bool result = TypefaceCoverage::Get(instance)->coversAll(reinterpret_cast<SkUnichar*>(uni), count);
+    env->ReleaseIntArrayElements(uniArr, uni, JNI_ABORT);
+    return result;
+}
+
+extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_TypefaceKt__1nGetCoveredCount
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    SkTypeface* instance = reinterpret_cast<SkTypeface*>(static_cast<uintptr_t>(ptr));
+    return TypefaceCoverage::Get(instance)->count();
+}
+
 extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_TypefaceKt__1nGetGlyphsCount
   (JNIEnv* env, jclass jclass, jlong ptr) {
     SkTypeface* instance = reinterpret_cast<SkTypeface*>(static_cast<uintptr_t>(ptr));
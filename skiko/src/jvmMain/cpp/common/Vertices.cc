@@ -0,0 +1,87 @@
+#include <jni.h>
+#include "SkVertices.h"
+#include "VerticesBuffer.hh"
+#include "interop.hh"
+
+static void deleteVertices(VerticesBuffer* instance) {
+    delete instance;
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_VerticesKt_Vertices_1nGetFinalizer
+  (JNIEnv* env, jclass jclass) {
+    return static_cast<jlong>(reinterpret_cast<uintptr_t>(&deleteVertices));
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_VerticesKt_Vertices_1nMake
+  (JNIEnv* env, jclass jclass, jint mode, jint vertexCount, jint indexCount, jboolean hasTexCoords, jboolean hasColors) {
+    std::unique_ptr<VerticesBuffer> instance = VerticesBuffer::Make(static_cast<SkVertices::VertexMode>(mode), vertexCount, indexCount, hasTexCoords, hasColors);
+    return reinterpret_cast<jlong>(instance.release());
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_VerticesKt__1nSetPositions
+  (JNIEnv* env, jclass jclass, jlong ptr, jfloatArray positionsArr, jint offset, jint count) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(static_cast<uintptr_t>(ptr));
+    jfloat* positions = env->GetFloatArrayElements(positionsArr, 0);
+    instance->setPositions(positions, offset, count);
+    env->ReleaseFloatArrayElements(positionsArr, positions, JNI_ABORT);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_VerticesKt__1nSetTexCoords
+  (JNIEnv* env, jclass jclass, jlong ptr, jfloatArray texCoordsArr, jint offset, jint count) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(static_cast<uintptr_t>(ptr));
+    jfloat* texCoords = env->GetFloatArrayElements(texCoordsArr, 0);
+    instance->setTexCoords(texCoords, offset, count);
+    env->ReleaseFloatArrayElements(texCoordsArr, texCoords, JNI_ABORT);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_VerticesKt__1nSetColors
+  (JNIEnv* env, jclass jclass, jlong ptr, jintArray colorsArr, jint offset, jint count) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(static_cast<uintptr_t>(ptr));
+    jint* colors = env->GetIntArrayElements(colorsArr, 0);
+    instance->setColors(reinterpret_cast<SkColor*>(colors), offset, count);
+    env->ReleaseIntArrayElements(colorsArr, colors, JNI_ABORT);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_VerticesKt__1nSetIndices
+  (JNIEnv* env, jclass jclass, jlong ptr, jshortArray indicesArr, jint offset, jint count) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(static_cast<uintptr_t>(ptr));
+    jshort* indices = env->GetShortArrayElements(indicesArr, 0);
+    instance->setIndices(reinterpret_cast<uint16_t*>(indices), offset, count);
+    env->ReleaseShortArrayElements(indicesArr, indices, JNI_ABORT);
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_VerticesKt__1nGetPositionsStorage
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(static_cast<uintptr_t>(ptr));
+    return reinterpret_cast<jlong>(instance->positionsStorage());
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_VerticesKt__1nGetTexCoordsStorage
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(static_cast<uintptr_t>(ptr));
+    return reinterpret_cast<jlong>(instance->texCoordsStorage());
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_VerticesKt__1nGetColorsStorage
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(static_cast<uintptr_t>(ptr));
+    return reinterpret_cast<jlong>(instance->colorsStorage());
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_VerticesKt__1nGetIndicesStorage
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(static_cast<uintptr_t>(ptr));
+    return reinterpret_cast<jlong>(instance->indicesStorage());
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_VerticesKt__1nMarkEdited
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(static_cast<uintptr_t>(ptr));
+    instance->markEdited();
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_VerticesKt__1nGetBounds
+  (JNIEnv* env, jclass jclass, jlong ptr, jfloatArray result) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(static_cast<uintptr_t>(ptr));
+    skija::Rect::copyToInterop(env, instance->bounds(), result);
+}
@@ -3,6 +3,7 @@
 #include "../interop.hh"
 #include "SkRefCnt.h"
 #include "FontCollection.h"
+#include "ParagraphCacheMonitor.hh"
 
 using namespace std;
 using namespace skia::textlayout;
@@ -10,6 +11,8 @@ using namespace skia::textlayout;
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_paragraph_FontCollectionKt__1nMake
   (JNIEnv* env, jclass jclass) {
     FontCollection* ptr = new FontCollection();
+    // Count cache hits and misses from the start
+    ParagraphCacheMonitor::Get(ptr->getParagraphCache());
     return reinterpret_cast<jlong>(ptr);
 }
 
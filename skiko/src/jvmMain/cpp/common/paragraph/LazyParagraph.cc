@@ -0,0 +1,101 @@
+#include <jni.h>
+#include "../interop.hh"
+#include "LazyParagraph.hh"
+
+using namespace skia::textlayout;
+
+static void deleteLazyParagraph(LazyParagraph* instance) {
+    delete instance;
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_paragraph_LazyParagraphKt_LazyParagraph_1nGetFinalizer
+  (JNIEnv* env, jclass jclass) {
+    return static_cast<jlong>(reinterpret_cast<uintptr_t>(&deleteLazyParagraph));
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_paragraph_LazyParagraphKt_LazyParagraph_1nMake
+  (JNIEnv* env, jclass jclass, jstring textStr, jlong paragraphStylePtr, jlong fontCollectionPtr) {
+    ParagraphStyle* paragraphStyle = reinterpret_cast<ParagraphStyle*>(static_cast<uintptr_t>(paragraphStylePtr));
+    FontCollection* fontCollection = reinterpret_cast<FontCollection*>(static_cast<uintptr_t>(fontCollectionPtr));
+    LazyParagraph* instance = new LazyParagraph(skString(env, textStr), *paragraphStyle, sk_ref_sp(fontCollection));
+    return reinterpret_cast<jlong>(instance);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_LazyParagraphKt__1nLayout
+  (JNIEnv* env, jclass jclass, jlong ptr, jfloat width) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(static_cast<uintptr_t>(ptr));
+    instance->layout(width);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_LazyParagraphKt__1nReplaceText
+  (JNIEnv* env, jclass jclass, jlong ptr, jint from, jint to, jstring text) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(static_cast<uintptr_t>(ptr));
+    instance->replaceText(from, to, skString(env, text));
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_LazyParagraphKt__1nLayoutUntil
+  (JNIEnv* env, jclass jclass, jlong ptr, jfloat y) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(static_cast<uintptr_t>(ptr));
+    instance->layoutUntil(y);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_LazyParagraphKt__1nLayoutUntilLine
+  (JNIEnv* env, jclass jclass, jlong ptr, jint line) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(static_cast<uintptr_t>(ptr));
+    instance->layoutUntilLine(line);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_LazyParagraphKt__1nLayoutAll
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(static_cast<uintptr_t>(ptr));
+    instance->layoutAll();
+}
+
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_paragraph_LazyParagraphKt__1nIsLaidOutCompletely
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(static_cast<uintptr_t>(ptr));
+    return instance->isLaidOutCompletely();
+}
+
+extern "C" JNIEXPORT jfloat JNICALL Java_org_jetbrains_skia_paragraph_LazyParagraphKt__1nGetLaidOutHeight
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(static_cast<uintptr_t>(ptr));
+    return instance->laidOutHeight();
+}
+
+extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_paragraph_LazyParagraphKt__1nGetLaidOutLineCount
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(static_cast<uintptr_t>(ptr));
+    return instance->laidOutLineCount();
+}
+
+extern "C" JNIEXPORT jfloat JNICALL Java_org_jetbrains_skia_paragraph_LazyParagraphKt__1nGetHeight
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(static_cast<uintptr_t>(ptr));
+    return instance->height();
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_LazyParagraphKt__1nPaint
+  (JNIEnv* env, jclass jclass, jlong ptr, jlong canvasPtr, jfloat x, jfloat y, jfloat top, jfloat bottom) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(static_cast<uintptr_t>(ptr));
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(static_cast<uintptr_t>(canvasPtr));
+    instance->paint(canvas, x, y, top, bottom);
+}
+
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_paragraph_LazyParagraphKt__1nGetLineMetrics
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(static_cast<uintptr_t>(ptr));
+    std::vector<LineMetrics>* res = new std::vector<LineMetrics>();
+    instance->getLineMetrics(*res);
+    return reinterpret_cast<jlong>(res);
+}
+
+extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_paragraph_LazyParagraphKt__1nGetGlyphPositionAtCoordinate
+  (JNIEnv* env, jclass jclass, jlong ptr, jfloat dx, jfloat dy) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(static_cast<uintptr_t>(ptr));
+    PositionWithAffinity p = instance->getGlyphPositionAtCoordinate(dx, dy);
+    if (p.affinity == Affinity::kDownstream)
+        return p.position;
+    else
+        return -p.position-1;
+}
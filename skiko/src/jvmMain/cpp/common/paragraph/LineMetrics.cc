@@ -0,0 +1,47 @@
+#include <jni.h>
+#include <vector>
+#include "Paragraph.h"
+
+using namespace skia::textlayout;
+
+extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_paragraph_LineMetricsKt_LineMetrics_1nGetArraySize
+  (JNIEnv* env, jclass jclass, jlong arrayPtr) {
+    std::vector<LineMetrics>* vect = reinterpret_cast<std::vector<LineMetrics>*>(static_cast<uintptr_t>(arrayPtr));
+    return static_cast<jint>(vect->size());
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_LineMetricsKt_LineMetrics_1nDisposeArray
+  (JNIEnv* env, jclass jclass, jlong arrayPtr) {
+    std::vector<LineMetrics>* vect = reinterpret_cast<std::vector<LineMetrics>*>(static_cast<uintptr_t>(arrayPtr));
+    delete vect;
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_LineMetricsKt_LineMetrics_1nGetArray
+  (JNIEnv* env, jclass jclass, jlong arrayPtr, jintArray indicesArr, jdoubleArray metricsArr) {
+    std::vector<LineMetrics>* vect = reinterpret_cast<std::vector<LineMetrics>*>(static_cast<uintptr_t>(arrayPtr));
+    if (vect->empty())
+        return;
+    jint* indices = static_cast<jint*>(env->GetPrimitiveArrayCritical(indicesArr, nullptr));
+    jdouble* metrics = static_cast<jdouble*>(env->GetPrimitiveArrayCritical(metricsArr, nullptr));
+    for (size_t i = 0; i < vect->size(); ++i) {
+        const LineMetrics& lm = (*vect)[i];
+        jint* lineIndices = indices + i * 6;
+        lineIndices[0] = static_cast<jint>(lm.fStartIndex);
+        lineIndices[1] = static_cast<jint>(lm.fEndIndex);
+        lineIndices[2] = static_cast<jint>(lm.fEndExcludingWhitespaces);
+        lineIndices[3] = static_cast<jint>(lm.fEndIncludingNewline);
+        lineIndices[4] = lm.fHardBreak ? 1 : 0;
+        lineIndices[5] = static_cast<jint>(lm.fLineNumber);
+
+        jdouble* lineMetrics = metrics + i * 7;
+        lineMetrics[0] = lm.fAscent;
+        lineMetrics[1] = lm.fDescent;
+        lineMetrics[2] = lm.fUnscaledAscent;
+        lineMetrics[3] = lm.fHeight;
+        lineMetrics[4] = lm.fWidth;
+        lineMetrics[5] = lm.fLeft;
+        lineMetrics[6] = lm.fBaseline;
+    }
+    env->ReleasePrimitiveArrayCritical(metricsArr, metrics, 0);
+    env->ReleasePrimitiveArrayCritical(indicesArr, indices, 0);
+}
@@ -1,9 +1,12 @@
 #include <iostream>
+#include <vector>
 #include <jni.h>
-#include "interop.hh"
 #include "../interop.hh"
 #include "DartTypes.h"
 #include "Paragraph.h"
+#include "ParagraphCacheMonitor.hh"
+#include "ParagraphEdit.hh"
+#include "ParagraphLayout.hh"
 
 
 using namespace std;
@@ -70,6 +73,20 @@ extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt_
   (JNIEnv* env, jclass jclass, jlong ptr, jfloat width) {
     Paragraph* instance = reinterpret_cast<Paragraph*>(static_cast<uintptr_t>(ptr));
     instance->layout(width);
+    ParagraphCacheMonitor::EnforceBudget(instance);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt__1nLayoutAll
+  (JNIEnv* env, jclass jclass, jlongArray ptrsArr, jfloatArray widthsArr, jint count) {
+    // Copied rather than pinned, layout may take long
+    std::vector<jlong> ptrs(count);
+    std::vector<float> widths(count);
+    env->GetLongArrayRegion(ptrsArr, 0, count, ptrs.data());
+    env->GetFloatArrayRegion(widthsArr, 0, count, widths.data());
+    std::vector<Paragraph*> paragraphs(count);
+    for (int i = 0; i < count; ++i)
+        paragraphs[i] = reinterpret_cast<Paragraph*>(static_cast<uintptr_t>(ptrs[i]));
+    skikoMpp::paragraph::layoutAll(paragraphs.data(), widths.data(), count);
 }
 
 extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt__1nPaint
@@ -79,42 +96,27 @@ extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt_
     instance->paint(canvas, x, y);
 }
 
-extern "C" JNIEXPORT jobjectArray JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt__1nGetRectsForRange
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt__1nGetRectsForRange
   (JNIEnv* env, jclass jclass, jlong ptr, jint start, jint end, jint rectHeightStyle, jint rectWidthStyle) {
     Paragraph* instance = reinterpret_cast<Paragraph*>(static_cast<uintptr_t>(ptr));
     std::vector<TextBox> originalRects = instance->getRectsForRange(start, end, static_cast<RectHeightStyle>(rectHeightStyle), static_cast<RectWidthStyle>(rectWidthStyle));
-    std::vector<TextBox> rects;
+    std::vector<TextBox>* rects = new std::vector<TextBox>();
+    rects->reserve(originalRects.size());
     for (TextBox& box : originalRects) {
         // TODO fix https://github.com/JetBrains/compose-jb/issues/1308 another way, we just masking the issue
         // (but experiments show, that the result of GetRectsForRange is correct after that)
         if (isnan(box.rect.fLeft) || isnan(box.rect.fTop) || isnan(box.rect.fRight) || isnan(box.rect.fBottom)) {
             continue;
         }
-        rects.push_back(box);
-    }
-
-    jobjectArray rectsArray = env->NewObjectArray((jsize) rects.size(), skija::paragraph::TextBox::cls, nullptr);
-    for (int i = 0; i < rects.size(); ++i) {
-        TextBox box = rects[i];
-        jobject boxObj = env->NewObject(skija::paragraph::TextBox::cls, skija::paragraph::TextBox::ctor, box.rect.fLeft, box.rect.fTop, box.rect.fRight, box.rect.fBottom, static_cast<jint>(box.direction));
-        env->SetObjectArrayElement(rectsArray, i, boxObj);
-        env->DeleteLocalRef(boxObj);
+        rects->push_back(box);
     }
-    return rectsArray;
+    return reinterpret_cast<jlong>(rects);
 }
 
-extern "C" JNIEXPORT jobjectArray JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt__1nGetRectsForPlaceholders
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt__1nGetRectsForPlaceholders
   (JNIEnv* env, jclass jclass, jlong ptr) {
     Paragraph* instance = reinterpret_cast<Paragraph*>(static_cast<uintptr_t>(ptr));
-    std::vector<TextBox> rects = instance->getRectsForPlaceholders();
-    jobjectArray rectsArray = env->NewObjectArray((jsize) rects.size(), skija::paragraph::TextBox::cls, nullptr);
-    for (int i = 0; i < rects.size(); ++i) {
-        TextBox box = rects[i];
-        jobject boxObj = env->NewObject(skija::paragraph::TextBox::cls, skija::paragraph::TextBox::ctor, box.rect.fLeft, box.rect.fTop, box.rect.fRight, box.rect.fBottom, static_cast<jint>(box.direction));
-        env->SetObjectArrayElement(rectsArray, i, boxObj);
-        env->DeleteLocalRef(boxObj);
-    }
-    return rectsArray;
+    return reinterpret_cast<jlong>(new std::vector<TextBox>(instance->getRectsForPlaceholders()));
 }
 
 extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt__1nGetGlyphPositionAtCoordinate
@@ -138,25 +140,12 @@ extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt_
     env->SetIntArrayRegion(resultArray, 0, 2, result);
 }
 
-extern "C" JNIEXPORT jobjectArray JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt__1nGetLineMetrics
-  (JNIEnv* env, jclass jclass, jlong ptr, jlong textPtr) {
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt__1nGetLineMetrics
+  (JNIEnv* env, jclass jclass, jlong ptr) {
     Paragraph* instance = reinterpret_cast<Paragraph*>(static_cast<uintptr_t>(ptr));
-    SkString* text = reinterpret_cast<SkString*>(static_cast<uintptr_t>(textPtr));
-    std::vector<LineMetrics> res;
-    instance->getLineMetrics(res);
-    jobjectArray resArray = env->NewObjectArray((jsize) res.size(), skija::paragraph::LineMetrics::cls, nullptr);
-    auto conv = skija::UtfIndicesConverter(*text);
-    for (int i = 0; i < res.size(); ++i) {
-        LineMetrics lm = res[i];
-        size_t startIndex = lm.fStartIndex;
-        size_t endExcludingWhitespaces = lm.fEndExcludingWhitespaces;
-        size_t endIndex = lm.fEndIndex;
-        size_t endIncludingNewline = lm.fEndIncludingNewline;
-        jobject lmObj = env->NewObject(skija::paragraph::LineMetrics::cls, skija::paragraph::LineMetrics::ctor, startIndex, endIndex, endExcludingWhitespaces, endIncludingNewline, lm.fHardBreak, lm.fAscent, lm.fDescent, lm.fUnscaledAscent, lm.fHeight, lm.fWidth, lm.fLeft, lm.fBaseline, lm.fLineNumber);
-        env->SetObjectArrayElement(resArray, i, lmObj);
-        env->DeleteLocalRef(lmObj);
-    }
-    return resArray;
+    std::vector<LineMetrics>* res = new std::vector<LineMetrics>();
+    instance->getLineMetrics(*res);
+    return reinterpret_cast<jlong>(res);
 }
 
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt__1nGetLineNumber
@@ -183,11 +172,12 @@ extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt_
     return instance->updateTextAlign(static_cast<TextAlign>(textAlignment));
 }
 
-// extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt__1nUpdateText
-//   (JNIEnv* env, jclass jclass, jlong ptr, jint from, jstring text) {
-//     Paragraph* instance = reinterpret_cast<Paragraph*>(static_cast<uintptr_t>(ptr));
-//     return instance->updateText(from, skString(env, text));
-// }
+extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt__1nRebuildWithText
+  (JNIEnv* env, jclass jclass, jlong ptr, jint from, jint to, jstring text, jlong newTextPtr) {
+    Paragraph* instance = reinterpret_cast<Paragraph*>(static_cast<uintptr_t>(ptr));
+    SkString* newText = reinterpret_cast<SkString*>(static_cast<uintptr_t>(newTextPtr));
+    return reinterpret_cast<jlong>(skikoMpp::paragraph::rebuildWithText(instance, from, to, skString(env, text), newText).release());
+}
 
 extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_ParagraphKt__1nUpdateFontSize
   (JNIEnv* env, jclass jclass, jlong ptr, jint from, jint to, jfloat fontSize, jlong textPtr) {
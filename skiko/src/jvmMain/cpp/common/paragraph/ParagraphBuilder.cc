@@ -1,7 +1,9 @@
 #include <iostream>
 #include <jni.h>
 #include <string>
+#include <vector>
 #include "ParagraphBuilder.h"
+#include "StyledText.hh"
 #include "../interop.hh"
 
 using namespace std;
@@ -44,6 +46,24 @@ extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_ParagraphBui
     instance->addText(text.c_str(), text.size());
 }
 
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_ParagraphBuilderKt__1nAddStyledText
+  (JNIEnv* env, jclass jclass, jlong ptr, jstring textString, jintArray startsArr, jintArray endsArr, jlongArray stylePtrsArr, jint count, jlong managedTextPtr) {
+    ParagraphBuilder* instance = reinterpret_cast<ParagraphBuilder*>(static_cast<uintptr_t>(ptr));
+    SkString* managedText = reinterpret_cast<SkString*>(static_cast<uintptr_t>(managedTextPtr));
+    SkString text = skString(env, textString);
+    std::vector<jint> starts(count);
+    std::vector<jint> ends(count);
+    std::vector<jlong> stylePtrs(count);
+    env->GetIntArrayRegion(startsArr, 0, count, starts.data());
+    env->GetIntArrayRegion(endsArr, 0, count, ends.data());
+    env->GetLongArrayRegion(stylePtrsArr, 0, count, stylePtrs.data());
+    std::vector<const TextStyle*> styles(count);
+    for (int i = 0; i < count; ++i)
+        styles[i] = reinterpret_cast<TextStyle*>(static_cast<uintptr_t>(stylePtrs[i]));
+    skikoMpp::paragraph::addStyledText(instance, text, starts.data(), ends.data(), styles.data(), count);
+    managedText->append(text);
+}
+
 extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_ParagraphBuilderKt__1nAddPlaceholder
   (JNIEnv* env, jclass jclass, jlong ptr, jfloat width, jfloat height, jint alignment, jint baselinePosition, jfloat baseline) {
     ParagraphBuilder* instance = reinterpret_cast<ParagraphBuilder*>(static_cast<uintptr_t>(ptr));
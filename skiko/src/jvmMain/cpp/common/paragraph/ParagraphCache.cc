@@ -1,6 +1,7 @@
 #include <iostream>
 #include <jni.h>
 #include "ParagraphCache.h"
+#include "ParagraphCacheMonitor.hh"
 #include "ParagraphStyle.h"
 
 using namespace skia::textlayout;
@@ -9,12 +10,14 @@ extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_ParagraphCac
   (JNIEnv* env, jclass jclass, jlong ptr) {
     ParagraphCache* instance = reinterpret_cast<ParagraphCache*>(static_cast<uintptr_t>(ptr));
     instance->abandon();
+    ParagraphCacheMonitor::Get(instance)->onReset();
 }
 
 extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_ParagraphCacheKt__1nReset
   (JNIEnv* env, jclass jclass, jlong ptr) {
     ParagraphCache* instance = reinterpret_cast<ParagraphCache*>(static_cast<uintptr_t>(ptr));
     instance->reset();
+    ParagraphCacheMonitor::Get(instance)->onReset();
 }
 
 extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_paragraph_ParagraphCacheKt__1nUpdateParagraph
@@ -48,3 +51,37 @@ extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_paragraph_ParagraphCac
     ParagraphCache* instance = reinterpret_cast<ParagraphCache*>(static_cast<uintptr_t>(ptr));
     return instance->count();
 }
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_ParagraphCacheKt__1nGetStats
+  (JNIEnv* env, jclass jclass, jlong ptr, jintArray resultArray) {
+    ParagraphCache* instance = reinterpret_cast<ParagraphCache*>(static_cast<uintptr_t>(ptr));
+    ParagraphCacheMonitor::Stats stats = ParagraphCacheMonitor::Get(instance)->getStats();
+    // 64-bit counters are split into high and low halves
+    jint result[12] = {
+        static_cast<jint>(stats.fHits >> 32),
+        static_cast<jint>(stats.fHits),
+        static_cast<jint>(stats.fMisses >> 32),
+        static_cast<jint>(stats.fMisses),
+        static_cast<jint>(stats.fEvictions >> 32),
+        static_cast<jint>(stats.fEvictions),
+        static_cast<jint>(stats.fCount),
+        static_cast<jint>(stats.fBytesUsed >> 32),
+        static_cast<jint>(stats.fBytesUsed),
+        static_cast<jint>(stats.fByteBudget),
+        static_cast<jint>(stats.fTimeSavedNanos >> 32),
+        static_cast<jint>(stats.fTimeSavedNanos)
+    };
+    env->SetIntArrayRegion(resultArray, 0, 12, result);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_ParagraphCacheKt__1nResetStats
+  (JNIEnv* env, jclass jclass, jlong ptr) {
+    ParagraphCache* instance = reinterpret_cast<ParagraphCache*>(static_cast<uintptr_t>(ptr));
+    ParagraphCacheMonitor::Get(instance)->resetStats();
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_ParagraphCacheKt__1nSetByteBudget
+  (JNIEnv* env, jclass jclass, jlong ptr, jint byteBudget) {
+    ParagraphCache* instance = reinterpret_cast<ParagraphCache*>(static_cast<uintptr_t>(ptr));
+    ParagraphCacheMonitor::Get(instance)->setByteBudget(byteBudget);
+}
@@ -0,0 +1,36 @@
+#include <jni.h>
+#include <vector>
+#include "Paragraph.h"
+
+using namespace skia::textlayout;
+
+extern "C" JNIEXPORT jint JNICALL Java_org_jetbrains_skia_paragraph_TextBoxKt_TextBox_1nGetArraySize
+  (JNIEnv* env, jclass jclass, jlong arrayPtr) {
+    std::vector<TextBox>* vect = reinterpret_cast<std::vector<TextBox>*>(static_cast<uintptr_t>(arrayPtr));
+    return static_cast<jint>(vect->size());
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_TextBoxKt_TextBox_1nDisposeArray
+  (JNIEnv* env, jclass jclass, jlong arrayPtr) {
+    std::vector<TextBox>* vect = reinterpret_cast<std::vector<TextBox>*>(static_cast<uintptr_t>(arrayPtr));
+    delete vect;
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_paragraph_TextBoxKt_TextBox_1nGetArray
+  (JNIEnv* env, jclass jclass, jlong arrayPtr, jfloatArray ltrbArr, jintArray directionsArr) {
+    std::vector<TextBox>* vect = reinterpret_cast<std::vector<TextBox>*>(static_cast<uintptr_t>(arrayPtr));
+    if (vect->empty())
+        return;
+    jfloat* ltrb = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(ltrbArr, nullptr));
+    jint* directions = static_cast<jint*>(env->GetPrimitiveArrayCritical(directionsArr, nullptr));
+    for (size_t i = 0; i < vect->size(); ++i) {
+        const TextBox& box = (*vect)[i];
+        ltrb[i * 4]     = box.rect.fLeft;
+        ltrb[i * 4 + 1] = box.rect.fTop;
+        ltrb[i * 4 + 2] = box.rect.fRight;
+        ltrb[i * 4 + 3] = box.rect.fBottom;
+        directions[i] = static_cast<jint>(box.direction);
+    }
+    env->ReleasePrimitiveArrayCritical(directionsArr, directions, 0);
+    env->ReleasePrimitiveArrayCritical(ltrbArr, ltrb, 0);
+}
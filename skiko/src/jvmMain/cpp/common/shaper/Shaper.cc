@@ -5,11 +5,13 @@
 #include "FontRunIterator.hh"
 #include "SkShaper.h"
 #include "src/utils/SkUTF.h"
+#include "ShapingCache.hh"
 #include "TextLineRunHandler.hh"
 #include "unicode/ubidi.h"
 
 static void deleteShaper(SkShaper* instance) {
     // std::cout << "Deleting [SkShaper " << instance << "]" << std::endl;
+    ShapingCache::Unregister(instance);
     delete instance;
 }
 
@@ -19,31 +21,31 @@ extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_shaper_ShaperKt_Shape
 
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_shaper_ShaperKt__1nMakePrimitive
   (JNIEnv* env, jclass jclass) {
-    return reinterpret_cast<jlong>(SkShaper::MakePrimitive().release());
+    return reinterpret_cast<jlong>(ShapingCache::Register(SkShaper::MakePrimitive(), ShapingCache::ShaperKind::kPrimitive));
 }
 
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_shaper_ShaperKt__1nMakeShaperDrivenWrapper
   (JNIEnv* env, jclass jclass, jlong fontMgrPtr) {
     SkFontMgr* fontMgr = reinterpret_cast<SkFontMgr*>(static_cast<uintptr_t>(fontMgrPtr));
-    return reinterpret_cast<jlong>(SkShaper::MakeShaperDrivenWrapper(sk_ref_sp(fontMgr)).release());
+    return reinterpret_cast<jlong>(ShapingCache::Register(SkShaper::MakeShaperDrivenWrapper(sk_ref_sp(fontMgr)), ShapingCache::ShaperKind::kShaperDrivenWrapper));
 }
 
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_shaper_ShaperKt__1nMakeShapeThenWrap
   (JNIEnv* env, jclass jclass, jlong fontMgrPtr) {
     SkFontMgr* fontMgr = reinterpret_cast<SkFontMgr*>(static_cast<uintptr_t>(fontMgrPtr));
-    return reinterpret_cast<jlong>(SkShaper::MakeShapeThenWrap(sk_ref_sp(fontMgr)).release());
+    return reinterpret_cast<jlong>(ShapingCache::Register(SkShaper::MakeShapeThenWrap(sk_ref_sp(fontMgr)), ShapingCache::ShaperKind::kShapeThenWrap));
 }
 
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_shaper_ShaperKt__1nMakeShapeDontWrapOrReorder
   (JNIEnv* env, jclass jclass, jlong fontMgrPtr) {
     SkFontMgr* fontMgr = reinterpret_cast<SkFontMgr*>(static_cast<uintptr_t>(fontMgrPtr));
-    return reinterpret_cast<jlong>(SkShaper::MakeShapeDontWrapOrReorder(sk_ref_sp(fontMgr)).release());
+    return reinterpret_cast<jlong>(ShapingCache::Register(SkShaper::MakeShapeDontWrapOrReorder(sk_ref_sp(fontMgr)), ShapingCache::ShaperKind::kShapeDontWrapOrReorder));
 }
 
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_shaper_ShaperKt__1nMakeCoreText
   (JNIEnv* env, jclass jclass) {
     #ifdef SK_SHAPER_CORETEXT_AVAILABLE
-        return reinterpret_cast<jlong>(SkShaper::MakeCoreText().release());
+        return reinterpret_cast<jlong>(ShapingCache::Register(SkShaper::MakeCoreText(), ShapingCache::ShaperKind::kCoreText));
     #else
         return 0;
     #endif
@@ -52,7 +54,34 @@ extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_shaper_ShaperKt__1nMa
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_shaper_ShaperKt_Shaper_1nMake
   (JNIEnv* env, jclass jclass, jlong fontMgrPtr) {
     SkFontMgr* fontMgr = reinterpret_cast<SkFontMgr*>(static_cast<uintptr_t>(fontMgrPtr));
-    return reinterpret_cast<jlong>(SkShaper::Make(sk_ref_sp(fontMgr)).release());
+    return reinterpret_cast<jlong>(ShapingCache::Register(SkShaper::Make(sk_ref_sp(fontMgr)), ShapingCache::ShaperKind::kDefault));
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_shaper_ShaperKt__1nGetCacheStats
+  (JNIEnv* env, jclass jclass, jintArray resultArray) {
+    ShapingCache::Stats stats = ShapingCache::Get().getStats();
+    jint result[4] = { stats.fHits, stats.fMisses, stats.fRejected, stats.fCount };
+    env->SetIntArrayRegion(resultArray, 0, 4, result);
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_shaper_ShaperKt__1nSetCacheEnabled
+  (JNIEnv* env, jclass jclass, jboolean value) {
+    ShapingCache::Get().setEnabled(value);
+}
+
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_shaper_ShaperKt__1nLoadCache
+  (JNIEnv* env, jclass jclass, jstring pathStr) {
+    return ShapingCache::Get().load(skString(env, pathStr).c_str());
+}
+
+extern "C" JNIEXPORT jboolean JNICALL Java_org_jetbrains_skia_shaper_ShaperKt__1nSaveCache
+  (JNIEnv* env, jclass jclass, jstring pathStr) {
+    return ShapingCache::Get().save(skString(env, pathStr).c_str());
+}
+
+extern "C" JNIEXPORT void JNICALL Java_org_jetbrains_skia_shaper_ShaperKt__1nPurgeCache
+  (JNIEnv* env, jclass jclass) {
+    ShapingCache::Get().clear();
 }
 
 extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_shaper_ShaperKt__1nShapeBlob
@@ -69,28 +98,32 @@ extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_shaper_ShaperKt__1nSh
     bool aproximateSpaces = (optsBooleanProps & 0x02) != 0;
     bool isLeftToRight = (optsBooleanProps & 0x04) != 0;
 
-    uint8_t defaultBiDiLevel = isLeftToRight ? UBIDI_DEFAULT_LTR : UBIDI_DEFAULT_RTL;
-    std::unique_ptr<SkShaper::BiDiRunIterator> bidiRunIter(SkShaper::MakeBiDiRunIterator(text.c_str(), text.size(), defaultBiDiLevel));
-    if (!bidiRunIter) return 0;
-
-    std::unique_ptr<SkShaper::ScriptRunIterator> scriptRunIter(SkShaper::MakeHbIcuScriptRunIterator(text.c_str(), text.size()));
-    if (!scriptRunIter) return 0;
-
-    std::unique_ptr<SkShaper::LanguageRunIterator> languageRunIter(SkShaper::MakeStdLanguageRunIterator(text.c_str(), text.size()));
-    if (!languageRunIter) return 0;
-
-    FontRunIterator fontRunIter(
-        text.c_str(),
-        text.size(),
-        *font,
-        SkFontMgr::RefDefault(),
-        graphemeIter,
-        aproximateSpaces,
-        aproximatePunctuation
-    );
-
     SkTextBlobBuilderRunHandler rh(text.c_str(), {offsetX, offsetY});
-    instance->shape(text.c_str(), text.size(), fontRunIter, *bidiRunIter, *scriptRunIter, *languageRunIter, features.data(), features.size(), width, &rh);
+    bool shaped = ShapingCache::Get().shape(instance, text, *font, features, optsBooleanProps, width, &rh, [&](SkShaper::RunHandler* handler) {
+        uint8_t defaultBiDiLevel = isLeftToRight ? UBIDI_DEFAULT_LTR : UBIDI_DEFAULT_RTL;
+        std::unique_ptr<SkShaper::BiDiRunIterator> bidiRunIter(SkShaper::MakeBiDiRunIterator(text.c_str(), text.size(), defaultBiDiLevel));
+        if (!bidiRunIter) return false;
+
+        std::unique_ptr<SkShaper::ScriptRunIterator> scriptRunIter(SkShaper::MakeHbIcuScriptRunIterator(text.c_str(), text.size()));
+        if (!scriptRunIter) return false;
+
+        std::unique_ptr<SkShaper::LanguageRunIterator> languageRunIter(SkShaper::MakeStdLanguageRunIterator(text.c_str(), text.size()));
+        if (!languageRunIter) return false;
+
+        FontRunIterator fontRunIter(
+            text.c_str(),
+            text.size(),
+            *font,
+            SkFontMgr::RefDefault(),
+            graphemeIter,
+            aproximateSpaces,
+            aproximatePunctuation
+        );
+
+        instance->shape(text.c_str(), text.size(), fontRunIter, *bidiRunIter, *scriptRunIter, *languageRunIter, features.data(), features.size(), width, handler);
+        return true;
+    });
+    if (!shaped) return 0;
     SkTextBlob* blob = rh.makeBlob().release();
 
     return reinterpret_cast<jlong>(blob);
@@ -116,27 +149,31 @@ extern "C" JNIEXPORT jlong JNICALL Java_org_jetbrains_skia_shaper_ShaperKt__1nSh
     bool aproximateSpaces = (optsBooleanProps & 0x02) != 0;
     bool isLeftToRight = (optsBooleanProps & 0x04) != 0;
 
-    uint8_t defaultBiDiLevel = isLeftToRight ? UBIDI_DEFAULT_LTR : UBIDI_DEFAULT_RTL;
-    std::unique_ptr<SkShaper::BiDiRunIterator> bidiRunIter(SkShaper::MakeBiDiRunIterator(text.c_str(), text.size(), defaultBiDiLevel));
-    if (!bidiRunIter) return 0;
-
-    std::unique_ptr<SkShaper::ScriptRunIterator> scriptRunIter(SkShaper::MakeHbIcuScriptRunIterator(text.c_str(), text.size()));
-    if (!scriptRunIter) return 0;
-
-    std::unique_ptr<SkShaper::LanguageRunIterator> languageRunIter(SkShaper::MakeStdLanguageRunIterator(text.c_str(), text.size()));
-    if (!languageRunIter) return 0;
-
-    FontRunIterator fontRunIter(
-        text.c_str(),
-        text.size(),
-        *font,
-        SkFontMgr::RefDefault(),
-        graphemeIter,
-        aproximateSpaces,
-        aproximatePunctuation);
-
     TextLineRunHandler rh(text, graphemeIter);
-    instance->shape(text.c_str(), text.size(), fontRunIter, *bidiRunIter, *scriptRunIter, *languageRunIter, features.data(), features.size(), std::numeric_limits<float>::infinity(), &rh);
+    bool shaped = ShapingCache::Get().shape(instance, text, *font, features, optsBooleanProps, std::numeric_limits<float>::infinity(), &rh, [&](SkShaper::RunHandler* handler) {
+        uint8_t defaultBiDiLevel = isLeftToRight ? UBIDI_DEFAULT_LTR : UBIDI_DEFAULT_RTL;
+        std::unique_ptr<SkShaper::BiDiRunIterator> bidiRunIter(SkShaper::MakeBiDiRunIterator(text.c_str(), text.size(), defaultBiDiLevel));
+        if (!bidiRunIter) return false;
+
+        std::unique_ptr<SkShaper::ScriptRunIterator> scriptRunIter(SkShaper::MakeHbIcuScriptRunIterator(text.c_str(), text.size()));
+        if (!scriptRunIter) return false;
+
+        std::unique_ptr<SkShaper::LanguageRunIterator> languageRunIter(SkShaper::MakeStdLanguageRunIterator(text.c_str(), text.size()));
+        if (!languageRunIter) return false;
+
+        FontRunIterator fontRunIter(
+            text.c_str(),
+            text.size(),
+            *font,
+            SkFontMgr::RefDefault(),
+            graphemeIter,
+            aproximateSpaces,
+            aproximatePunctuation);
+
+        instance->shape(text.c_str(), text.size(), fontRunIter, *bidiRunIter, *scriptRunIter, *languageRunIter, features.data(), features.size(), std::numeric_limits<float>::infinity(), handler);
+        return true;
+    });
+    if (!shaped) return 0;
 
     return reinterpret_cast<jlong>(rh.makeLine().release());
 }
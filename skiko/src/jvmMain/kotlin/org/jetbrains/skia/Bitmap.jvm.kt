@@ -0,0 +1,41 @@
+package org.jetbrains.skia
+
+import java.nio.ByteBuffer
+
+/**
+ * Copies pixels from Bitmap straight into the direct buffer, without an intermediate Java array.
+ *
+ * @return true if pixels were copied
+ */
+fun Bitmap.readPixels(
+    dst: ByteBuffer,
+    dstInfo: ImageInfo = imageInfo,
+    dstRowBytes: Int = rowBytes,
+    srcX: Int = 0,
+    srcY: Int = 0
+): Boolean = dst.withPixmap(dstInfo, dstRowBytes) { readPixels(it, srcX, srcY) }
+
+/**
+ * Copies pixels from the direct buffer into Bitmap at (dstX, dstY).
+ *
+ * @return true if pixels were written to Bitmap
+ */
+fun Bitmap.writePixels(
+    src: ByteBuffer,
+    srcInfo: ImageInfo = imageInfo,
+    srcRowBytes: Int = rowBytes,
+    dstX: Int = 0,
+    dstY: Int = 0
+): Boolean = src.withPixmap(srcInfo, srcRowBytes) { writePixels(it, dstX, dstY) }
+
+/**
+ * Makes Bitmap use memory of the direct buffer as its pixels, without copying them.
+ * Bitmap keeps the buffer reachable until pixels are replaced by installPixels() or reset().
+ *
+ * @return true if ImageInfo was set to info
+ */
+fun Bitmap.installPixels(info: ImageInfo, pixels: ByteBuffer, rowBytes: Int): Boolean {
+    val result = pixels.withPixmap(info, rowBytes) { installPixels(it) }
+    _pixelsOwner = if (result) pixels else null
+    return result
+}
@@ -0,0 +1,30 @@
+package org.jetbrains.skia
+
+import java.nio.ByteBuffer
+
+/**
+ * Copies Rect of pixels from Canvas straight into the direct buffer, without an intermediate Java array.
+ * Matrix and clip are ignored.
+ *
+ * @return true if pixels were copied
+ */
+fun Canvas.readPixels(
+    dst: ByteBuffer,
+    dstInfo: ImageInfo,
+    dstRowBytes: Int = dstInfo.minRowBytes,
+    srcX: Int = 0,
+    srcY: Int = 0
+): Boolean = dst.withPixmap(dstInfo, dstRowBytes) { readPixels(it, srcX, srcY) }
+
+/**
+ * Copies Rect of pixels from the direct buffer to Canvas at (x, y). Matrix and clip are ignored.
+ *
+ * @return true if pixels were written to Canvas
+ */
+fun Canvas.writePixels(
+    src: ByteBuffer,
+    srcInfo: ImageInfo,
+    srcRowBytes: Int = srcInfo.minRowBytes,
+    x: Int = 0,
+    y: Int = 0
+): Boolean = src.withPixmap(srcInfo, srcRowBytes) { writePixels(it, x, y) }
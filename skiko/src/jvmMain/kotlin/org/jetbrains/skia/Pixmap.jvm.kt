@@ -0,0 +1,21 @@
+package org.jetbrains.skia
+
+import org.jetbrains.skia.impl.BufferUtil
+import org.jetbrains.skia.impl.reachabilityBarrier
+import java.nio.ByteBuffer
+
+/**
+ * Wraps memory of the direct buffer into a temporary Pixmap, so that pixels can be read or written
+ * without copying them through a Java array.
+ */
+internal inline fun <T> ByteBuffer.withPixmap(info: ImageInfo, rowBytes: Int, block: (Pixmap) -> T): T {
+    val size = info.computeByteSize(rowBytes)
+    require(capacity() >= size) { "Buffer has ${capacity()} bytes, $size required" }
+    val pixmap = Pixmap.make(info, BufferUtil.getPointerFromByteBuffer(this), rowBytes)
+    return try {
+        block(pixmap)
+    } finally {
+        pixmap.close()
+        reachabilityBarrier(this)
+    }
+}
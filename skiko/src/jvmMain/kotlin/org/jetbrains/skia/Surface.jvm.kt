@@ -0,0 +1,27 @@
+package org.jetbrains.skia
+
+import java.nio.ByteBuffer
+
+/**
+ * Copies Rect of pixels from Surface straight into the direct buffer, without an intermediate Java array.
+ *
+ * @return true if pixels were copied
+ */
+fun Surface.readPixels(
+    dst: ByteBuffer,
+    dstInfo: ImageInfo = imageInfo,
+    dstRowBytes: Int = dstInfo.minRowBytes,
+    srcX: Int = 0,
+    srcY: Int = 0
+): Boolean = dst.withPixmap(dstInfo, dstRowBytes) { readPixels(it, srcX, srcY) }
+
+/**
+ * Copies Rect of pixels from the direct buffer to Surface at (x, y).
+ */
+fun Surface.writePixels(
+    src: ByteBuffer,
+    srcInfo: ImageInfo = imageInfo,
+    srcRowBytes: Int = srcInfo.minRowBytes,
+    x: Int = 0,
+    y: Int = 0
+) = src.withPixmap(srcInfo, srcRowBytes) { writePixels(it, x, y) }
@@ -0,0 +1,59 @@
+package org.jetbrains.skia
+
+import org.jetbrains.skia.impl.BufferUtil
+import org.jetbrains.skia.impl.NativePointer
+import org.jetbrains.skia.impl.Stats
+import org.jetbrains.skia.impl.reachabilityBarrier
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+import java.nio.FloatBuffer
+import java.nio.IntBuffer
+import java.nio.ShortBuffer
+
+/*
+ * Direct views of Vertices native storage, for filling large meshes without any intermediate
+ * Java arrays. A view is only valid inside its block: writes are picked up by the first draw or
+ * bounds call after the block returns, and the memory behind a view is freed when the Vertices
+ * are closed. Draws and bounds calls made inside the block take a snapshot of the writes made so
+ * far, that doesn't end the view: writes made after them are still picked up once the block returns.
+ */
+
+/**
+ * Runs block with a view of (x, y) pairs, 2 floats per vertex.
+ */
+fun <T> Vertices.withPositionsBuffer(block: (FloatBuffer) -> T): T =
+    withDirectBuffer(positionsStorage(), vertexCount * 8) { block(it.asFloatBuffer()) }
+
+/**
+ * Runs block with a view of (u, v) pairs, 2 floats per vertex.
+ */
+fun <T> Vertices.withTexCoordsBuffer(block: (FloatBuffer) -> T): T {
+    require(hasTexCoords) { "Vertices were made without texCoords" }
+    return withDirectBuffer(texCoordsStorage(), vertexCount * 8) { block(it.asFloatBuffer()) }
+}
+
+/**
+ * Runs block with a view of ARGB colors, 1 int per vertex.
+ */
+fun <T> Vertices.withColorsBuffer(block: (IntBuffer) -> T): T {
+    require(hasColors) { "Vertices were made without colors" }
+    return withDirectBuffer(colorsStorage(), vertexCount * 4) { block(it.asIntBuffer()) }
+}
+
+/**
+ * Runs block with a view of unsigned 16-bit indices.
+ */
+fun <T> Vertices.withIndicesBuffer(block: (ShortBuffer) -> T): T {
+    require(indexCount > 0) { "Vertices were made without indices" }
+    return withDirectBuffer(indicesStorage(), indexCount * 2) { block(it.asShortBuffer()) }
+}
+
+private inline fun <T> Vertices.withDirectBuffer(ptr: NativePointer, size: Int, block: (ByteBuffer) -> T): T {
+    return try {
+        block(BufferUtil.getByteBufferFromPointer(ptr, size).order(ByteOrder.nativeOrder()))
+    } finally {
+        Stats.onNativeCall()
+        markEdited()
+        reachabilityBarrier(this)
+    }
+}
@@ -0,0 +1,89 @@
+package org.jetbrains.skia
+
+import org.jetbrains.skia.shaper.Shaper
+import org.jetbrains.skiko.resourcePath
+import org.junit.Test
+import java.io.File
+import kotlin.test.assertContentEquals
+import kotlin.test.assertEquals
+import kotlin.test.assertNotEquals
+import kotlin.test.assertTrue
+
+class ShapingCacheTest {
+    private val text = "Abc 123 -> xyz"
+    private val font = Font(Typeface.makeFromFile(resourcePath("./fonts/Inter-Hinted-Regular.ttf")), 36f)
+
+    private fun withCache(block: (File) -> Unit) {
+        val file = File.createTempFile("shaping", ".cache")
+        Shaper.setCacheEnabled(true)
+        try {
+            Shaper.purgeCache()
+            block(file)
+        } finally {
+            Shaper.setCacheEnabled(false)
+            Shaper.purgeCache()
+            file.delete()
+        }
+    }
+
+    @Test
+    fun savePurgeLoadRoundTrip() = withCache { file ->
+        val shaper = Shaper.make()
+        val live = shaper.shapeLine(text, font)
+        assertTrue(Shaper.saveCache(file.path))
+        Shaper.purgeCache()
+        assertEquals(0, Shaper.cacheStats.count)
+
+        assertTrue(Shaper.loadCache(file.path))
+        assertEquals(1, Shaper.cacheStats.count)
+        val hitsBefore = Shaper.cacheStats.hits
+        val cached = shaper.shapeLine(text, font)
+        assertEquals(hitsBefore + 1, Shaper.cacheStats.hits)
+        assertContentEquals(live.glyphs, cached.glyphs)
+        assertContentEquals(live.positions, cached.positions)
+        assertEquals(live.width, cached.width)
+    }
+
+    @Test
+    fun mismatchedFingerprintFallsBackToLiveShaping() = withCache { file ->
+        val shaper = Shaper.make()
+        val live = shaper.shapeLine(text, font)
+        assertTrue(Shaper.saveCache(file.path))
+        Shaper.purgeCache()
+
+        // Run fingerprint is style, checksum, glyph count and family, the last family in file
+        // belongs to the recorded run. Change its checksum, key still matches.
+        val bytes = file.readBytes()
+        val family = font.typeface!!.familyName.toByteArray()
+        val familyAt = (bytes.size - family.size downTo 0).first { at ->
+            family.indices.all { bytes[at + it] == family[it] }
+        }
+        bytes[familyAt - 12] = (bytes[familyAt - 12] + 1).toByte()
+        file.writeBytes(bytes)
+
+        assertTrue(Shaper.loadCache(file.path))
+        val rejectedBefore = Shaper.cacheStats.rejected
+        val hitsBefore = Shaper.cacheStats.hits
+        val shaped = shaper.shapeLine(text, font)
+        assertEquals(rejectedBefore + 1, Shaper.cacheStats.rejected)
+        assertEquals(hitsBefore, Shaper.cacheStats.hits)
+        assertContentEquals(live.glyphs, shaped.glyphs)
+        assertContentEquals(live.positions, shaped.positions)
+    }
+
+    @Test
+    fun variableFontInstancesDontShareEntries() = withCache { _ ->
+        val shaper = Shaper.make()
+        val interV = Typeface.makeFromFile(resourcePath("./fonts/Inter-V.ttf"))
+        val regular = Font(interV.makeClone(FontVariation("wght", 400f)), 36f)
+        val bold = Font(interV.makeClone(FontVariation("wght", 900f)), 36f)
+
+        val regularLine = shaper.shapeLine(text, regular)
+        val hitsBefore = Shaper.cacheStats.hits
+        val boldLine = shaper.shapeLine(text, bold)
+        assertEquals(hitsBefore, Shaper.cacheStats.hits)
+        assertNotEquals(regularLine.width, boldLine.width)
+        assertEquals(2, Shaper.cacheStats.count)
+        assertEquals(boldLine.width, shaper.shapeLine(text, bold).width)
+    }
+}
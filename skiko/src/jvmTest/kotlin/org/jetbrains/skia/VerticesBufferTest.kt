@@ -0,0 +1,45 @@
+package org.jetbrains.skia
+
+import org.junit.Test
+import kotlin.test.assertEquals
+
+class VerticesBufferTest {
+    private fun pixelAt(picture: Picture?, vertices: Vertices?, x: Int, y: Int): Int {
+        val surface = Surface.makeRasterN32Premul(8, 8)
+        picture?.let { surface.canvas.drawPicture(it) }
+        vertices?.let { surface.canvas.drawVertices(it, BlendMode.MODULATE, Paint()) }
+        val bitmap = Bitmap()
+        bitmap.allocN32Pixels(8, 8)
+        surface.readPixels(bitmap, 0, 0)
+        return bitmap.getColor(x, y)
+    }
+
+    @Test
+    fun viewWritesApplyAfterBlock() {
+        val vertices = Vertices.make(VertexMode.TRIANGLES, 3, hasColors = true)
+        vertices.withColorsBuffer { it.put(intArrayOf(Color.RED, Color.RED, Color.RED)) }
+        vertices.withPositionsBuffer { positions ->
+            positions.put(floatArrayOf(0f, 0f, 4f, 0f))
+            // Snapshot taken inside the block doesn't drop later writes
+            assertEquals(Rect(0f, 0f, 4f, 0f), vertices.bounds)
+            positions.put(floatArrayOf(0f, 4f))
+        }
+        assertEquals(Rect(0f, 0f, 4f, 4f), vertices.bounds)
+        assertEquals(Color.RED, pixelAt(null, vertices, 1, 1))
+    }
+
+    @Test
+    fun viewWritesDontChangeRecordedPicture() {
+        val vertices = Vertices.make(VertexMode.TRIANGLES, 3, hasColors = true)
+        vertices.withColorsBuffer { it.put(intArrayOf(Color.RED, Color.RED, Color.RED)) }
+        vertices.withPositionsBuffer { it.put(floatArrayOf(0f, 0f, 4f, 0f, 0f, 4f)) }
+
+        val recorder = PictureRecorder()
+        recorder.beginRecording(Rect(0f, 0f, 8f, 8f)).drawVertices(vertices, BlendMode.MODULATE, Paint())
+        val picture = recorder.finishRecordingAsPicture()
+
+        vertices.withColorsBuffer { it.put(intArrayOf(Color.BLUE, Color.BLUE, Color.BLUE)) }
+        assertEquals(Color.RED, pixelAt(picture, null, 1, 1))
+        assertEquals(Color.BLUE, pixelAt(null, vertices, 1, 1))
+    }
+}
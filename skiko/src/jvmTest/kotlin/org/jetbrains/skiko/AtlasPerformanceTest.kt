@@ -0,0 +1,65 @@
+package org.jetbrains.skiko
+
+import org.jetbrains.skia.Color
+import org.jetbrains.skia.Paint
+import org.jetbrains.skia.Rect
+import org.jetbrains.skia.Surface
+import org.jetbrains.skiko.util.measureIterations
+import org.jetbrains.skiko.util.performanceTest
+import org.jetbrains.skiko.util.printTimings
+import kotlin.math.cos
+import kotlin.math.sin
+import kotlin.test.Test
+
+class AtlasPerformanceTest {
+    private val count = 100_000
+    private val spriteSize = 16
+    private val spritesPerRow = 8
+
+    @Test
+    fun `draw 100k sprites`() = performanceTest {
+        val atlasSurface = Surface.makeRasterN32Premul(spriteSize * spritesPerRow, spriteSize * spritesPerRow)
+        val paint = Paint()
+        for (i in 0 until spritesPerRow * spritesPerRow) {
+            val x = (i % spritesPerRow * spriteSize).toFloat()
+            val y = (i / spritesPerRow * spriteSize).toFloat()
+            paint.color = Color.makeARGB(255, i * 4, 255 - i * 4, 128)
+            atlasSurface.canvas.drawCircle(x + spriteSize / 2f, y + spriteSize / 2f, spriteSize / 2f, paint)
+        }
+        val atlas = atlasSurface.makeImageSnapshot()
+
+        val xforms = FloatArray(count * 4)
+        val texRects = FloatArray(count * 4)
+        for (i in 0 until count) {
+            val angle = i * 0.01f
+            val scale = 0.5f + (i % 10) / 10f
+            xforms[i * 4] = scale * cos(angle)
+            xforms[i * 4 + 1] = scale * sin(angle)
+            xforms[i * 4 + 2] = (i * 7919 % 1920).toFloat()
+            xforms[i * 4 + 3] = (i * 104729 % 1080).toFloat()
+            val sprite = i % (spritesPerRow * spritesPerRow)
+            texRects[i * 4] = (sprite % spritesPerRow * spriteSize).toFloat()
+            texRects[i * 4 + 1] = (sprite / spritesPerRow * spriteSize).toFloat()
+            texRects[i * 4 + 2] = texRects[i * 4] + spriteSize
+            texRects[i * 4 + 3] = texRects[i * 4 + 1] + spriteSize
+        }
+
+        val surface = Surface.makeRasterN32Premul(1920, 1080)
+        printTimings("drawImageRect", measureIterations(5) {
+            for (i in 0 until count) {
+                // drawImageRect can't rotate, translate and scale only for a rough baseline
+                val scale = 0.5f + (i % 10) / 10f
+                val x = xforms[i * 4 + 2]
+                val y = xforms[i * 4 + 3]
+                surface.canvas.drawImageRect(
+                    atlas,
+                    Rect(texRects[i * 4], texRects[i * 4 + 1], texRects[i * 4 + 2], texRects[i * 4 + 3]),
+                    Rect(x, y, x + spriteSize * scale, y + spriteSize * scale)
+                )
+            }
+        })
+        printTimings("drawAtlas", measureIterations(5) {
+            surface.canvas.drawAtlas(atlas, xforms, texRects)
+        })
+    }
+}
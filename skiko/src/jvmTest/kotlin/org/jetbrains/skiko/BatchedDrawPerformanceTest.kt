@@ -0,0 +1,59 @@
+package org.jetbrains.skiko
+
+import org.jetbrains.skia.Color
+import org.jetbrains.skia.Paint
+import org.jetbrains.skia.PictureRecorder
+import org.jetbrains.skia.Rect
+import org.jetbrains.skia.Surface
+import org.jetbrains.skiko.util.measureIterations
+import org.jetbrains.skiko.util.performanceTest
+import org.jetbrains.skiko.util.printTimings
+import kotlin.test.Test
+
+class BatchedDrawPerformanceTest {
+    private val count = 50_000
+    private val size = 1024
+
+    private val rects = FloatArray(count * 4).also {
+        for (i in 0 until count) {
+            val x = (i * 7919 % size).toFloat()
+            val y = (i * 104729 % size).toFloat()
+            it[i * 4] = x
+            it[i * 4 + 1] = y
+            it[i * 4 + 2] = x + 4f
+            it[i * 4 + 3] = y + 4f
+        }
+    }
+    private val colors = IntArray(count) { Color.makeARGB(255, it % 256, 128, 255 - it % 256) }
+
+    @Test
+    fun `draw 50k rects`() = performanceTest {
+        val surface = Surface.makeRasterN32Premul(size, size)
+        val paint = Paint()
+
+        printTimings("raster drawRect", measureIterations(20) {
+            for (i in 0 until count) {
+                paint.color = colors[i]
+                surface.canvas.drawRect(Rect(rects[i * 4], rects[i * 4 + 1], rects[i * 4 + 2], rects[i * 4 + 3]), paint)
+            }
+        })
+        printTimings("raster drawRects", measureIterations(20) {
+            surface.canvas.drawRects(rects, paint, colors)
+        })
+
+        val recorder = PictureRecorder()
+        val bounds = Rect(0f, 0f, size.toFloat(), size.toFloat())
+        printTimings("record drawRect", measureIterations(20) {
+            val canvas = recorder.beginRecording(bounds)
+            for (i in 0 until count) {
+                paint.color = colors[i]
+                canvas.drawRect(Rect(rects[i * 4], rects[i * 4 + 1], rects[i * 4 + 2], rects[i * 4 + 3]), paint)
+            }
+            recorder.finishRecordingAsPicture().close()
+        })
+        printTimings("record drawRects", measureIterations(20) {
+            recorder.beginRecording(bounds).drawRects(rects, paint, colors)
+            recorder.finishRecordingAsPicture().close()
+        })
+    }
+}
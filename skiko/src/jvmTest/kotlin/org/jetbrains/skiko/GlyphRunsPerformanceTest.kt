@@ -0,0 +1,51 @@
+package org.jetbrains.skiko
+
+import org.jetbrains.skia.Font
+import org.jetbrains.skia.Paint
+import org.jetbrains.skia.Surface
+import org.jetbrains.skia.TextBlob
+import org.jetbrains.skia.Typeface
+import org.jetbrains.skia.makeFromFile
+import org.jetbrains.skiko.util.measureIterations
+import org.jetbrains.skiko.util.performanceTest
+import org.jetbrains.skiko.util.printTimings
+import kotlin.test.Test
+
+class GlyphRunsPerformanceTest {
+    @Test
+    fun `draw 10k labels`() = performanceTest {
+        val font = Font(Typeface.makeFromFile(resourcePath("fonts/Inter-Hinted-Regular.ttf")), 11f)
+        val count = 10_000
+        val glyphs = Array(count) { font.getStringGlyphs((it * 37 % 1000).toString()) }
+        val xpos = glyphs.map { font.getXPositions(it) }
+        val surface = Surface.makeRasterN32Premul(1920, 1080)
+        val paint = Paint()
+
+        printTimings("TextBlob per label", measureIterations(10) {
+            for (i in 0 until count) {
+                TextBlob.makeFromPosH(glyphs[i], xpos[i], 0f, font)?.use {
+                    surface.canvas.drawTextBlob(it, (i % 60) * 32f, (i / 60) * 6f, paint)
+                }
+            }
+        })
+
+        printTimings("drawGlyphRuns", measureIterations(10) {
+            val total = glyphs.sumOf { it.size }
+            val allGlyphs = ShortArray(total)
+            val positions = FloatArray(total * 2)
+            val runOffsets = IntArray(count)
+            val origins = FloatArray(count * 2)
+            var offset = 0
+            for (i in 0 until count) {
+                runOffsets[i] = offset
+                glyphs[i].copyInto(allGlyphs, offset)
+                for (j in glyphs[i].indices)
+                    positions[(offset + j) * 2] = xpos[i][j]
+                origins[i * 2] = (i % 60) * 32f
+                origins[i * 2 + 1] = (i / 60) * 6f
+                offset += glyphs[i].size
+            }
+            surface.canvas.drawGlyphRuns(font, allGlyphs, positions, runOffsets, origins, paint)
+        })
+    }
+}
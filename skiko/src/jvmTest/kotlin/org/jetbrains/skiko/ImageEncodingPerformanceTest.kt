@@ -0,0 +1,64 @@
+package org.jetbrains.skiko
+
+import org.jetbrains.skia.Color
+import org.jetbrains.skia.EncodePreset
+import org.jetbrains.skia.EncodedImageFormat
+import org.jetbrains.skia.GradientStyle
+import org.jetbrains.skia.Image
+import org.jetbrains.skia.OutputWStream
+import org.jetbrains.skia.Paint
+import org.jetbrains.skia.Point
+import org.jetbrains.skia.Shader
+import org.jetbrains.skia.Surface
+import org.jetbrains.skiko.util.measureIterations
+import org.jetbrains.skiko.util.performanceTest
+import org.jetbrains.skiko.util.printTimings
+import java.io.OutputStream
+import kotlin.test.Test
+
+class ImageEncodingPerformanceTest {
+    private class CountingOutputStream : OutputStream() {
+        var count = 0L
+        override fun write(b: Int) { count++ }
+        override fun write(b: ByteArray, off: Int, len: Int) { count += len }
+    }
+
+    // 8K frame with content that compresses neither too well nor too badly
+    private fun screenshotLikeImage(): Image {
+        return Surface.makeRasterN32Premul(7680, 4320).use { surface ->
+            val paint = Paint().apply {
+                shader = Shader.makeLinearGradient(
+                    Point(0f, 0f), Point(7680f, 4320f),
+                    intArrayOf(Color.RED, Color.GREEN, Color.BLUE, Color.WHITE),
+                    null, GradientStyle.DEFAULT
+                )
+            }
+            surface.canvas.drawPaint(paint)
+            val textPaint = Paint().apply { color = Color.BLACK }
+            for (i in 0 until 2000) {
+                surface.canvas.drawCircle((i * 37 % 7680).toFloat(), (i * 53 % 4320).toFloat(), (i % 40).toFloat(), textPaint)
+            }
+            surface.makeImageSnapshot()
+        }
+    }
+
+    @Test
+    fun `encode 8K PNG`() = performanceTest {
+        val image = screenshotLikeImage()
+
+        var size = 0
+        printTimings("encodeToData", measureIterations(5) {
+            size = image.encodeToData(EncodedImageFormat.PNG)!!.size
+        })
+        println("encodeToData size $size")
+
+        for (preset in EncodePreset.values()) {
+            val out = CountingOutputStream()
+            printTimings("encodeToStream $preset", measureIterations(5) {
+                out.count = 0
+                OutputWStream(out).use { image.encodeToStream(it, EncodedImageFormat.PNG, 100, preset) }
+            })
+            println("encodeToStream $preset size ${out.count}")
+        }
+    }
+}
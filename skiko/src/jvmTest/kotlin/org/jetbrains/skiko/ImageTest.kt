@@ -1,12 +1,22 @@
 package org.jetbrains.skiko
 
+import org.jetbrains.skia.Color
+import org.jetbrains.skia.EncodePreset
 import org.jetbrains.skia.EncodedImageFormat
+import org.jetbrains.skia.GradientStyle
+import org.jetbrains.skia.Image
+import org.jetbrains.skia.OutputWStream
 import org.jetbrains.skia.Paint
 import org.jetbrains.skia.Path
+import org.jetbrains.skia.Point
+import org.jetbrains.skia.Shader
 import org.jetbrains.skia.Surface
+import org.jetbrains.skiko.util.isContentSame
+import java.io.ByteArrayOutputStream
 import java.io.File
 import java.nio.file.Files
 import kotlin.test.Test
+import kotlin.test.assertTrue
 import java.nio.file.Path as FilePath
 
 class ImageTest  {
@@ -44,4 +54,48 @@ class ImageTest  {
             }
         }
     }
-}
\ No newline at end of file
+
+    private fun gradientImage(width: Int, height: Int, opaque: Boolean): Image {
+        return Surface.makeRasterN32Premul(width, height).use { surface ->
+            val colors = if (opaque) {
+                intArrayOf(Color.RED, Color.GREEN, Color.BLUE)
+            } else {
+                intArrayOf(0x80FF0000.toInt(), 0x2000FF00, 0xF00000FF.toInt())
+            }
+            val paint = Paint().apply {
+                shader = Shader.makeLinearGradient(
+                    Point(0f, 0f), Point(width.toFloat(), height.toFloat()), colors, null, GradientStyle.DEFAULT
+                )
+            }
+            surface.canvas.drawPaint(paint)
+            surface.makeImageSnapshot()
+        }
+    }
+
+    private fun encodeToBytes(image: Image, preset: EncodePreset): ByteArray {
+        val out = ByteArrayOutputStream()
+        OutputWStream(out).use { stream ->
+            assertTrue(image.encodeToStream(stream, EncodedImageFormat.PNG, 100, preset))
+        }
+        return out.toByteArray()
+    }
+
+    @Test
+    fun encodeToStreamRoundTrip() {
+        for (opaque in listOf(true, false)) {
+            for (preset in EncodePreset.values()) {
+                // Tall enough to be split into several bands and several waves of bands
+                val image = gradientImage(1500, 2000, opaque)
+                val decoded = Image.makeFromEncoded(encodeToBytes(image, preset))
+                assertTrue(isContentSame(image, decoded, 0.01), "opaque=$opaque, preset=$preset")
+            }
+        }
+    }
+
+    @Test
+    fun encodeToStreamSmallImage() {
+        val image = gradientImage(1, 1, false)
+        val decoded = Image.makeFromEncoded(encodeToBytes(image, EncodePreset.DEFAULT))
+        assertTrue(isContentSame(image, decoded, 0.01))
+    }
+}
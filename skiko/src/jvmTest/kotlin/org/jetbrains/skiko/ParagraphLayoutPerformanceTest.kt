@@ -0,0 +1,91 @@
+package org.jetbrains.skiko
+
+import org.jetbrains.skia.Typeface
+import org.jetbrains.skia.makeFromFile
+import org.jetbrains.skia.paragraph.FontCollection
+import org.jetbrains.skia.paragraph.Paragraph
+import org.jetbrains.skia.paragraph.ParagraphBuilder
+import org.jetbrains.skia.paragraph.ParagraphStyle
+import org.jetbrains.skia.paragraph.TextStyle
+import org.jetbrains.skia.paragraph.TypefaceFontProvider
+import org.jetbrains.skiko.util.measureIterations
+import org.jetbrains.skiko.util.performanceTest
+import org.jetbrains.skiko.util.printTimings
+import kotlin.test.Test
+
+class ParagraphLayoutPerformanceTest {
+    @Test
+    fun `layout 10k paragraphs`() = performanceTest {
+        val fontCollection = FontCollection().setDefaultFontManager(TypefaceFontProvider().apply {
+            registerTypeface(Typeface.makeFromFile(resourcePath("fonts/Inter-Hinted-Regular.ttf")), "Inter")
+        })
+        // Measure shaping too, not only line breaking of cached results
+        fontCollection.paragraphCache.setEnabled(false)
+        val style = ParagraphStyle().apply {
+            textStyle = TextStyle().apply {
+                fontFamilies = arrayOf("Inter")
+                fontSize = 14f
+            }
+        }
+        val count = 10_000
+        val paragraphs = Array(count) { i ->
+            ParagraphBuilder(style, fontCollection).use {
+                it.addText("Paragraph $i. " + "The quick brown fox jumps over the lazy dog. ".repeat(i % 10 + 1))
+                it.build()
+            }
+        }
+        val widths = FloatArray(count) { 400f }
+
+        printTimings("layout one by one", measureIterations(5) {
+            for (i in 0 until count) paragraphs[i].markDirty().layout(widths[i])
+        })
+
+        printTimings("layoutAll", measureIterations(5) {
+            for (paragraph in paragraphs) paragraph.markDirty()
+            Paragraph.layoutAll(paragraphs, widths)
+        })
+    }
+
+    @Test
+    fun `build paragraph with 10k style spans`() = performanceTest {
+        val fontCollection = FontCollection().setDefaultFontManager(TypefaceFontProvider().apply {
+            registerTypeface(Typeface.makeFromFile(resourcePath("fonts/Inter-Hinted-Regular.ttf")), "Inter")
+        })
+        val style = ParagraphStyle()
+        val styles = Array(4) { i ->
+            TextStyle().apply {
+                fontFamilies = arrayOf("Inter")
+                fontSize = 12f
+                color = 0xFF000000.toInt() or (i * 0x3F3F3F)
+            }
+        }
+        val tokens = List(10_000) { i -> "token$i" }
+        val text = tokens.joinToString(" ")
+        val starts = IntArray(tokens.size)
+        val ends = IntArray(tokens.size)
+        var offset = 0
+        for (i in tokens.indices) {
+            starts[i] = offset
+            ends[i] = offset + tokens[i].length
+            offset = ends[i] + 1
+        }
+        val spanStyles = Array(tokens.size) { styles[it % styles.size] }
+
+        printTimings("pushStyle/addText/popStyle", measureIterations(10) {
+            ParagraphBuilder(style, fontCollection).use { builder ->
+                for (i in tokens.indices) {
+                    builder.pushStyle(spanStyles[i]).addText(tokens[i]).popStyle()
+                    builder.addText(" ")
+                }
+                builder.build().close()
+            }
+        })
+
+        printTimings("addStyledText", measureIterations(10) {
+            ParagraphBuilder(style, fontCollection).use { builder ->
+                builder.addStyledText(text, starts, ends, spanStyles)
+                builder.build().close()
+            }
+        })
+    }
+}
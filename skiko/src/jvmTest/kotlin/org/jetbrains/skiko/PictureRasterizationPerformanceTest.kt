@@ -0,0 +1,68 @@
+package org.jetbrains.skiko
+
+import org.jetbrains.skia.Color
+import org.jetbrains.skia.Data
+import org.jetbrains.skia.ImageInfo
+import org.jetbrains.skia.Paint
+import org.jetbrains.skia.PaintMode
+import org.jetbrains.skia.Path
+import org.jetbrains.skia.Picture
+import org.jetbrains.skia.PictureRecorder
+import org.jetbrains.skia.Pixmap
+import org.jetbrains.skia.Point
+import org.jetbrains.skia.Rect
+import org.jetbrains.skia.Shader
+import org.jetbrains.skia.Surface
+import org.jetbrains.skiko.util.measureIterations
+import org.jetbrains.skiko.util.performanceTest
+import org.jetbrains.skiko.util.printTimings
+import kotlin.test.Test
+
+class PictureRasterizationPerformanceTest {
+    // Map-tile-like content: a lot of antialiased strokes and fills over a gradient
+    private fun makePicture(width: Float, height: Float): Picture {
+        val recorder = PictureRecorder()
+        val canvas = recorder.beginRecording(Rect(0f, 0f, width, height))
+        canvas.drawPaint(Paint().apply {
+            shader = Shader.makeLinearGradient(Point(0f, 0f), Point(width, height), intArrayOf(Color.WHITE, Color.CYAN))
+        })
+        val stroke = Paint().apply {
+            mode = PaintMode.STROKE
+            strokeWidth = 2.5f
+        }
+        val fill = Paint()
+        for (i in 0 until 5000) {
+            val x = (i * 7919 % width.toInt()).toFloat()
+            val y = (i * 104729 % height.toInt()).toFloat()
+            stroke.color = Color.makeARGB(200, i % 256, 64, 255 - i % 256)
+            canvas.drawPath(Path().moveTo(x, y).cubicTo(x + 80f, y - 40f, x - 40f, y + 90f, x + 120f, y + 60f), stroke)
+            fill.color = Color.makeARGB(90, 255 - i % 256, i % 256, 32)
+            canvas.drawCircle(x, y, (i % 30).toFloat(), fill)
+        }
+        return recorder.finishRecordingAsPicture()
+    }
+
+    @Test
+    fun `rasterize 4K picture`() = performanceTest {
+        val info = ImageInfo.makeN32Premul(3840, 2160)
+        val picture = makePicture(3840f, 2160f)
+        val pixmap = Pixmap.make(info, Data.makeUninitialized(info.computeMinByteSize()), info.minRowBytes)
+
+        val surface = Surface.makeRasterDirect(pixmap)
+        printTimings("playback", measureIterations(5) {
+            surface.canvas.clear(Color.TRANSPARENT)
+            picture.playback(surface.canvas)
+        })
+
+        val cores = Runtime.getRuntime().availableProcessors()
+        var threads = 1
+        while (true) {
+            printTimings("playbackTiled threads=$threads", measureIterations(5) {
+                pixmap.erase(Color.TRANSPARENT)
+                picture.playbackTiled(pixmap, maxThreads = threads)
+            })
+            if (threads >= cores) break
+            threads = minOf(threads * 2, cores)
+        }
+    }
+}
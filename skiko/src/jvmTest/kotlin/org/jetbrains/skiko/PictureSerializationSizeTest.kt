@@ -0,0 +1,57 @@
+package org.jetbrains.skiko
+
+import org.jetbrains.skia.Color
+import org.jetbrains.skia.Font
+import org.jetbrains.skia.Paint
+import org.jetbrains.skia.Picture
+import org.jetbrains.skia.PictureRecorder
+import org.jetbrains.skia.PictureResourceStore
+import org.jetbrains.skia.Rect
+import org.jetbrains.skia.Surface
+import org.jetbrains.skia.Typeface
+import org.jetbrains.skia.makeFromFile
+import org.jetbrains.skiko.util.performanceTest
+import kotlin.test.Test
+
+class PictureSerializationSizeTest {
+    // Cached-tile-like frames: the same fonts and icons drawn with different text
+    private fun makeFrames(count: Int): List<Picture> {
+        val fonts = listOf(
+            Font(Typeface.makeFromFile(resourcePath("fonts/Inter-Hinted-Regular.ttf")), 14f),
+            Font(Typeface.makeFromFile(resourcePath("fonts/JetBrainsMono-Regular.ttf")), 12f)
+        )
+        val icons = (0 until 4).map { i ->
+            val surface = Surface.makeRasterN32Premul(48, 48)
+            surface.canvas.clear(Color.makeRGB(64 * i, 128, 255 - 64 * i))
+            surface.canvas.drawCircle(24f, 24f, 12f + i, Paint().apply { color = Color.WHITE })
+            surface.makeImageSnapshot()
+        }
+        val paint = Paint().apply { color = Color.BLACK }
+        return List(count) { frame ->
+            val recorder = PictureRecorder()
+            val canvas = recorder.beginRecording(Rect(0f, 0f, 512f, 512f))
+            canvas.clear(Color.WHITE)
+            for (row in 0 until 20) {
+                canvas.drawImage(icons[(frame + row) % icons.size], 4f, row * 24f)
+                canvas.drawString("Tile $frame, row $row: the quick brown fox", 56f, row * 24f + 18f, fonts[row % 2], paint)
+            }
+            recorder.finishRecordingAsPicture()
+        }
+    }
+
+    @Test
+    fun `size of serialized frames`() = performanceTest {
+        val frames = makeFrames(50)
+        val standalone = frames.sumOf { it.serializeToData().size.toLong() }
+
+        val store = PictureResourceStore()
+        val referencing = frames.sumOf { it.serializeToData(store).size.toLong() }
+        val stats = store.stats
+
+        println("${frames.size} frames, ${stats.typefaces} typefaces, ${stats.images} images")
+        println("standalone:  ${standalone / 1024} KB")
+        println("with store:  ${referencing / 1024} KB + ${stats.storedBytes / 1024} KB store")
+        println("saved:       ${(standalone - referencing - stats.storedBytes) / 1024} KB " +
+                "(${100 * (standalone - referencing - stats.storedBytes) / standalone}%)")
+    }
+}
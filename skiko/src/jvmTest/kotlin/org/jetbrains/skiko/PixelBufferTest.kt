@@ -0,0 +1,75 @@
+package org.jetbrains.skiko
+
+import org.jetbrains.skia.Bitmap
+import org.jetbrains.skia.Color
+import org.jetbrains.skia.ImageInfo
+import org.jetbrains.skia.Surface
+import org.jetbrains.skia.installPixels
+import org.jetbrains.skia.readPixels
+import org.jetbrains.skia.writePixels
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertTrue
+
+class PixelBufferTest {
+    private val imageInfo = ImageInfo.makeN32Premul(4, 4)
+
+    private fun directBuffer() =
+        ByteBuffer.allocateDirect(imageInfo.computeMinByteSize()).order(ByteOrder.nativeOrder())
+
+    @Test
+    fun surfaceReadWritePixels() {
+        Surface.makeRaster(imageInfo).use { surface ->
+            surface.canvas.clear(Color.RED)
+            val buffer = directBuffer()
+            assertTrue(surface.readPixels(buffer))
+            assertEquals(Color.RED, buffer.getInt(0))
+
+            for (i in 0 until buffer.capacity() / 4) buffer.putInt(i * 4, Color.BLUE)
+            surface.writePixels(buffer)
+            Bitmap.makeFromImage(surface.makeImageSnapshot()).use {
+                assertEquals(Color.BLUE, it.getColor(3, 3))
+            }
+        }
+    }
+
+    @Test
+    fun canvasReadPixels() {
+        Surface.makeRaster(imageInfo).use { surface ->
+            surface.canvas.clear(Color.GREEN)
+            val buffer = directBuffer()
+            assertTrue(surface.canvas.readPixels(buffer, imageInfo))
+            assertEquals(Color.GREEN, buffer.getInt(buffer.capacity() - 4))
+        }
+    }
+
+    @Test
+    fun bitmapSharesDirectBuffer() {
+        val buffer = directBuffer()
+        Bitmap().use { bitmap ->
+            assertTrue(bitmap.installPixels(imageInfo, buffer, imageInfo.minRowBytes))
+            bitmap.erase(Color.MAGENTA)
+            assertEquals(Color.MAGENTA, buffer.getInt(0))
+
+            val copy = directBuffer()
+            assertTrue(bitmap.readPixels(copy))
+            assertEquals(buffer, copy)
+
+            copy.putInt(0, Color.CYAN)
+            assertTrue(bitmap.writePixels(copy))
+            assertEquals(Color.CYAN, bitmap.getColor(0, 0))
+        }
+    }
+
+    @Test
+    fun rejectsSmallBuffer() {
+        Surface.makeRaster(imageInfo).use { surface ->
+            assertFailsWith<IllegalArgumentException> {
+                surface.readPixels(ByteBuffer.allocateDirect(4))
+            }
+        }
+    }
+}
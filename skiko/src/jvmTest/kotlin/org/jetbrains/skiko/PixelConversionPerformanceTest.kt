@@ -0,0 +1,44 @@
+package org.jetbrains.skiko
+
+import org.jetbrains.skia.ColorAlphaType
+import org.jetbrains.skia.ColorType
+import org.jetbrains.skia.Data
+import org.jetbrains.skia.ImageInfo
+import org.jetbrains.skia.Pixmap
+import org.jetbrains.skiko.util.measureIterations
+import org.jetbrains.skiko.util.performanceTest
+import org.jetbrains.skiko.util.printTimings
+import kotlin.test.Test
+
+class PixelConversionPerformanceTest {
+    private fun makePixmap(info: ImageInfo): Pixmap {
+        val pixmap = Pixmap.make(info, Data.makeUninitialized(info.computeMinByteSize()), info.minRowBytes)
+        pixmap.erase(0x80402010.toInt())
+        return pixmap
+    }
+
+    @Test
+    fun `convert 4K frame`() = performanceTest {
+        val width = 3840
+        val height = 2160
+        val src = makePixmap(ImageInfo(width, height, ColorType.BGRA_8888, ColorAlphaType.PREMUL))
+        val targets = listOf(
+            ImageInfo(width, height, ColorType.RGBA_8888, ColorAlphaType.PREMUL),
+            ImageInfo(width, height, ColorType.RGBA_8888, ColorAlphaType.UNPREMUL),
+            ImageInfo(width, height, ColorType.RGB_565, ColorAlphaType.OPAQUE),
+            ImageInfo.makeA8(width, height)
+        )
+
+        for (info in targets) {
+            val dst = makePixmap(info)
+            val name = "${info.colorInfo.colorType} ${info.colorInfo.alphaType}"
+            val bytes = src.computeByteSize().toDouble()
+
+            val readTimings = measureIterations(10) { src.readPixels(dst) }
+            printTimings("readPixels $name", readTimings)
+            val convertTimings = measureIterations(10) { src.convertPixels(dst) }
+            printTimings("convertPixels $name", convertTimings)
+            println("convertPixels $name: ${String.format("%.2f", bytes / convertTimings.minOrNull()!!)} GB/s")
+        }
+    }
+}
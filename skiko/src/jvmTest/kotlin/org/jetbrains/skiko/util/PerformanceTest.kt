@@ -0,0 +1,30 @@
+package org.jetbrains.skiko.util
+
+import org.junit.Assume.assumeTrue
+
+/**
+ * Runs block only when performance tests are enabled with -Dskiko.test.performance.enabled=true,
+ * so that timing-sensitive benchmarks don't slow down or destabilize regular test runs.
+ */
+internal fun performanceTest(block: () -> Unit) {
+    assumeTrue(System.getProperty("skiko.test.performance.enabled", "false") == "true")
+    block()
+}
+
+/**
+ * Measures block after warmup and returns duration of every iteration in nanoseconds.
+ */
+internal fun measureIterations(iterations: Int, warmup: Int = 2, block: () -> Unit): List<Long> {
+    repeat(warmup) { block() }
+    return List(iterations) {
+        val start = System.nanoTime()
+        block()
+        System.nanoTime() - start
+    }
+}
+
+internal fun printTimings(name: String, timings: List<Long>) {
+    val sorted = timings.sorted()
+    val millis = { nanos: Long -> String.format("%.2f", nanos / 1E6) }
+    println("[$name] min ${millis(sorted.first())} ms, median ${millis(sorted[sorted.size / 2])} ms, max ${millis(sorted.last())} ms")
+}
@@ -5,6 +5,7 @@
 #include "SkPixelRef.h"
 #include "SkSamplingOptions.h"
 #include "SkShader.h"
+#include "PixelConverter.hh"
 #include "common.h"
 
 static void deleteBitmap(SkBitmap* instance) {
@@ -162,6 +163,13 @@ SKIKO_EXPORT KBoolean org_jetbrains_skia_Bitmap__1nInstallPixels
   return instance->installPixels(imageInfo, copy, rowBytes, deletePixelsBytes, nullptr);
 }
 
+SKIKO_EXPORT KBoolean org_jetbrains_skia_Bitmap__1nInstallPixelsFromPixmap
+  (KNativePointer ptr, KNativePointer pixmapPtr) {
+  SkBitmap* instance = reinterpret_cast<SkBitmap*>(ptr);
+  SkPixmap* pixmap = reinterpret_cast<SkPixmap*>(pixmapPtr);
+  return instance->installPixels(*pixmap);
+}
+
 SKIKO_EXPORT KBoolean org_jetbrains_skia_Bitmap__1nAllocPixels
   (KNativePointer ptr) {
     SkBitmap* instance = reinterpret_cast<SkBitmap*>((ptr));
@@ -260,6 +268,27 @@ SKIKO_EXPORT KBoolean org_jetbrains_skia_Bitmap__1nReadPixels
     }
 }
 
+SKIKO_EXPORT KBoolean org_jetbrains_skia_Bitmap__1nReadPixelsToPixmap
+  (KNativePointer ptr, KNativePointer pixmapPtr, KInt srcX, KInt srcY) {
+    SkBitmap* instance = reinterpret_cast<SkBitmap*>(ptr);
+    SkPixmap* pixmap = reinterpret_cast<SkPixmap*>(pixmapPtr);
+    return instance->readPixels(*pixmap, srcX, srcY);
+}
+
+SKIKO_EXPORT KBoolean org_jetbrains_skia_Bitmap__1nWritePixelsFromPixmap
+  (KNativePointer ptr, KNativePointer pixmapPtr, KInt dstX, KInt dstY) {
+    SkBitmap* instance = reinterpret_cast<SkBitmap*>(ptr);
+    SkPixmap* pixmap = reinterpret_cast<SkPixmap*>(pixmapPtr);
+    return instance->writePixels(*pixmap, dstX, dstY);
+}
+
+SKIKO_EXPORT KBoolean org_jetbrains_skia_Bitmap__1nConvertPixels
+  (KNativePointer ptr, KNativePointer pixmapPtr) {
+    SkBitmap* instance = reinterpret_cast<SkBitmap*>(ptr);
+    SkPixmap* pixmap = reinterpret_cast<SkPixmap*>(pixmapPtr);
+    return skikoMpp::pixels::convert(instance->pixmap(), *pixmap);
+}
+
 SKIKO_EXPORT KBoolean org_jetbrains_skia_Bitmap__1nExtractAlpha
   (KNativePointer ptr, KNativePointer dstPtr, KNativePointer paintPtr, KInt* result) {
 
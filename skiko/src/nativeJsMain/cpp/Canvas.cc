@@ -3,9 +3,14 @@
 
 #include <iostream>
 #include "SkCanvas.h"
+#include "SkFont.h"
+#include "SkPixmap.h"
 #include "SkRRect.h"
+#include "SkRSXform.h"
 #include "SkTextBlob.h"
 #include "SkVertices.h"
+#include "BatchedDraws.hh"
+#include "VerticesBuffer.hh"
 #include "hb.h"
 #include "common.h"
 
@@ -87,6 +92,27 @@ SKIKO_EXPORT void org_jetbrains_skia_Canvas__1nDrawDRRect
         skija::RRect::toSkRRect(il, it, ir, ib, ijradii, ijradiiSize), *paint);
 }
 
+SKIKO_EXPORT void org_jetbrains_skia_Canvas__1nDrawRects
+  (KNativePointer canvasPtr, KFloat* rects, KInt* colors, KInt count, KNativePointer paintPtr) {
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(canvasPtr);
+    SkPaint* paint = reinterpret_cast<SkPaint*>(paintPtr);
+    skikoMpp::batch::drawRects(canvas, rects, reinterpret_cast<SkColor*>(colors), count, *paint);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_Canvas__1nDrawRRects
+  (KNativePointer canvasPtr, KFloat* rrects, KInt* colors, KInt count, KNativePointer paintPtr) {
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(canvasPtr);
+    SkPaint* paint = reinterpret_cast<SkPaint*>(paintPtr);
+    skikoMpp::batch::drawRRects(canvas, rrects, reinterpret_cast<SkColor*>(colors), count, *paint);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_Canvas__1nDrawCircles
+  (KNativePointer canvasPtr, KFloat* circles, KInt* colors, KInt count, KNativePointer paintPtr) {
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(canvasPtr);
+    SkPaint* paint = reinterpret_cast<SkPaint*>(paintPtr);
+    skikoMpp::batch::drawCircles(canvas, circles, reinterpret_cast<SkColor*>(colors), count, *paint);
+}
+
 SKIKO_EXPORT void org_jetbrains_skia_Canvas__1nDrawPath
   (KNativePointer canvasPtr, KNativePointer pathPtr, KNativePointer paintPtr) {
     SkCanvas* canvas = reinterpret_cast<SkCanvas*>((canvasPtr));
@@ -106,6 +132,23 @@ SKIKO_EXPORT void org_jetbrains_skia_Canvas__1nDrawImageRect
     canvas->drawImageRect(image, src, dst, skija::SamplingMode::unpackFrom2Ints(samplingModeVal1, samplingModeVal2), paint, constraint);
 }
 
+SKIKO_EXPORT void org_jetbrains_skia_Canvas__1nDrawAtlas
+  (KNativePointer canvasPtr, KNativePointer imagePtr, KFloat* xforms, KFloat* texRects, KInt* colors, KInt count, KInt blendMode, KInt samplingModeVal1, KInt samplingModeVal2, KFloat* cullRect, KNativePointer paintPtr) {
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(canvasPtr);
+    SkImage* image = reinterpret_cast<SkImage*>(imagePtr);
+    SkPaint* paint = reinterpret_cast<SkPaint*>(paintPtr);
+    // SkRSXform and SkRect are both 4 packed floats, arrays are passed to Skia as is
+    canvas->drawAtlas(image,
+                      reinterpret_cast<const SkRSXform*>(xforms),
+                      reinterpret_cast<const SkRect*>(texRects),
+                      reinterpret_cast<const SkColor*>(colors),
+                      count,
+                      static_cast<SkBlendMode>(blendMode),
+                      skija::SamplingMode::unpackFrom2Ints(samplingModeVal1, samplingModeVal2),
+                      reinterpret_cast<const SkRect*>(cullRect),
+                      paint);
+}
+
 SKIKO_EXPORT void org_jetbrains_skia_Canvas__1nDrawImageNine
   (KNativePointer canvasPtr, KNativePointer imagePtr, KInt cl, KInt ct, KInt cr, KInt cb, KFloat dl, KFloat dt, KFloat dr, KFloat db, KInt filterMode, KNativePointer paintPtr) {
     SkCanvas* canvas = reinterpret_cast<SkCanvas*>((canvasPtr));
@@ -145,6 +188,16 @@ SKIKO_EXPORT void org_jetbrains_skia_Canvas__1nDrawTextBlob
 }
 
 
+SKIKO_EXPORT void org_jetbrains_skia_Canvas__1nDrawGlyphRuns
+  (KNativePointer canvasPtr, KNativePointer fontPtr, KShort* glyphs, KFloat* positions, KInt glyphCount, KInt* runOffsets, KFloat* origins, KInt runCount, KNativePointer paintPtr) {
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(canvasPtr);
+    SkFont* font = reinterpret_cast<SkFont*>(fontPtr);
+    SkPaint* paint = reinterpret_cast<SkPaint*>(paintPtr);
+    sk_sp<SkTextBlob> blob = skikoMpp::batch::makeGlyphRuns(*font, reinterpret_cast<SkGlyphID*>(glyphs), positions, glyphCount, runOffsets, origins, runCount);
+    if (blob)
+        canvas->drawTextBlob(blob, 0, 0, *paint);
+}
+
 SKIKO_EXPORT void org_jetbrains_skia_Canvas__1nDrawPicture
   (KNativePointer ptr, KNativePointer picturePtr, KFloat* matrixArr, KNativePointer paintPtr) {
     SkCanvas* canvas   = reinterpret_cast<SkCanvas*>   ((ptr));
@@ -175,6 +228,14 @@ SKIKO_EXPORT void org_jetbrains_skia_Canvas__1nDrawVertices
     canvas->drawVertices(vertices, static_cast<SkBlendMode>(blendMode), *paint);
 }
 
+SKIKO_EXPORT void org_jetbrains_skia_Canvas__1nDrawVerticesObject
+  (KNativePointer ptr, KNativePointer verticesPtr, KInt blendMode, KNativePointer paintPtr) {
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(ptr);
+    VerticesBuffer* vertices = reinterpret_cast<VerticesBuffer*>(verticesPtr);
+    SkPaint* paint = reinterpret_cast<SkPaint*>(paintPtr);
+    canvas->drawVertices(vertices->vertices(), static_cast<SkBlendMode>(blendMode), *paint);
+}
+
 SKIKO_EXPORT void org_jetbrains_skia_Canvas__1nDrawPatch
   (KNativePointer ptr, KFloat* cubicsArr, KInt* colorsArr, KFloat* texCoordsArr, KInt blendMode, KNativePointer paintPtr) {
     SkCanvas* canvas = reinterpret_cast<SkCanvas*>(ptr);
@@ -286,6 +347,20 @@ SKIKO_EXPORT KInt org_jetbrains_skia_Canvas__1nWritePixels
     return canvas->writePixels(*bitmap, x, y);
 }
 
+SKIKO_EXPORT KBoolean org_jetbrains_skia_Canvas__1nReadPixelsToPixmap
+  (KNativePointer ptr, KNativePointer pixmapPtr, KInt srcX, KInt srcY) {
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(ptr);
+    SkPixmap* pixmap = reinterpret_cast<SkPixmap*>(pixmapPtr);
+    return canvas->readPixels(*pixmap, srcX, srcY);
+}
+
+SKIKO_EXPORT KBoolean org_jetbrains_skia_Canvas__1nWritePixelsFromPixmap
+  (KNativePointer ptr, KNativePointer pixmapPtr, KInt x, KInt y) {
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(ptr);
+    SkPixmap* pixmap = reinterpret_cast<SkPixmap*>(pixmapPtr);
+    return canvas->writePixels(pixmap->info(), pixmap->addr(), pixmap->rowBytes(), x, y);
+}
+
 SKIKO_EXPORT KInt org_jetbrains_skia_Canvas__1nSave(KNativePointer ptr) {
     return reinterpret_cast<SkCanvas*>((ptr))->save();
 }
@@ -2,9 +2,11 @@
 // This file has been auto generated.
 
 #include <iostream>
+#include <vector>
 #include "SkFont.h"
 #include "SkPath.h"
 #include "SkShaper.h"
+#include "GlyphPathCache.hh"
 #include "common.h"
 
 static void deleteFont(SkFont* font) {
@@ -297,30 +299,57 @@ SKIKO_EXPORT void org_jetbrains_skia_Font__1nGetXPositions
 SKIKO_EXPORT KNativePointer org_jetbrains_skia_Font__1nGetPath
   (KNativePointer ptr, KShort glyph) {
     SkFont* instance = reinterpret_cast<SkFont*>(ptr);
-    SkPath* path = new SkPath();
-    instance->getPath(glyph, path);
-    return reinterpret_cast<KNativePointer>(path);
+    SkGlyphID glyphID = static_cast<SkGlyphID>(glyph);
+    std::vector<SkPath> paths;
+    std::vector<bool> hasPath;
+    GlyphPathCache::Get().getPaths(*instance, &glyphID, 1, false, &paths, &hasPath);
+    return reinterpret_cast<KNativePointer>(new SkPath(paths[0]));
 }
 
 
 SKIKO_EXPORT KNativePointer org_jetbrains_skia_Font__1nGetPaths
-  (KNativePointer ptr, KShort* glyphs, KInt count) {
+  (KNativePointer ptr, KShort* glyphs, KInt count, KBoolean parallel) {
+    SkFont* instance = reinterpret_cast<SkFont*>(ptr);
+    std::vector<SkPath> paths;
+    std::vector<bool> hasPath;
+    GlyphPathCache::Get().getPaths(*instance, reinterpret_cast<SkGlyphID*>(glyphs), count, parallel, &paths, &hasPath);
+
+    std::vector<KNativePointer>* result = new std::vector<KNativePointer>();
+    for (int i = 0; i < count; ++i) {
+        // Copies share point data with the cache until either side is modified
+        if (hasPath[i])
+            result->push_back(reinterpret_cast<KNativePointer>(new SkPath(paths[i])));
+    }
+    return reinterpret_cast<KNativePointer>(result);
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_Font__1nGetPathsCombined
+  (KNativePointer ptr, KShort* glyphs, KInt count, KFloat* positions, KBoolean parallel, KInt* verbOffsets) {
     SkFont* instance = reinterpret_cast<SkFont*>(ptr);
+    SkPath* path = new SkPath();
+    GlyphPathCache::Get().getCombinedPath(*instance, reinterpret_cast<SkGlyphID*>(glyphs), count, positions, parallel, path, verbOffsets);
+    return reinterpret_cast<KNativePointer>(path);
+}
 
-    struct Ctx {
-        std::vector<KNativePointer>* paths;
-    } ctx = { new std::vector<KNativePointer>() };
+SKIKO_EXPORT void org_jetbrains_skia_Font__1nGetPathCacheStats
+  (KInt* result) {
+    GlyphPathCache::Stats stats = GlyphPathCache::Get().getStats();
+    result[0] = stats.fHits;
+    result[1] = stats.fMisses;
+    result[2] = stats.fEvictions;
+    result[3] = stats.fCount;
+    result[4] = static_cast<KInt>(stats.fBytesUsed);
+    result[5] = static_cast<KInt>(stats.fByteBudget);
+}
 
-    instance->getPaths(reinterpret_cast<SkGlyphID*>(glyphs), count, [](const SkPath* orig, const SkMatrix& mx, void* voidCtx) {
-        Ctx* ctx = static_cast<Ctx*>(voidCtx);
-        if (orig) {
-            SkPath* path = new SkPath();
-            orig->transform(mx, path);
-            ctx->paths->push_back(reinterpret_cast<KNativePointer>(path));
-        }
-    }, &ctx);
+SKIKO_EXPORT void org_jetbrains_skia_Font__1nSetPathCacheByteBudget
+  (KInt byteBudget) {
+    GlyphPathCache::Get().setByteBudget(byteBudget);
+}
 
-    return reinterpret_cast<KNativePointer>(ctx.paths);
+SKIKO_EXPORT void org_jetbrains_skia_Font__1nPurgePathCache
+  () {
+    GlyphPathCache::Get().purgeAll();
 }
 
 SKIKO_EXPORT void org_jetbrains_skia_Font__1nGetMetrics
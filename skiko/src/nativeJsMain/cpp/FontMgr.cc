@@ -5,6 +5,7 @@
 #include "SkData.h"
 #include "SkTypeface.h"
 #include "SkFontMgr.h"
+#include "FontIndex.hh"
 #include "common.h"
 
 SKIKO_EXPORT KInt org_jetbrains_skia_FontMgr__1nGetFamiliesCount
@@ -72,6 +73,16 @@ SKIKO_EXPORT KNativePointer org_jetbrains_skia_FontMgr__1nMakeFromData
 
 SKIKO_EXPORT KNativePointer org_jetbrains_skia_FontMgr__1nDefault
   () {
-    SkFontMgr* instance = SkFontMgr::RefDefault().release();
+    SkFontMgr* instance = FontIndex::Default().release();
     return reinterpret_cast<KNativePointer>(instance);
 }
+
+SKIKO_EXPORT KBoolean org_jetbrains_skia_FontMgr__1nLoadIndex
+  (KInteropPointer pathStr) {
+    return FontIndex::Default()->load(skString(pathStr).c_str());
+}
+
+SKIKO_EXPORT KBoolean org_jetbrains_skia_FontMgr__1nSaveIndex
+  (KInteropPointer pathStr) {
+    return FontIndex::Default()->save(skString(pathStr).c_str());
+}
@@ -0,0 +1,44 @@
+#include "SkCanvas.h"
+#include "SkPicture.h"
+#include "FrameCapture.hh"
+#include "common.h"
+
+static void deleteFrameCapture(FrameCapture* instance) {
+    delete instance;
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_FrameCapture__1nGetFinalizer
+  () {
+    return reinterpret_cast<KNativePointer>(&deleteFrameCapture);
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_FrameCapture__1nMake
+  () {
+    FrameCapture* instance = new FrameCapture();
+    return reinterpret_cast<KNativePointer>(instance);
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_FrameCapture__1nBeginCapture
+  (KNativePointer ptr, KNativePointer canvasPtr, KFloat left, KFloat top, KFloat right, KFloat bottom) {
+    FrameCapture* instance = reinterpret_cast<FrameCapture*>(ptr);
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(canvasPtr);
+    return reinterpret_cast<KNativePointer>(instance->beginCapture(canvas, SkRect::MakeLTRB(left, top, right, bottom)));
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_FrameCapture__1nFinishCapture
+  (KNativePointer ptr) {
+    FrameCapture* instance = reinterpret_cast<FrameCapture*>(ptr);
+    return reinterpret_cast<KNativePointer>(instance->finishCapture().release());
+}
+
+SKIKO_EXPORT KBoolean org_jetbrains_skia_FrameCapture__1nIsCapturing
+  (KNativePointer ptr) {
+    FrameCapture* instance = reinterpret_cast<FrameCapture*>(ptr);
+    return instance->isCapturing();
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_FrameCapture__1nSerialize
+  (KNativePointer picturePtr) {
+    SkPicture* picture = reinterpret_cast<SkPicture*>(picturePtr);
+    return reinterpret_cast<KNativePointer>(FrameCapture::Serialize(picture).release());
+}
@@ -4,6 +4,8 @@
 #include <iostream>
 #include "SkData.h"
 #include "SkImage.h"
+#include "SkStream.h"
+#include "ImageEncoder.hh"
 #include "common.h"
 
 
@@ -71,6 +73,14 @@ SKIKO_EXPORT KNativePointer org_jetbrains_skia_Image__1nEncodeToData
 }
 
 
+SKIKO_EXPORT KBoolean org_jetbrains_skia_Image__1nEncodeToStream
+  (KNativePointer ptr, KNativePointer wstreamPtr, KInt format, KInt quality, KInt preset) {
+    SkImage* instance = reinterpret_cast<SkImage*>(ptr);
+    SkWStream* wstream = reinterpret_cast<SkWStream*>(wstreamPtr);
+    return skikoMpp::encoder::encode(wstream, instance, static_cast<SkEncodedImageFormat>(format), quality, static_cast<skikoMpp::encoder::Preset>(preset));
+}
+
+
 SKIKO_EXPORT KNativePointer org_jetbrains_skia_Image__1nMakeShader
   (KNativePointer ptr, KInt tmx, KInt tmy, KInt samplingModeVal1, KInt samplingModeVal2, KFloat* localMatrixArr) {
     SkImage* instance = reinterpret_cast<SkImage*>(ptr);
@@ -0,0 +1,67 @@
+#include "SkData.h"
+#include "SkImage.h"
+#include "ImageCache.hh"
+#include "common.h"
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_ImageCache__1nMake
+  (KInt byteBudget) {
+    ImageCache* instance = new ImageCache(static_cast<size_t>(byteBudget));
+    return reinterpret_cast<KNativePointer>(instance);
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_ImageCache__1nFindOrDecode
+  (KNativePointer ptr, KNativePointer dataPtr, KInt width, KInt height, KInt colorType) {
+    ImageCache* instance = reinterpret_cast<ImageCache*>(ptr);
+    SkData* data = reinterpret_cast<SkData*>(dataPtr);
+    sk_sp<SkImage> image = instance->findOrDecode(sk_ref_sp(data), width, height, static_cast<SkColorType>(colorType));
+    return reinterpret_cast<KNativePointer>(image.release());
+}
+
+SKIKO_EXPORT KInt org_jetbrains_skia_ImageCache__1nGetByteBudget
+  (KNativePointer ptr) {
+    ImageCache* instance = reinterpret_cast<ImageCache*>(ptr);
+    return static_cast<KInt>(instance->getByteBudget());
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_ImageCache__1nSetByteBudget
+  (KNativePointer ptr, KInt byteBudget) {
+    ImageCache* instance = reinterpret_cast<ImageCache*>(ptr);
+    instance->setByteBudget(static_cast<size_t>(byteBudget));
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_ImageCache__1nPurgeToBytes
+  (KNativePointer ptr, KInt targetBytes) {
+    ImageCache* instance = reinterpret_cast<ImageCache*>(ptr);
+    instance->purgeToBytes(static_cast<size_t>(targetBytes));
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_ImageCache__1nPurgeAll
+  (KNativePointer ptr) {
+    ImageCache* instance = reinterpret_cast<ImageCache*>(ptr);
+    instance->purgeAll();
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_ImageCache__1nOnMemoryPressure
+  (KNativePointer ptr, KBoolean critical) {
+    ImageCache* instance = reinterpret_cast<ImageCache*>(ptr);
+    instance->onMemoryPressure(critical);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_ImageCache__1nGetStats
+  (KNativePointer ptr, KInt* result) {
+    ImageCache* instance = reinterpret_cast<ImageCache*>(ptr);
+    ImageCache::Stats stats = instance->getStats();
+    result[0] = stats.fHits;
+    result[1] = stats.fMisses;
+    result[2] = stats.fEvictions;
+    result[3] = stats.fCount;
+    result[4] = static_cast<KInt>(stats.fBytesUsed);
+    result[5] = static_cast<KInt>(stats.fByteBudget);
+    result[6] = stats.fGenerationID;
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_ImageCache__1nResetStats
+  (KNativePointer ptr) {
+    ImageCache* instance = reinterpret_cast<ImageCache*>(ptr);
+    instance->resetStats();
+}
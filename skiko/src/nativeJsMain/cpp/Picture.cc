@@ -5,6 +5,8 @@
 #include "SkData.h"
 #include "SkPicture.h"
 #include "SkShader.h"
+#include "PictureRasterizer.hh"
+#include "PictureResourceStore.hh"
 #include "common.h"
 
 class KotlinAbortCallback: public SkPicture::AbortCallback {
@@ -18,9 +20,13 @@ private:
 };
 
 SKIKO_EXPORT KNativePointer org_jetbrains_skia_Picture__1nMakeFromData
-  (KNativePointer dataPtr) {
+  (KNativePointer dataPtr, KNativePointer storePtr) {
     SkData* data = reinterpret_cast<SkData*>((dataPtr));
-    SkPicture* instance = SkPicture::MakeFromData(data).release();
+    PictureResourceStore* store = reinterpret_cast<PictureResourceStore*>(storePtr);
+    SkDeserialProcs procs;
+    if (store)
+        procs = store->deserialProcs();
+    SkPicture* instance = SkPicture::MakeFromData(data, &procs).release();
     return reinterpret_cast<KNativePointer>(instance);
 }
 
@@ -36,6 +42,14 @@ SKIKO_EXPORT void org_jetbrains_skia_Picture__1nPlayback
     }
 }
 
+SKIKO_EXPORT KBoolean org_jetbrains_skia_Picture__1nPlaybackTiled
+  (KNativePointer ptr, KNativePointer pixmapPtr, KFloat* matrixArr, KInt tileSize, KInt maxThreads) {
+    SkPicture* instance = reinterpret_cast<SkPicture*>(ptr);
+    SkPixmap* pixmap = reinterpret_cast<SkPixmap*>(pixmapPtr);
+    std::unique_ptr<SkMatrix> matrix = skMatrix(matrixArr);
+    return skikoMpp::picture::rasterizeTiled(instance, *pixmap, matrix.get(), tileSize, maxThreads);
+}
+
 SKIKO_EXPORT void org_jetbrains_skia_Picture__1nGetCullRect
   (KNativePointer ptr, KInteropPointer ltrbArray) {
     SkPicture* instance = reinterpret_cast<SkPicture*>((ptr));
@@ -54,9 +68,13 @@ SKIKO_EXPORT KInt org_jetbrains_skia_Picture__1nGetUniqueId
 }
 
 SKIKO_EXPORT KNativePointer org_jetbrains_skia_Picture__1nSerializeToData
-  (KNativePointer ptr) {
+  (KNativePointer ptr, KNativePointer storePtr) {
     SkPicture* instance = reinterpret_cast<SkPicture*>((ptr));
-    SkData* data = instance->serialize().release();
+    PictureResourceStore* store = reinterpret_cast<PictureResourceStore*>(storePtr);
+    SkSerialProcs procs;
+    if (store)
+        procs = store->serialProcs();
+    SkData* data = instance->serialize(&procs).release();
     return reinterpret_cast<KNativePointer>(data);
 }
 
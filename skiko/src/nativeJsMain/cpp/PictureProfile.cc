@@ -0,0 +1,73 @@
+#include "SkPicture.h"
+#include "PictureProfile.hh"
+#include "common.h"
+
+static void deletePictureProfile(PictureProfile* instance) {
+    delete instance;
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_PictureProfile__1nGetFinalizer
+  () {
+    return reinterpret_cast<KNativePointer>(&deletePictureProfile);
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_PictureProfile__1nMake
+  (KNativePointer picturePtr, KInt width, KInt height) {
+    SkPicture* picture = reinterpret_cast<SkPicture*>(picturePtr);
+    PictureProfile* instance = new PictureProfile(picture, width, height);
+    return reinterpret_cast<KNativePointer>(instance);
+}
+
+SKIKO_EXPORT KInt org_jetbrains_skia_PictureProfile__1nGetOpCount
+  (KNativePointer ptr) {
+    PictureProfile* instance = reinterpret_cast<PictureProfile*>(ptr);
+    return static_cast<KInt>(instance->ops().size());
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_PictureProfile__1nGetOps
+  (KNativePointer ptr, KInt* types, KInt* bounds, KFloat* micros) {
+    PictureProfile* instance = reinterpret_cast<PictureProfile*>(ptr);
+    const std::vector<PictureProfile::Op>& ops = instance->ops();
+    for (size_t i = 0; i < ops.size(); ++i) {
+        types[i] = ops[i].fType;
+        bounds[i * 4 + 0] = ops[i].fBounds.left();
+        bounds[i * 4 + 1] = ops[i].fBounds.top();
+        bounds[i * 4 + 2] = ops[i].fBounds.right();
+        bounds[i * 4 + 3] = ops[i].fBounds.bottom();
+        micros[i] = ops[i].fNanos / 1000.0f;
+    }
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_PictureProfile__1nGetHistogram
+  (KNativePointer ptr, KInt* counts, KFloat* micros) {
+    PictureProfile* instance = reinterpret_cast<PictureProfile*>(ptr);
+    for (int i = 0; i < PictureProfile::kOpTypeCount; ++i) {
+        PictureProfile::OpType type = static_cast<PictureProfile::OpType>(i);
+        counts[i] = instance->count(type);
+        micros[i] = instance->nanos(type) / 1000.0f;
+    }
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_PictureProfile__1nGetOverdraw
+  (KNativePointer ptr) {
+    PictureProfile* instance = reinterpret_cast<PictureProfile*>(ptr);
+    return reinterpret_cast<KNativePointer>(new SkBitmap(instance->overdraw()));
+}
+
+SKIKO_EXPORT KInt org_jetbrains_skia_PictureProfile__1nGetMaxOverdraw
+  (KNativePointer ptr) {
+    PictureProfile* instance = reinterpret_cast<PictureProfile*>(ptr);
+    return instance->maxOverdraw();
+}
+
+SKIKO_EXPORT KFloat org_jetbrains_skia_PictureProfile__1nGetAverageOverdraw
+  (KNativePointer ptr) {
+    PictureProfile* instance = reinterpret_cast<PictureProfile*>(ptr);
+    return static_cast<KFloat>(instance->averageOverdraw());
+}
+
+SKIKO_EXPORT KInteropPointer org_jetbrains_skia_PictureProfile__1nToJson
+  (KNativePointer ptr, KBoolean includeOps) {
+    PictureProfile* instance = reinterpret_cast<PictureProfile*>(ptr);
+    return new SkString(instance->toJson(includeOps));
+}
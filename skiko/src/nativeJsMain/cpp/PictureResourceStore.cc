@@ -0,0 +1,32 @@
+#include "SkData.h"
+#include "PictureResourceStore.hh"
+#include "common.h"
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_PictureResourceStore__1nMake
+  () {
+    PictureResourceStore* instance = new PictureResourceStore();
+    return reinterpret_cast<KNativePointer>(instance);
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_PictureResourceStore__1nMakeFromData
+  (KNativePointer dataPtr) {
+    SkData* data = reinterpret_cast<SkData*>(dataPtr);
+    return reinterpret_cast<KNativePointer>(PictureResourceStore::MakeFromData(data).release());
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_PictureResourceStore__1nSerializeToData
+  (KNativePointer ptr) {
+    PictureResourceStore* instance = reinterpret_cast<PictureResourceStore*>(ptr);
+    return reinterpret_cast<KNativePointer>(instance->serialize().release());
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_PictureResourceStore__1nGetStats
+  (KNativePointer ptr, KInt* result) {
+    PictureResourceStore* instance = reinterpret_cast<PictureResourceStore*>(ptr);
+    PictureResourceStore::Stats stats = instance->getStats();
+    result[0] = stats.fTypefaces;
+    result[1] = stats.fImages;
+    result[2] = stats.fReferences;
+    result[3] = static_cast<KInt>(stats.fStoredBytes);
+    result[4] = static_cast<KInt>(stats.fReferencedBytes);
+}
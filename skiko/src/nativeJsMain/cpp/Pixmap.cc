@@ -2,6 +2,7 @@
 // This file has been auto generated.
 
 #include "SkPixmap.h"
+#include "PixelConverter.hh"
 #include "common.h"
 
 static void deletePixmap(SkPixmap *pixmap) {
@@ -160,6 +161,13 @@ SKIKO_EXPORT KBoolean org_jetbrains_skia_Pixmap__1nReadPixelsToPixmapFromPoint
     return static_cast<KBoolean>(pixmap->readPixels(*dstPixmap, srcX, srcY));
 }
 
+SKIKO_EXPORT KBoolean org_jetbrains_skia_Pixmap__1nConvertPixels
+  (KNativePointer ptr, KNativePointer dstPixmapPtr) {
+    SkPixmap* pixmap = interopToPtr<SkPixmap*>(ptr);
+    SkPixmap* dstPixmap = interopToPtr<SkPixmap*>(dstPixmapPtr);
+    return static_cast<KBoolean>(skikoMpp::pixels::convert(*pixmap, *dstPixmap));
+}
+
 SKIKO_EXPORT KBoolean org_jetbrains_skia_Pixmap__1nScalePixels
   (KNativePointer ptr, KNativePointer dstPixmapPtr, KInt samplingOptionsVal1, KInt samplingOptionsVal2) {
     SkPixmap* pixmap = interopToPtr<SkPixmap*>(ptr);
@@ -0,0 +1,95 @@
+#include "SkCanvas.h"
+#include "SkPaint.h"
+#include "RetainedLayer.hh"
+#include "common.h"
+
+static void deleteRetainedLayer(RetainedLayer* instance) {
+    delete instance;
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_RetainedLayer__1nGetFinalizer
+  () {
+    return reinterpret_cast<KNativePointer>(&deleteRetainedLayer);
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_RetainedLayer__1nMake
+  (KFloat left, KFloat top, KFloat right, KFloat bottom) {
+    RetainedLayer* instance = new RetainedLayer(SkRect::MakeLTRB(left, top, right, bottom));
+    return reinterpret_cast<KNativePointer>(instance);
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_RetainedLayer__1nBeginRecording
+  (KNativePointer ptr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(ptr);
+    return reinterpret_cast<KNativePointer>(instance->beginRecording());
+}
+
+SKIKO_EXPORT KBoolean org_jetbrains_skia_RetainedLayer__1nFinishRecording
+  (KNativePointer ptr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(ptr);
+    return instance->finishRecording();
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_RetainedLayer__1nInvalidate
+  (KNativePointer ptr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(ptr);
+    instance->invalidate();
+}
+
+SKIKO_EXPORT KBoolean org_jetbrains_skia_RetainedLayer__1nIsDirty
+  (KNativePointer ptr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(ptr);
+    return instance->isDirty();
+}
+
+SKIKO_EXPORT KBoolean org_jetbrains_skia_RetainedLayer__1nDraw
+  (KNativePointer ptr, KNativePointer canvasPtr, KNativePointer paintPtr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(ptr);
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(canvasPtr);
+    SkPaint* paint = reinterpret_cast<SkPaint*>(paintPtr);
+    return instance->draw(canvas, paint);
+}
+
+SKIKO_EXPORT KInt org_jetbrains_skia_RetainedLayer__1nGetRasterAfterReplays
+  (KNativePointer ptr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(ptr);
+    return instance->getRasterAfterReplays();
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_RetainedLayer__1nSetRasterAfterReplays
+  (KNativePointer ptr, KInt replays) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(ptr);
+    instance->setRasterAfterReplays(replays);
+}
+
+SKIKO_EXPORT KInt org_jetbrains_skia_RetainedLayer__1nGetRasterAboveOpCount
+  (KNativePointer ptr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(ptr);
+    return instance->getRasterAboveOpCount();
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_RetainedLayer__1nSetRasterAboveOpCount
+  (KNativePointer ptr, KInt opCount) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(ptr);
+    instance->setRasterAboveOpCount(opCount);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_RetainedLayer__1nGetStats
+  (KNativePointer ptr, KInt* result) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(ptr);
+    RetainedLayer::Stats stats = instance->getStats();
+    result[0] = stats.fDraws;
+    result[1] = stats.fMisses;
+    result[2] = stats.fRecordings;
+    result[3] = stats.fRecordMicros;
+    result[4] = stats.fRasterizations;
+    result[5] = stats.fRasterDraws;
+    result[6] = static_cast<KInt>(stats.fPictureBytes);
+    result[7] = static_cast<KInt>(stats.fImageBytes);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_RetainedLayer__1nResetStats
+  (KNativePointer ptr) {
+    RetainedLayer* instance = reinterpret_cast<RetainedLayer*>(ptr);
+    instance->resetStats();
+}
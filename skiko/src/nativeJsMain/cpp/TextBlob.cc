@@ -9,8 +9,12 @@
 #include "common.h"
 #include "RunRecordClone.hh"
 #include "mppinterop.h"
+#include "TextBlobMetricsCache.hh"
 
 static void unrefTextBlob(SkTextBlob* ptr) {
+    // Blob dies with this reference, so its cached metrics can't be requested anymore
+    if (ptr->unique())
+        TextBlobMetricsCache::Get().remove(ptr->uniqueID());
     ptr->unref();
 }
 
@@ -174,3 +178,24 @@ SKIKO_EXPORT KBoolean org_jetbrains_skia_TextBlob__1nGetLastBaseline
   (KNativePointer ptr, KFloat* resultArray) {
   return skikoMpp::textblob::getLastBaseline(reinterpret_cast<SkTextBlob*>(ptr), resultArray);
 }
+
+SKIKO_EXPORT void org_jetbrains_skia_TextBlob__1nGetMetricsCacheStats
+  (KInt* result) {
+    TextBlobMetricsCache::Stats stats = TextBlobMetricsCache::Get().getStats();
+    result[0] = stats.fHits;
+    result[1] = stats.fMisses;
+    result[2] = stats.fEvictions;
+    result[3] = stats.fCount;
+    result[4] = static_cast<KInt>(stats.fBytesUsed);
+    result[5] = static_cast<KInt>(stats.fByteBudget);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_TextBlob__1nSetMetricsCacheByteBudget
+  (KInt byteBudget) {
+    TextBlobMetricsCache::Get().setByteBudget(byteBudget);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_TextBlob__1nPurgeMetricsCache
+  () {
+    TextBlobMetricsCache::Get().purgeAll();
+}
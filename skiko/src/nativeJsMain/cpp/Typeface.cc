@@ -4,6 +4,8 @@
 #include <iostream>
 #include "SkData.h"
 #include "SkTypeface.h"
+#include "TypefaceCoverage.hh"
+#include "VariationCache.hh"
 #include "common.h"
 
 
@@ -107,20 +109,42 @@ SKIKO_EXPORT KNativePointer org_jetbrains_skia_Typeface__1nMakeFromData
 SKIKO_EXPORT KNativePointer org_jetbrains_skia_Typeface__1nMakeClone
   (KNativePointer typefacePtr, KInt* variations, KInt variationsCount, KInt collectionIndex) {
     SkTypeface* typeface = reinterpret_cast<SkTypeface*>(typefacePtr);
-    std::vector<SkFontArguments::VariationPosition::Coordinate> coordinates(variationsCount);
+    std::vector<SkFontArguments::VariationPosition::Coordinate> coordinates(variationsCount / 2);
     for (int i=0; i < variationsCount; i+=2) {
-        coordinates[i] = {
+        coordinates[i / 2] = {
             static_cast<SkFourByteTag>(variations[i]),
             fromBits(variations[i+1])
         };
     }
-    SkFontArguments arg = SkFontArguments()
-                            .setCollectionIndex(collectionIndex)
-                            .setVariationDesignPosition({coordinates.data(), variationsCount});
-    SkTypeface* clone = typeface->makeClone(arg).release();
+    SkTypeface* clone = VariationCache::Get().makeClone(typeface, coordinates.data(), static_cast<int>(coordinates.size()), collectionIndex).release();
     return reinterpret_cast<KNativePointer>(clone);
 }
 
+SKIKO_EXPORT void org_jetbrains_skia_Typeface__1nGetVariationCacheStats
+  (KInt* result) {
+    VariationCache::Stats stats = VariationCache::Get().getStats();
+    result[0] = stats.fHits;
+    result[1] = stats.fMisses;
+    result[2] = stats.fEvictions;
+    result[3] = stats.fCount;
+    result[4] = stats.fCapacity;
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_Typeface__1nSetVariationCacheCapacity
+  (KInt capacity) {
+    VariationCache::Get().setCapacity(capacity);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_Typeface__1nSetVariationQuantization
+  (KInt axis, KFloat step) {
+    VariationCache::Get().setQuantization(static_cast<SkFourByteTag>(axis), step);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_Typeface__1nPurgeVariationCache
+  () {
+    VariationCache::Get().purgeAll();
+}
+
 SKIKO_EXPORT void org_jetbrains_skia_Typeface__1nGetUTF32Glyphs
   (KNativePointer ptr, KInt* uni, KInt count, KShort* res) {
     SkTypeface* instance = reinterpret_cast<SkTypeface*>(ptr);
@@ -133,6 +157,24 @@ SKIKO_EXPORT KShort org_jetbrains_skia_Typeface__1nGetUTF32Glyph
     return instance->unicharToGlyph(uni);
 }
 
+SKIKO_EXPORT KBoolean org_jetbrains_skia_Typeface__1nCovers
+  (KNativePointer ptr, KInt unichar) {
+    SkTypeface* instance = reinterpret_cast<SkTypeface*>((ptr));
+    return TypefaceCoverage::Get(instance)->covers(unichar);
+}
+
+SKIKO_EXPORT KBoolean org_jetbrains_skia_Typeface__1nCoversAll
+  (KNativePointer ptr, KInt* uni, KInt count) {
+    SkTypeface* instance = reinterpret_cast<SkTypeface*>((ptr));
+    return TypefaceCoverage::Get(instance)->coversAll(reinterpret_cast<SkUnichar*>(uni), count);
+}
+
+SKIKO_EXPORT KInt org_jetbrains_skia_Typeface__1nGetCoveredCount
+  (KNativePointer ptr) {
+    SkTypeface* instance = reinterpret_cast<SkTypeface*>((ptr));
+    return TypefaceCoverage::Get(instance)->count();
+}
+
 SKIKO_EXPORT KInt org_jetbrains_skia_Typeface__1nGetGlyphsCount
   (KNativePointer ptr) {
     SkTypeface* instance = reinterpret_cast<SkTypeface*>((ptr));
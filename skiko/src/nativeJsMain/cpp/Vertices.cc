@@ -0,0 +1,78 @@
+#include "SkVertices.h"
+#include "VerticesBuffer.hh"
+#include "common.h"
+
+static void deleteVertices(VerticesBuffer* instance) {
+    delete instance;
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_Vertices__1nGetFinalizer
+  () {
+    return reinterpret_cast<KNativePointer>(&deleteVertices);
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_Vertices__1nMake
+  (KInt mode, KInt vertexCount, KInt indexCount, KBoolean hasTexCoords, KBoolean hasColors) {
+    std::unique_ptr<VerticesBuffer> instance = VerticesBuffer::Make(static_cast<SkVertices::VertexMode>(mode), vertexCount, indexCount, hasTexCoords, hasColors);
+    return reinterpret_cast<KNativePointer>(instance.release());
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_Vertices__1nSetPositions
+  (KNativePointer ptr, KFloat* positions, KInt offset, KInt count) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(ptr);
+    instance->setPositions(positions, offset, count);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_Vertices__1nSetTexCoords
+  (KNativePointer ptr, KFloat* texCoords, KInt offset, KInt count) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(ptr);
+    instance->setTexCoords(texCoords, offset, count);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_Vertices__1nSetColors
+  (KNativePointer ptr, KInt* colors, KInt offset, KInt count) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(ptr);
+    instance->setColors(reinterpret_cast<SkColor*>(colors), offset, count);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_Vertices__1nSetIndices
+  (KNativePointer ptr, KShort* indices, KInt offset, KInt count) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(ptr);
+    instance->setIndices(reinterpret_cast<uint16_t*>(indices), offset, count);
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_Vertices__1nGetPositionsStorage
+  (KNativePointer ptr) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(ptr);
+    return reinterpret_cast<KNativePointer>(instance->positionsStorage());
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_Vertices__1nGetTexCoordsStorage
+  (KNativePointer ptr) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(ptr);
+    return reinterpret_cast<KNativePointer>(instance->texCoordsStorage());
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_Vertices__1nGetColorsStorage
+  (KNativePointer ptr) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(ptr);
+    return reinterpret_cast<KNativePointer>(instance->colorsStorage());
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_Vertices__1nGetIndicesStorage
+  (KNativePointer ptr) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(ptr);
+    return reinterpret_cast<KNativePointer>(instance->indicesStorage());
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_Vertices__1nMarkEdited
+  (KNativePointer ptr) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(ptr);
+    instance->markEdited();
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_Vertices__1nGetBounds
+  (KNativePointer ptr, KInteropPointer result) {
+    VerticesBuffer* instance = reinterpret_cast<VerticesBuffer*>(ptr);
+    skija::Rect::copyToInterop(instance->bounds(), result);
+}
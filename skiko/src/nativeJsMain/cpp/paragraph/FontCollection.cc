@@ -4,6 +4,7 @@
 #include <iostream>
 #include "SkRefCnt.h"
 #include "FontCollection.h"
+#include "ParagraphCacheMonitor.hh"
 using namespace std;
 using namespace skia::textlayout;
 #include "common.h"
@@ -11,6 +12,8 @@ using namespace skia::textlayout;
 SKIKO_EXPORT KNativePointer org_jetbrains_skia_paragraph_FontCollection__1nMake
   () {
     FontCollection* ptr = new FontCollection();
+    // Count cache hits and misses from the start
+    ParagraphCacheMonitor::Get(ptr->getParagraphCache());
     return reinterpret_cast<KNativePointer>(ptr);
 }
 
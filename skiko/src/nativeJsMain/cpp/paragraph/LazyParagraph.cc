@@ -0,0 +1,100 @@
+#include "LazyParagraph.hh"
+#include "common.h"
+
+using namespace skia::textlayout;
+
+static void deleteLazyParagraph(LazyParagraph* instance) {
+    delete instance;
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_paragraph_LazyParagraph__1nGetFinalizer
+  () {
+    return reinterpret_cast<KNativePointer>(&deleteLazyParagraph);
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_paragraph_LazyParagraph__1nMake
+  (KInteropPointer textStr, KNativePointer paragraphStylePtr, KNativePointer fontCollectionPtr) {
+    ParagraphStyle* paragraphStyle = reinterpret_cast<ParagraphStyle*>(paragraphStylePtr);
+    FontCollection* fontCollection = reinterpret_cast<FontCollection*>(fontCollectionPtr);
+    LazyParagraph* instance = new LazyParagraph(skString(textStr), *paragraphStyle, sk_ref_sp(fontCollection));
+    return reinterpret_cast<KNativePointer>(instance);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_paragraph_LazyParagraph__1nLayout
+  (KNativePointer ptr, KFloat width) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(ptr);
+    instance->layout(width);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_paragraph_LazyParagraph__1nReplaceText
+  (KNativePointer ptr, KInt from, KInt to, KInteropPointer textStr) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(ptr);
+    instance->replaceText(from, to, skString(textStr));
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_paragraph_LazyParagraph__1nLayoutUntil
+  (KNativePointer ptr, KFloat y) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(ptr);
+    instance->layoutUntil(y);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_paragraph_LazyParagraph__1nLayoutUntilLine
+  (KNativePointer ptr, KInt line) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(ptr);
+    instance->layoutUntilLine(line);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_paragraph_LazyParagraph__1nLayoutAll
+  (KNativePointer ptr) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(ptr);
+    instance->layoutAll();
+}
+
+SKIKO_EXPORT KBoolean org_jetbrains_skia_paragraph_LazyParagraph__1nIsLaidOutCompletely
+  (KNativePointer ptr) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(ptr);
+    return instance->isLaidOutCompletely();
+}
+
+SKIKO_EXPORT KFloat org_jetbrains_skia_paragraph_LazyParagraph__1nGetLaidOutHeight
+  (KNativePointer ptr) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(ptr);
+    return instance->laidOutHeight();
+}
+
+SKIKO_EXPORT KInt org_jetbrains_skia_paragraph_LazyParagraph__1nGetLaidOutLineCount
+  (KNativePointer ptr) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(ptr);
+    return instance->laidOutLineCount();
+}
+
+SKIKO_EXPORT KFloat org_jetbrains_skia_paragraph_LazyParagraph__1nGetHeight
+  (KNativePointer ptr) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(ptr);
+    return instance->height();
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_paragraph_LazyParagraph__1nPaint
+  (KNativePointer ptr, KNativePointer canvasPtr, KFloat x, KFloat y, KFloat top, KFloat bottom) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(ptr);
+    SkCanvas* canvas = reinterpret_cast<SkCanvas*>(canvasPtr);
+    instance->paint(canvas, x, y, top, bottom);
+}
+
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_paragraph_LazyParagraph__1nGetLineMetrics
+  (KNativePointer ptr) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(ptr);
+    std::vector<LineMetrics>* res = new std::vector<LineMetrics>();
+    instance->getLineMetrics(*res);
+    return res;
+}
+
+SKIKO_EXPORT KInt org_jetbrains_skia_paragraph_LazyParagraph__1nGetGlyphPositionAtCoordinate
+  (KNativePointer ptr, KFloat dx, KFloat dy) {
+    LazyParagraph* instance = reinterpret_cast<LazyParagraph*>(ptr);
+    PositionWithAffinity p = instance->getGlyphPositionAtCoordinate(dx, dy);
+    if (p.affinity == Affinity::kDownstream)
+        return p.position;
+    else
+        return -p.position-1;
+}
@@ -17,27 +17,27 @@ SKIKO_EXPORT void org_jetbrains_skia_paragraph_LineMetrics__1nDisposeArray
     delete vect;
 }
 
-SKIKO_EXPORT void org_jetbrains_skia_paragraph_LineMetrics__1nGetArrayElement
-    (KNativePointer blob, KInt index, KNativePointer longArgs, KNativePointer doubleArgs) {
+SKIKO_EXPORT void org_jetbrains_skia_paragraph_LineMetrics__1nGetArray
+    (KNativePointer blob, KInt* indices, KDouble* metrics) {
 
     std::vector<LineMetrics>* vect = reinterpret_cast<std::vector<LineMetrics> *>(blob);
-    float* longs = reinterpret_cast<float *>(longArgs);
-    int* doubles = reinterpret_cast<int *>(doubleArgs);
-
-    LineMetrics lm = vect->at(index);
-
-    longs[0] = lm.fStartIndex;
-    longs[1] = lm.fEndIndex;
-    longs[2] = lm.fEndExcludingWhitespaces;
-    longs[3] = lm.fEndIncludingNewline;
-    longs[4] = lm.fHardBreak;
-    longs[5] = lm.fLineNumber;
-
-    doubles[0] = lm.fAscent;
-    doubles[1] = lm.fDescent;
-    doubles[2] = lm.fUnscaledAscent;
-    doubles[3] = lm.fHeight;
-    doubles[4] = lm.fWidth;
-    doubles[5] = lm.fLeft;
-    doubles[6] = lm.fBaseline;
+    for (size_t i = 0; i < vect->size(); ++i) {
+        const LineMetrics& lm = (*vect)[i];
+        KInt* lineIndices = indices + i * 6;
+        lineIndices[0] = static_cast<KInt>(lm.fStartIndex);
+        lineIndices[1] = static_cast<KInt>(lm.fEndIndex);
+        lineIndices[2] = static_cast<KInt>(lm.fEndExcludingWhitespaces);
+        lineIndices[3] = static_cast<KInt>(lm.fEndIncludingNewline);
+        lineIndices[4] = lm.fHardBreak ? 1 : 0;
+        lineIndices[5] = static_cast<KInt>(lm.fLineNumber);
+
+        KDouble* lineMetrics = metrics + i * 7;
+        lineMetrics[0] = lm.fAscent;
+        lineMetrics[1] = lm.fDescent;
+        lineMetrics[2] = lm.fUnscaledAscent;
+        lineMetrics[3] = lm.fHeight;
+        lineMetrics[4] = lm.fWidth;
+        lineMetrics[5] = lm.fLeft;
+        lineMetrics[6] = lm.fBaseline;
+    }
 }
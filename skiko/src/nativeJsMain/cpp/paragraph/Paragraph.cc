@@ -4,6 +4,9 @@
 #include <iostream>
 #include "DartTypes.h"
 #include "Paragraph.h"
+#include "ParagraphCacheMonitor.hh"
+#include "ParagraphEdit.hh"
+#include "ParagraphLayout.hh"
 using namespace std;
 using namespace skia::textlayout;
 #include "common.h"
@@ -69,6 +72,12 @@ SKIKO_EXPORT void org_jetbrains_skia_paragraph_Paragraph__1nLayout
   (KNativePointer ptr, KFloat width) {
     Paragraph* instance = reinterpret_cast<Paragraph*>((ptr));
     instance->layout(width);
+    ParagraphCacheMonitor::EnforceBudget(instance);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_paragraph_Paragraph__1nLayoutAll
+  (KNativePointer* ptrs, KFloat* widths, KInt count) {
+    skikoMpp::paragraph::layoutAll(reinterpret_cast<Paragraph* const*>(ptrs), widths, count);
 }
 
 SKIKO_EXPORT void org_jetbrains_skia_paragraph_Paragraph__1nPaint
@@ -78,11 +87,12 @@ SKIKO_EXPORT void org_jetbrains_skia_paragraph_Paragraph__1nPaint
     instance->paint(canvas, x, y);
 }
 
-SKIKO_EXPORT KInteropPointerArray org_jetbrains_skia_paragraph_Paragraph__1nGetRectsForRange
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_paragraph_Paragraph__1nGetRectsForRange
   (KNativePointer ptr, KInt start, KInt end, KInt rectHeightStyle, KInt rectWidthStyle) {
     Paragraph* instance = reinterpret_cast<Paragraph*>((ptr));
     std::vector<TextBox> originalRects = instance->getRectsForRange(start, end, static_cast<RectHeightStyle>(rectHeightStyle), static_cast<RectWidthStyle>(rectWidthStyle));
     std::vector<TextBox> *rects = new std::vector<TextBox>();
+    rects->reserve(originalRects.size());
     for (TextBox& box : originalRects) {
         // TODO fix https://github.com/JetBrains/compose-jb/issues/1308 another way, we just masking the issue
         // (but experiments show, that the result of GetRectsForRange is correct after that)
@@ -94,7 +104,7 @@ SKIKO_EXPORT KInteropPointerArray org_jetbrains_skia_paragraph_Paragraph__1nGetR
     return rects;
 }
 
-SKIKO_EXPORT KInteropPointerArray org_jetbrains_skia_paragraph_Paragraph__1nGetRectsForPlaceholders
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_paragraph_Paragraph__1nGetRectsForPlaceholders
   (KNativePointer ptr) {
     Paragraph* instance = reinterpret_cast<Paragraph*>((ptr));
     std::vector<TextBox> *vect = new std::vector<TextBox>(instance->getRectsForPlaceholders());
@@ -122,15 +132,13 @@ SKIKO_EXPORT void org_jetbrains_skia_paragraph_Paragraph__1nGetWordBoundary
 
 
 SKIKO_EXPORT KNativePointer org_jetbrains_skia_paragraph_Paragraph__1nGetLineMetrics
-  (KNativePointer ptr, KNativePointer textPtr) {
+  (KNativePointer ptr) {
     Paragraph* instance = reinterpret_cast<Paragraph*>((ptr));
-    SkString* text = reinterpret_cast<SkString*>((textPtr));
-
     std::vector<LineMetrics>* res = new std::vector<LineMetrics>;
     instance->getLineMetrics(*res);
     return res;
 }
-     
+
 SKIKO_EXPORT KInt org_jetbrains_skia_paragraph_Paragraph__1nGetLineNumber
   (KNativePointer ptr) {
     Paragraph* instance = reinterpret_cast<Paragraph*>((ptr));
@@ -155,6 +163,13 @@ SKIKO_EXPORT void org_jetbrains_skia_paragraph_Paragraph__1nUpdateAlignment
     return instance->updateTextAlign(static_cast<TextAlign>(textAlignment));
 }
 
+SKIKO_EXPORT KNativePointer org_jetbrains_skia_paragraph_Paragraph__1nRebuildWithText
+  (KNativePointer ptr, KInt from, KInt to, KInteropPointer text, KNativePointer newTextPtr) {
+    Paragraph* instance = reinterpret_cast<Paragraph*>((ptr));
+    SkString* newText = reinterpret_cast<SkString*>((newTextPtr));
+    return reinterpret_cast<KNativePointer>(skikoMpp::paragraph::rebuildWithText(instance, from, to, skString(text), newText).release());
+}
+
 SKIKO_EXPORT void org_jetbrains_skia_paragraph_Paragraph__1nUpdateFontSize
   (KNativePointer ptr, KInt from, KInt to, KFloat fontSize, KNativePointer textPtr) {
     Paragraph* instance = reinterpret_cast<Paragraph*>((ptr));
@@ -4,6 +4,7 @@
 #include <iostream>
 #include <string>
 #include "ParagraphBuilder.h"
+#include "StyledText.hh"
 using namespace std;
 using namespace skia::textlayout;
 #include "common.h"
@@ -45,6 +46,15 @@ SKIKO_EXPORT void org_jetbrains_skia_paragraph_ParagraphBuilder__1nAddText
     instance->addText(text.c_str(), text.size());
 }
 
+SKIKO_EXPORT void org_jetbrains_skia_paragraph_ParagraphBuilder__1nAddStyledText
+  (KNativePointer ptr, KInteropPointer textString, KInt* starts, KInt* ends, KNativePointer* stylePtrs, KInt count, KNativePointer managedTextPtr) {
+    ParagraphBuilder* instance = reinterpret_cast<ParagraphBuilder*>((ptr));
+    SkString* managedText = reinterpret_cast<SkString*>((managedTextPtr));
+    SkString text = skString(textString);
+    skikoMpp::paragraph::addStyledText(instance, text, starts, ends, reinterpret_cast<const TextStyle* const*>(stylePtrs), count);
+    managedText->append(text);
+}
+
 SKIKO_EXPORT void org_jetbrains_skia_paragraph_ParagraphBuilder__1nAddPlaceholder
   (KNativePointer ptr, KFloat width, KFloat height, KInt alignment, KInt baselinePosition, KFloat baseline) {
     ParagraphBuilder* instance = reinterpret_cast<ParagraphBuilder*>((ptr));
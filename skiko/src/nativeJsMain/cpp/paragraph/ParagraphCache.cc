@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include "ParagraphCache.h"
+#include "ParagraphCacheMonitor.hh"
 #include "ParagraphStyle.h"
 using namespace skia::textlayout;
 #include "common.h"
@@ -11,12 +12,14 @@ SKIKO_EXPORT void org_jetbrains_skia_paragraph_ParagraphCache__1nAbandon
   (KNativePointer ptr) {
     ParagraphCache* instance = reinterpret_cast<ParagraphCache*>((ptr));
     instance->abandon();
+    ParagraphCacheMonitor::Get(instance)->onReset();
 }
 
 SKIKO_EXPORT void org_jetbrains_skia_paragraph_ParagraphCache__1nReset
   (KNativePointer ptr) {
     ParagraphCache* instance = reinterpret_cast<ParagraphCache*>((ptr));
     instance->reset();
+    ParagraphCacheMonitor::Get(instance)->onReset();
 }
 
 SKIKO_EXPORT KBoolean org_jetbrains_skia_paragraph_ParagraphCache__1nUpdateParagraph
@@ -50,3 +53,34 @@ SKIKO_EXPORT KInt org_jetbrains_skia_paragraph_ParagraphCache__1nGetCount
     ParagraphCache* instance = reinterpret_cast<ParagraphCache*>((ptr));
     return instance->count();
 }
+
+SKIKO_EXPORT void org_jetbrains_skia_paragraph_ParagraphCache__1nGetStats
+  (KNativePointer ptr, KInt* result) {
+    ParagraphCache* instance = reinterpret_cast<ParagraphCache*>((ptr));
+    ParagraphCacheMonitor::Stats stats = ParagraphCacheMonitor::Get(instance)->getStats();
+    // 64-bit counters are split into high and low halves
+    result[0] = static_cast<KInt>(stats.fHits >> 32);
+    result[1] = static_cast<KInt>(stats.fHits);
+    result[2] = static_cast<KInt>(stats.fMisses >> 32);
+    result[3] = static_cast<KInt>(stats.fMisses);
+    result[4] = static_cast<KInt>(stats.fEvictions >> 32);
+    result[5] = static_cast<KInt>(stats.fEvictions);
+    result[6] = static_cast<KInt>(stats.fCount);
+    result[7] = static_cast<KInt>(stats.fBytesUsed >> 32);
+    result[8] = static_cast<KInt>(stats.fBytesUsed);
+    result[9] = static_cast<KInt>(stats.fByteBudget);
+    result[10] = static_cast<KInt>(stats.fTimeSavedNanos >> 32);
+    result[11] = static_cast<KInt>(stats.fTimeSavedNanos);
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_paragraph_ParagraphCache__1nResetStats
+  (KNativePointer ptr) {
+    ParagraphCache* instance = reinterpret_cast<ParagraphCache*>((ptr));
+    ParagraphCacheMonitor::Get(instance)->resetStats();
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_paragraph_ParagraphCache__1nSetByteBudget
+  (KNativePointer ptr, KInt byteBudget) {
+    ParagraphCache* instance = reinterpret_cast<ParagraphCache*>((ptr));
+    ParagraphCacheMonitor::Get(instance)->setByteBudget(byteBudget);
+}
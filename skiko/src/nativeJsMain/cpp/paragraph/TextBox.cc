@@ -17,18 +17,16 @@ SKIKO_EXPORT void org_jetbrains_skia_paragraph_TextBox__1nDisposeArray
     delete vect;
 }
 
-SKIKO_EXPORT void org_jetbrains_skia_paragraph_TextBox__1nGetArrayElement
-    (KNativePointer blob, KInt index, KNativePointer rectangleArray, KNativePointer directionArray) {
+SKIKO_EXPORT void org_jetbrains_skia_paragraph_TextBox__1nGetArray
+    (KNativePointer blob, KFloat* ltrb, KInt* directions) {
 
     std::vector<TextBox>* vect = reinterpret_cast<std::vector<TextBox> *>(blob);
-    float* rectangle = reinterpret_cast<float *>(rectangleArray);
-    int* direction = reinterpret_cast<int *>(directionArray);
-
-    TextBox box = vect->at(index);
-    rectangle[0] = box.rect.fLeft;
-    rectangle[1] = box.rect.fTop;
-    rectangle[2] = box.rect.fRight;
-    rectangle[3] = box.rect.fBottom;
-    direction[0] = static_cast<int>(box.direction);
+    for (size_t i = 0; i < vect->size(); ++i) {
+        const TextBox& box = (*vect)[i];
+        ltrb[i * 4]     = box.rect.fLeft;
+        ltrb[i * 4 + 1] = box.rect.fTop;
+        ltrb[i * 4 + 2] = box.rect.fRight;
+        ltrb[i * 4 + 3] = box.rect.fBottom;
+        directions[i] = static_cast<KInt>(box.direction);
+    }
 }
-
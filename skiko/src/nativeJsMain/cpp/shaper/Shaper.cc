@@ -8,10 +8,12 @@
 #include "common.h"
 #include "FontRunIterator.hh"
 #include "src/utils/SkUTF.h"
+#include "ShapingCache.hh"
 #include "TextLineRunHandler.hh"
 
 static void deleteShaper(SkShaper* instance) {
     // std::cout << "Deleting [SkShaper " << instance << "]" << std::endl;
+    ShapingCache::Unregister(instance);
     delete instance;
 }
 
@@ -21,30 +23,30 @@ SKIKO_EXPORT KNativePointer org_jetbrains_skia_shaper_Shaper__1nGetFinalizer() {
 
 SKIKO_EXPORT KNativePointer org_jetbrains_skia_shaper_Shaper__1nMakePrimitive
   () {
-    return reinterpret_cast<KNativePointer>(SkShaper::MakePrimitive().release());
+    return reinterpret_cast<KNativePointer>(ShapingCache::Register(SkShaper::MakePrimitive(), ShapingCache::ShaperKind::kPrimitive));
 }
 
 SKIKO_EXPORT KNativePointer org_jetbrains_skia_shaper_Shaper__1nMakeShaperDrivenWrapper
   (KNativePointer fontMgrPtr) {
     SkFontMgr* fontMgr = reinterpret_cast<SkFontMgr*>((fontMgrPtr));
-    return reinterpret_cast<KNativePointer>(SkShaper::MakeShaperDrivenWrapper(sk_ref_sp(fontMgr)).release());
+    return reinterpret_cast<KNativePointer>(ShapingCache::Register(SkShaper::MakeShaperDrivenWrapper(sk_ref_sp(fontMgr)), ShapingCache::ShaperKind::kShaperDrivenWrapper));
 }
 
 SKIKO_EXPORT KNativePointer org_jetbrains_skia_shaper_Shaper__1nMakeShapeThenWrap
   (KNativePointer fontMgrPtr) {
     SkFontMgr* fontMgr = reinterpret_cast<SkFontMgr*>((fontMgrPtr));
-    return reinterpret_cast<KNativePointer>(SkShaper::MakeShapeThenWrap(sk_ref_sp(fontMgr)).release());
+    return reinterpret_cast<KNativePointer>(ShapingCache::Register(SkShaper::MakeShapeThenWrap(sk_ref_sp(fontMgr)), ShapingCache::ShaperKind::kShapeThenWrap));
 }
 
 SKIKO_EXPORT KNativePointer org_jetbrains_skia_shaper_Shaper__1nMakeShapeDontWrapOrReorder
   (KNativePointer fontMgrPtr) {
     SkFontMgr* fontMgr = reinterpret_cast<SkFontMgr*>((fontMgrPtr));
-    return reinterpret_cast<KNativePointer>(SkShaper::MakeShapeDontWrapOrReorder(sk_ref_sp(fontMgr)).release());
+    return reinterpret_cast<KNativePointer>(ShapingCache::Register(SkShaper::MakeShapeDontWrapOrReorder(sk_ref_sp(fontMgr)), ShapingCache::ShaperKind::kShapeDontWrapOrReorder));
 }
 
 SKIKO_EXPORT KNativePointer org_jetbrains_skia_shaper_Shaper__1nMakeCoreText() {
     #ifdef SK_SHAPER_CORETEXT_AVAILABLE
-        return reinterpret_cast<KNativePointer>(SkShaper::MakeCoreText().release());
+        return reinterpret_cast<KNativePointer>(ShapingCache::Register(SkShaper::MakeCoreText(), ShapingCache::ShaperKind::kCoreText));
     #else
         return 0;
     #endif
@@ -53,10 +55,39 @@ SKIKO_EXPORT KNativePointer org_jetbrains_skia_shaper_Shaper__1nMakeCoreText() {
 SKIKO_EXPORT KNativePointer org_jetbrains_skia_shaper_Shaper__1nMake
   (KNativePointer fontMgrPtr) {
     SkFontMgr* fontMgr = reinterpret_cast<SkFontMgr*>((fontMgrPtr));
-    return reinterpret_cast<KNativePointer>(SkShaper::Make(sk_ref_sp(fontMgr)).release());
+    return reinterpret_cast<KNativePointer>(ShapingCache::Register(SkShaper::Make(sk_ref_sp(fontMgr)), ShapingCache::ShaperKind::kDefault));
 }
 
 
+SKIKO_EXPORT void org_jetbrains_skia_shaper_Shaper__1nGetCacheStats
+  (KInt* result) {
+    ShapingCache::Stats stats = ShapingCache::Get().getStats();
+    result[0] = stats.fHits;
+    result[1] = stats.fMisses;
+    result[2] = stats.fRejected;
+    result[3] = stats.fCount;
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_shaper_Shaper__1nSetCacheEnabled
+  (KBoolean value) {
+    ShapingCache::Get().setEnabled(value);
+}
+
+SKIKO_EXPORT KBoolean org_jetbrains_skia_shaper_Shaper__1nLoadCache
+  (KInteropPointer pathStr) {
+    return ShapingCache::Get().load(skString(pathStr).c_str());
+}
+
+SKIKO_EXPORT KBoolean org_jetbrains_skia_shaper_Shaper__1nSaveCache
+  (KInteropPointer pathStr) {
+    return ShapingCache::Get().save(skString(pathStr).c_str());
+}
+
+SKIKO_EXPORT void org_jetbrains_skia_shaper_Shaper__1nPurgeCache
+  () {
+    ShapingCache::Get().clear();
+}
+
 SKIKO_EXPORT KNativePointer org_jetbrains_skia_shaper_Shaper__1nShapeBlob
   (KNativePointer ptr, KNativePointer textPtr, KNativePointer fontPtr, KInt optsFeaturesLen, KInt* optsFeatures, KInt optsBooleanProps, KFloat width, KFloat offsetX, KFloat offsetY) {
     SkShaper* instance = reinterpret_cast<SkShaper*>(ptr);
@@ -72,28 +103,32 @@ SKIKO_EXPORT KNativePointer org_jetbrains_skia_shaper_Shaper__1nShapeBlob
     bool aproximateSpaces = (optsBooleanProps & 0x02) != 0;
     bool isLeftToRight = (optsBooleanProps & 0x04) != 0;
 
-    uint8_t defaultBiDiLevel = isLeftToRight ? UBIDI_DEFAULT_LTR : UBIDI_DEFAULT_RTL;
-    std::unique_ptr<SkShaper::BiDiRunIterator> bidiRunIter(SkShaper::MakeBiDiRunIterator(text.c_str(), text.size(), defaultBiDiLevel));
-    if (!bidiRunIter) return 0;
-
-    std::unique_ptr<SkShaper::ScriptRunIterator> scriptRunIter(SkShaper::MakeHbIcuScriptRunIterator(text.c_str(), text.size()));
-    if (!scriptRunIter) return 0;
-
-    std::unique_ptr<SkShaper::LanguageRunIterator> languageRunIter(SkShaper::MakeStdLanguageRunIterator(text.c_str(), text.size()));
-    if (!languageRunIter) return 0;
-
-     FontRunIterator fontRunIter(
-        text.c_str(),
-        text.size(),
-        *font,
-        SkFontMgr::RefDefault(),
-        graphemeIter,
-        aproximateSpaces,
-        aproximatePunctuation
-    );
-
     SkTextBlobBuilderRunHandler rh(text.c_str(), {offsetX, offsetY});
-    instance->shape(text.c_str(), text.size(), fontRunIter, *bidiRunIter, *scriptRunIter, *languageRunIter, features.data(), features.size(), width, &rh);
+    bool shaped = ShapingCache::Get().shape(instance, text, *font, features, optsBooleanProps, width, &rh, [&](SkShaper::RunHandler* handler) {
+        uint8_t defaultBiDiLevel = isLeftToRight ? UBIDI_DEFAULT_LTR : UBIDI_DEFAULT_RTL;
+        std::unique_ptr<SkShaper::BiDiRunIterator> bidiRunIter(SkShaper::MakeBiDiRunIterator(text.c_str(), text.size(), defaultBiDiLevel));
+        if (!bidiRunIter) return false;
+
+        std::unique_ptr<SkShaper::ScriptRunIterator> scriptRunIter(SkShaper::MakeHbIcuScriptRunIterator(text.c_str(), text.size()));
+        if (!scriptRunIter) return false;
+
+        std::unique_ptr<SkShaper::LanguageRunIterator> languageRunIter(SkShaper::MakeStdLanguageRunIterator(text.c_str(), text.size()));
+        if (!languageRunIter) return false;
+
+        FontRunIterator fontRunIter(
+            text.c_str(),
+            text.size(),
+            *font,
+            SkFontMgr::RefDefault(),
+            graphemeIter,
+            aproximateSpaces,
+            aproximatePunctuation
+        );
+
+        instance->shape(text.c_str(), text.size(), fontRunIter, *bidiRunIter, *scriptRunIter, *languageRunIter, features.data(), features.size(), width, handler);
+        return true;
+    });
+    if (!shaped) return 0;
     SkTextBlob* blob = rh.makeBlob().release();
 
     return reinterpret_cast<KNativePointer>(blob);
@@ -119,27 +154,31 @@ SKIKO_EXPORT KNativePointer org_jetbrains_skia_shaper_Shaper__1nShapeLine
     bool aproximateSpaces = (optsBooleanProps & 0x02) != 0;
     bool isLeftToRight = (optsBooleanProps & 0x04) != 0;
 
-    uint8_t defaultBiDiLevel = isLeftToRight ? UBIDI_DEFAULT_LTR : UBIDI_DEFAULT_RTL;
-    std::unique_ptr<SkShaper::BiDiRunIterator> bidiRunIter(SkShaper::MakeBiDiRunIterator(text.c_str(), text.size(), defaultBiDiLevel));
-    if (!bidiRunIter) return 0;
-
-    std::unique_ptr<SkShaper::ScriptRunIterator> scriptRunIter(SkShaper::MakeHbIcuScriptRunIterator(text.c_str(), text.size()));
-    if (!scriptRunIter) return 0;
-
-    std::unique_ptr<SkShaper::LanguageRunIterator> languageRunIter(SkShaper::MakeStdLanguageRunIterator(text.c_str(), text.size()));
-    if (!languageRunIter) return 0;
-
-    FontRunIterator fontRunIter(
-        text.c_str(),
-        text.size(),
-        *font,
-        SkFontMgr::RefDefault(),
-        graphemeIter,
-        aproximateSpaces,
-        aproximatePunctuation);
-
     TextLineRunHandler rh(text, graphemeIter);
-    instance->shape(text.c_str(), text.size(), fontRunIter, *bidiRunIter, *scriptRunIter, *languageRunIter, features.data(), features.size(), std::numeric_limits<float>::infinity(), &rh);
+    bool shaped = ShapingCache::Get().shape(instance, text, *font, features, optsBooleanProps, std::numeric_limits<float>::infinity(), &rh, [&](SkShaper::RunHandler* handler) {
+        uint8_t defaultBiDiLevel = isLeftToRight ? UBIDI_DEFAULT_LTR : UBIDI_DEFAULT_RTL;
+        std::unique_ptr<SkShaper::BiDiRunIterator> bidiRunIter(SkShaper::MakeBiDiRunIterator(text.c_str(), text.size(), defaultBiDiLevel));
+        if (!bidiRunIter) return false;
+
+        std::unique_ptr<SkShaper::ScriptRunIterator> scriptRunIter(SkShaper::MakeHbIcuScriptRunIterator(text.c_str(), text.size()));
+        if (!scriptRunIter) return false;
+
+        std::unique_ptr<SkShaper::LanguageRunIterator> languageRunIter(SkShaper::MakeStdLanguageRunIterator(text.c_str(), text.size()));
+        if (!languageRunIter) return false;
+
+        FontRunIterator fontRunIter(
+            text.c_str(),
+            text.size(),
+            *font,
+            SkFontMgr::RefDefault(),
+            graphemeIter,
+            aproximateSpaces,
+            aproximatePunctuation);
+
+        instance->shape(text.c_str(), text.size(), fontRunIter, *bidiRunIter, *scriptRunIter, *languageRunIter, features.data(), features.size(), std::numeric_limits<float>::infinity(), handler);
+        return true;
+    });
+    if (!shaped) return 0;
     return reinterpret_cast<KNativePointer>(rh.makeLine().release());
 }
 
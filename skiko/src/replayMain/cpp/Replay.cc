@@ -0,0 +1,82 @@
+// Headless replay harness for frames captured with org.jetbrains.skia.FrameCapture.
+//
+// Usage: skiko-replay <capture.skp> [iterations] [warmup]
+//
+// Renders the capture into a raster surface of the capture size the given number of times
+// and prints min, median and p99 frame time in milliseconds.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "SkCanvas.h"
+#include "SkData.h"
+#include "SkPicture.h"
+#include "SkSurface.h"
+
+namespace {
+    const int kDefaultIterations = 100;
+    const int kDefaultWarmup = 5;
+
+    double renderMillis(SkSurface* surface, const SkPicture* picture) {
+        auto start = std::chrono::steady_clock::now();
+        SkCanvas* canvas = surface->getCanvas();
+        canvas->clear(SK_ColorTRANSPARENT);
+        canvas->drawPicture(picture);
+        surface->flushAndSubmit(true);
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    double percentile(const std::vector<double>& sorted, double p) {
+        size_t index = static_cast<size_t>(std::ceil(p * sorted.size()));
+        return sorted[std::min(sorted.size() - 1, index > 0 ? index - 1 : 0)];
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <capture.skp> [iterations] [warmup]\n", argv[0]);
+        return 2;
+    }
+    int iterations = argc > 2 ? atoi(argv[2]) : kDefaultIterations;
+    int warmup = argc > 3 ? atoi(argv[3]) : kDefaultWarmup;
+    if (iterations <= 0 || warmup < 0) {
+        fprintf(stderr, "Invalid iteration count\n");
+        return 2;
+    }
+
+    sk_sp<SkData> data = SkData::MakeFromFileName(argv[1]);
+    if (!data) {
+        fprintf(stderr, "Can't read %s\n", argv[1]);
+        return 1;
+    }
+    sk_sp<SkPicture> picture = SkPicture::MakeFromData(data.get());
+    if (!picture) {
+        fprintf(stderr, "%s is not a valid capture\n", argv[1]);
+        return 1;
+    }
+
+    SkIRect bounds = picture->cullRect().roundOut();
+    sk_sp<SkSurface> surface = SkSurface::MakeRasterN32Premul(bounds.right(), bounds.bottom());
+    if (!surface) {
+        fprintf(stderr, "Can't allocate %dx%d surface\n", bounds.right(), bounds.bottom());
+        return 1;
+    }
+
+    for (int i = 0; i < warmup; ++i)
+        renderMillis(surface.get(), picture.get());
+
+    std::vector<double> times(iterations);
+    for (int i = 0; i < iterations; ++i)
+        times[i] = renderMillis(surface.get(), picture.get());
+    std::sort(times.begin(), times.end());
+
+    printf("%s: %dx%d, %d ops, %d iterations\n", argv[1], bounds.right(), bounds.bottom(),
+           picture->approximateOpCount(true), iterations);
+    printf("min %.3f ms, median %.3f ms, p99 %.3f ms\n",
+           times.front(), percentile(times, 0.5), percentile(times, 0.99));
+    return 0;
+}